@@ -18,11 +18,29 @@
            typename LimbType>
   class miller_rabin_powm_state final
   {
+    // Calculate (b ^ p) % m step by step, with one modular squaring
+    // or multiplication in each call of calculate(). The exponent is
+    // scanned from its most significant bit with a sliding window of
+    // odd powers b^1, b^3, b^5, ... whose table is calculated first.
+    // The window size is chosen from the bit length of the exponent,
+    // such that the fewest multiplications are needed. If the base
+    // fits in a single limb (such as the base 228 of the Fermat test),
+    // the multiplications by the base only multiply with a limb
+    // and binary exponentiation is used.
+
   private:
     using local_normal_width_type = uintwide_t<Digits2, LimbType>;
     using local_double_width_type = typename local_normal_width_type::double_width_type;
     using local_limb_type         = typename local_normal_width_type::limb_type;
 
+    // The table of the odd powers has 2^(window_bits_max - 1) elements.
+    // The window is limited to 3 bits in order to save RAM on the target.
+    static constexpr unsigned window_bits_max { UINT8_C(3) };
+
+    static constexpr unsigned table_size_max { static_cast<unsigned>(1U << (window_bits_max - 1U)) };
+
+    using table_type = detail::array_detail::array<local_normal_width_type, static_cast<std::size_t>(table_size_max)>;
+
   public:
     miller_rabin_powm_state() = default;
 
@@ -33,7 +51,6 @@
               const local_normal_width_type& m) -> void
     {
       my_done = false;
-      my_y    = local_double_width_type { b };
       my_x    = local_double_width_type { unsigned { UINT8_C(1) } };
       my_p    = p;
       my_m    = m;
@@ -60,13 +77,53 @@
       else if(   (static_cast<local_limb_type>(my_p) == local_limb_type { UINT8_C(2) })
               && (my_p == unsigned { UINT8_C(2) }))
       {
-        my_y *= my_y;
-        my_y %= local_double_width_type { my_m };
-
-        my_x = my_y;
+        my_x  = local_double_width_type { b };
+        my_x *= my_x;
+        my_x %= local_double_width_type { my_m };
 
         my_done = true;
       }
+      else
+      {
+        my_table[0U] = local_normal_width_type(local_double_width_type(b) % local_double_width_type(m));
+
+        my_v          = static_cast<local_limb_type>(my_table[0U]);
+        my_v_is_small = (my_table[0U] == local_normal_width_type(my_v));
+
+        // Find the bit length of the exponent.
+        my_bit = static_cast<unsigned>(std::numeric_limits<local_normal_width_type>::digits);
+
+        while((my_bit != unsigned { UINT8_C(0) }) && (!exponent_bit(my_bit - 1U)))
+        {
+          --my_bit;
+        }
+
+        // Choose the window size with the fewest multiplications.
+        my_window_bits = unsigned { UINT8_C(1) };
+
+        if(!my_v_is_small)
+        {
+          unsigned cost_min { (std::numeric_limits<unsigned>::max)() };
+
+          for(unsigned k = unsigned { UINT8_C(1) }; k <= window_bits_max; ++k)
+          {
+            const unsigned cost { static_cast<unsigned>((1U << (k - 1U)) + (my_bit / (k + 1U))) };
+
+            if(cost < cost_min)
+            {
+              cost_min       = cost;
+              my_window_bits = k;
+            }
+          }
+        }
+
+        my_table_size = static_cast<unsigned>(1U << (my_window_bits - 1U));
+        my_table_fill = unsigned { UINT8_C(1) };
+
+        my_x_is_one          = true;
+        my_squarings         = unsigned { UINT8_C(0) };
+        my_multiply_is_ready = false;
+      }
     }
 
     auto get_done() const -> bool
@@ -85,34 +142,136 @@
 
       if(my_done == false)
       {
-        const local_limb_type p0 = static_cast<local_limb_type>(my_p);
+        if(my_table_fill < my_table_size)
+        {
+          // Fill the table of the odd powers with one multiplication
+          // by b^2 per call. The square b^2 is kept in my_x, which
+          // is not needed before the scan of the exponent starts.
+          if(my_table_fill == unsigned { UINT8_C(1) })
+          {
+            my_x  = local_double_width_type { my_table[0U] };
+            my_x *= my_x;
+            my_x %= local_double_width_type { my_m };
+          }
 
-        if(!((p0 == 0U) && (my_p == 0U)))
+          local_double_width_type y { my_table[my_table_fill - 1U] };
+
+          y *= my_x;
+          y %= local_double_width_type { my_m };
+
+          my_table[my_table_fill] = local_normal_width_type { y };
+
+          ++my_table_fill;
+
+          return;
+        }
+
+        if((my_squarings == unsigned { UINT8_C(0) }) && (!my_multiply_is_ready))
         {
-          if(local_limb_type(p0 & 1U) != 0U)
+          if(my_bit == unsigned { UINT8_C(0) })
           {
-            my_x *= my_y;
-            my_x %= local_double_width_type(my_m);
+            my_done = true;
+
+            return;
           }
 
-          my_y *= my_y;
-          my_y %= local_double_width_type(my_m);
+          // Scan the next window of the exponent, which starts at bit
+          // (my_bit - 1) and ends with a set bit, or a single zero bit.
+          if(!exponent_bit(my_bit - 1U))
+          {
+            my_squarings = unsigned { UINT8_C(1) };
 
-          my_p >>= 1;
+            --my_bit;
+          }
+          else
+          {
+            unsigned window_length { (my_window_bits < my_bit) ? my_window_bits : my_bit };
+
+            while(!exponent_bit(my_bit - window_length))
+            {
+              --window_length;
+            }
+
+            my_table_index = unsigned { UINT8_C(0) };
+
+            for(unsigned j = unsigned { UINT8_C(0) }; j < window_length; ++j)
+            {
+              my_table_index = static_cast<unsigned>((my_table_index << 1U) | (exponent_bit(my_bit - 1U - j) ? 1U : 0U));
+            }
+
+            my_table_index >>= 1U;
+
+            my_squarings = window_length;
+
+            my_multiply_is_ready = true;
+
+            my_bit -= window_length;
+          }
+
+          // The squarings of the number one are skipped.
+          if(my_x_is_one)
+          {
+            my_squarings = unsigned { UINT8_C(0) };
+          }
         }
-        else
+
+        if(my_squarings != unsigned { UINT8_C(0) })
         {
-          my_done = true;
+          my_x *= my_x;
+          my_x %= local_double_width_type { my_m };
+
+          --my_squarings;
+        }
+        else if(my_multiply_is_ready)
+        {
+          if(my_x_is_one)
+          {
+            my_x = local_double_width_type { my_table[my_table_index] };
+
+            my_x_is_one = false;
+          }
+          else if(my_v_is_small)
+          {
+            static_cast<void>(my_x.mul_by_limb(my_v));
+
+            my_x %= local_double_width_type { my_m };
+          }
+          else
+          {
+            my_x *= local_double_width_type { my_table[my_table_index] };
+            my_x %= local_double_width_type { my_m };
+          }
+
+          my_multiply_is_ready = false;
         }
       }
     }
 
   private:
-    bool                    my_done { };
-    local_double_width_type my_y    { };
-    local_double_width_type my_x    { };
-    local_normal_width_type my_p    { };
-    local_normal_width_type my_m    { };
+    bool                    my_done              { };
+    local_double_width_type my_x                 { };
+    local_normal_width_type my_p                 { };
+    local_normal_width_type my_m                 { };
+    table_type              my_table             { };
+    unsigned                my_table_size        { };
+    unsigned                my_table_fill        { };
+    unsigned                my_table_index       { };
+    unsigned                my_window_bits       { };
+    unsigned                my_bit               { };
+    unsigned                my_squarings         { };
+    bool                    my_multiply_is_ready { };
+    bool                    my_x_is_one          { };
+    bool                    my_v_is_small        { };
+    local_limb_type         my_v                 { };
+
+    auto exponent_bit(const unsigned index) const -> bool
+    {
+      constexpr unsigned limb_digits { static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits) };
+
+      const local_limb_type limb { *(my_p.crepresentation().cbegin() + static_cast<std::size_t>(index / limb_digits)) };
+
+      return (static_cast<local_limb_type>(limb >> (index % limb_digits)) & 1U) != 0U;
+    }
   };
 
   template<typename Generator1Type,
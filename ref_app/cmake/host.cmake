@@ -42,6 +42,7 @@ if ((CMAKE_CXX_COMPILER_ID MATCHES "AppleClang") OR
 
     set(_TARGET_CFLAGS
         -finline-functions
+        -DOS_CFG_TASK_PROFILE
     )
 
     set(TARGET_AFLAGS "")
@@ -59,6 +60,7 @@ else()
             -finline-limit=32
             -march=native
             -mtune=native
+            -DOS_CFG_TASK_PROFILE
         )
 
         set(TARGET_AFLAGS "")
@@ -74,6 +76,7 @@ else()
             /fp:precise
             /wd"4351" /wd"4996"
             /nologo
+            /DOS_CFG_TASK_PROFILE
         )
 
         set(TARGET_AFLAGS "")
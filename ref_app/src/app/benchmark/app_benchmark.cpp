@@ -124,6 +124,22 @@ auto app::benchmark::task_func() -> void
 
   const bool result_is_ok = app::benchmark::run_boost_crypt_hasher();
 
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_DISPATCH))
+
+  const bool result_is_ok = app::benchmark::run_os_dispatch();
+
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_IDLE_SLEEP))
+
+  const bool result_is_ok = app::benchmark::run_os_idle_sleep();
+
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EXECUTOR))
+
+  const bool result_is_ok = app::benchmark::run_os_executor();
+
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EVENT))
+
+  const bool result_is_ok = app::benchmark::run_os_event();
+
   #endif
 
   // Set the benchmark port pin level to low.
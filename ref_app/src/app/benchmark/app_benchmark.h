@@ -8,6 +8,8 @@
 #ifndef APP_BENCHMARK_2018_10_02_H
   #define APP_BENCHMARK_2018_10_02_H
 
+  #include <app/benchmark/app_benchmark_registry.h>
+
   #define APP_BENCHMARK_TYPE_NONE                                0
   #define APP_BENCHMARK_TYPE_COMPLEX                             1
   #define APP_BENCHMARK_TYPE_CRC                                 2
@@ -32,6 +34,10 @@
   #define APP_BENCHMARK_TYPE_NON_STD_DECIMAL                    21
   #define APP_BENCHMARK_TYPE_PI_AGM_100                         22
   #define APP_BENCHMARK_TYPE_BOOST_CRYPT_HASHER                 23
+  #define APP_BENCHMARK_TYPE_OS_DISPATCH                        24
+  #define APP_BENCHMARK_TYPE_OS_IDLE_SLEEP                      25
+  #define APP_BENCHMARK_TYPE_OS_EXECUTOR                        26
+  #define APP_BENCHMARK_TYPE_OS_EVENT                           27
 
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_NONE
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_COMPLEX
@@ -57,6 +63,10 @@
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_NON_STD_DECIMAL
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_PI_AGM_100
   //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_BOOST_CRYPT_HASHER
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_OS_DISPATCH
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_OS_IDLE_SLEEP
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_OS_EXECUTOR
+  //#define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_OS_EVENT
 
   #if !defined(APP_BENCHMARK_TYPE)
   #define APP_BENCHMARK_TYPE   APP_BENCHMARK_TYPE_NONE
@@ -110,6 +120,14 @@
   auto run_non_std_decimal() -> bool;
   #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_BOOST_CRYPT_HASHER))
   auto run_boost_crypt_hasher() -> bool;
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_DISPATCH))
+  auto run_os_dispatch() -> bool;
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_IDLE_SLEEP))
+  auto run_os_idle_sleep() -> bool;
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EXECUTOR))
+  auto run_os_executor() -> bool;
+  #elif (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EVENT))
+  auto run_os_event() -> bool;
   #else
   #error APP_BENCHMARK_TYPE is undefined.
   #endif
@@ -61,6 +61,8 @@ auto app::benchmark::run_boost_crypt_hasher() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(boost_crypt_hasher)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 constexpr auto app_benchmark_standalone_foodcafe = static_cast<std::uint32_t>(UINT32_C(0xF00DCAFE));
 
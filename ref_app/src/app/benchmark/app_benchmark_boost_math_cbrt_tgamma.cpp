@@ -93,6 +93,8 @@ auto app::benchmark::run_boost_math_cbrt_tgamma() -> bool
   return app_benchmark_result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(boost_math_cbrt_tgamma)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
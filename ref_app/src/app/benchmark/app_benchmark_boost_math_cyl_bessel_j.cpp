@@ -133,6 +133,8 @@ auto app::benchmark::run_boost_math_cbrt_cyl_bessel_j() -> bool
   return app_benchmark_result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(boost_math_cyl_bessel_j)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
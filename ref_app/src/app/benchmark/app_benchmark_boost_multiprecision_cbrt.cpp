@@ -90,6 +90,8 @@ auto app::benchmark::run_boost_multiprecision_cbrt() -> bool
   return app_benchmark_result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(boost_multiprecision_cbrt)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
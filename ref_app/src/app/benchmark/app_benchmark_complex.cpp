@@ -37,6 +37,8 @@ auto app::benchmark::run_complex() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(complex)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2007 - 2019.
+//  Copyright Christopher Kormanyos 2007 - 2026.
 //  Distributed under the Boost Software License,
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -30,6 +30,8 @@ auto app::benchmark::run_crc() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(crc)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 constexpr auto app_benchmark_standalone_foodcafe = static_cast<std::uint32_t>(UINT32_C(0xF00DCAFE));
 
@@ -67,6 +69,230 @@ extern "C"
   }
 }
 
+#if defined(APP_BENCHMARK_CRC_THROUGHPUT)
+
+// The throughput of the CRC engines is measured on the host only,
+// since the large inputs and tables do not fit on the targets.
+
+#if !defined(UTIL_SAFETY_MEMORY_CRC_USE_THREADS)
+#define UTIL_SAFETY_MEMORY_CRC_USE_THREADS
+#endif
+
+#include <math/checksums/crc/crc32_clmul.h>
+#include <util/safety/memory/util_safety_rom_memory_checksum.h>
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace local
+{
+  using data_type = std::vector<std::uint8_t>;
+
+  constexpr auto crc_size_min = static_cast<std::size_t>(UINT32_C(0x00000400)); //  1 KiB
+  constexpr auto crc_size_max = static_cast<std::size_t>(UINT32_C(0x04000000)); // 64 MiB
+
+  template<typename engine_type>
+  auto crc_verify_and_report(const char* name, const data_type& data, const std::vector<std::uint32_t>& expected) -> bool
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    std::cout << std::left << std::setw(12) << name << std::right;
+
+    auto result_is_ok = true;
+
+    auto expected_index = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto size = crc_size_min; size <= crc_size_max; size *= 16U)
+    {
+      // Process roughly the same total amount of data for each input size.
+      const auto repetitions = (std::max)(static_cast<std::size_t>((crc_size_max / size) / 4U), static_cast<std::size_t>(UINT8_C(1)));
+
+      std::uint32_t crc { };
+
+      const auto start = clock_type::now();
+
+      for(auto count = static_cast<std::size_t>(UINT8_C(0)); count < repetitions; ++count)
+      {
+        crc = math::checksums::crc::crc32_mpeg2<engine_type>(data.data(), data.data() + size);
+
+        result_is_ok = ((crc == expected[expected_index]) && result_is_ok);
+      }
+
+      const auto stop = clock_type::now();
+
+      ++expected_index;
+
+      const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+
+      const auto mib_per_second = ((static_cast<double>(size) * static_cast<double>(repetitions)) / seconds) / 1048576.0;
+
+      std::cout << std::setw(8) << (size / 1024U) << " KiB: " << std::fixed << std::setprecision(0) << std::setw(6) << mib_per_second << " MiB/s";
+    }
+
+    std::cout << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename engine_type>
+  auto crc_verify_check(const std::uint64_t check) -> bool
+  {
+    constexpr char check_string[] = "123456789"; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    // Verify the check value, also with streaming and with combine.
+    engine_type engine { };
+
+    engine.update(check_string, check_string + 4U);
+    engine.update(check_string + 4U, check_string + 9U);
+
+    const auto crc_head = engine_type::compute(check_string, check_string + 4U);
+    const auto crc_tail = engine_type::compute(check_string + 4U, check_string + 9U);
+
+    return (   (engine_type::compute(check_string, check_string + 9U) == static_cast<typename engine_type::value_type>(check))
+            && (engine.value() == static_cast<typename engine_type::value_type>(check))
+            && (engine_type::combine(crc_head, crc_tail, 5U) == static_cast<typename engine_type::value_type>(check)));
+  }
+
+  auto crc_verify_catalog() -> bool
+  {
+    using math::checksums::crc::crc_engine;
+
+    auto result_is_ok = true;
+
+    result_is_ok = (crc_verify_check<crc_engine< 8U, UINT8_C(0x31),                 UINT8_C(0),                     true,  true,  UINT8_C(0),                     1U>>(UINT8_C(0xA1))                  && result_is_ok); // CRC-8/MAXIM (SWDM)
+    result_is_ok = (crc_verify_check<crc_engine<16U, UINT16_C(0x1021),              UINT16_C(0xFFFF),               false, false, UINT16_C(0),                    8U>>(UINT16_C(0x29B1))               && result_is_ok); // CRC-16/CCITT-FALSE
+    result_is_ok = (crc_verify_check<crc_engine<16U, UINT16_C(0x1021),              UINT16_C(0),                    true,  true,  UINT16_C(0),                    4U>>(UINT16_C(0x2189))               && result_is_ok); // CRC-16/KERMIT
+    result_is_ok = (crc_verify_check<crc_engine<12U, UINT16_C(0x080F),              UINT16_C(0),                    false, true,  UINT16_C(0),                    8U>>(UINT16_C(0x0DAF))               && result_is_ok); // CRC-12/UMTS
+    result_is_ok = (crc_verify_check<crc_engine<32U, UINT32_C(0x04C11DB7),          UINT32_C(0xFFFFFFFF),           true,  true,  UINT32_C(0xFFFFFFFF),           8U>>(UINT32_C(0xCBF43926))           && result_is_ok); // CRC-32
+    result_is_ok = (crc_verify_check<crc_engine<32U, UINT32_C(0x04C11DB7),          UINT32_C(0),                    false, false, UINT32_C(0),                    4U>>(UINT32_C(0x89A1897F))           && result_is_ok); // ROM checksum
+    result_is_ok = (crc_verify_check<crc_engine<64U, UINT64_C(0x42F0E1EBA9EA3693),  UINT64_C(0xFFFFFFFFFFFFFFFF),   true,  true,  UINT64_C(0xFFFFFFFFFFFFFFFF),   8U>>(UINT64_C(0x995DC9BBDF1939FA))   && result_is_ok); // CRC-64/XZ
+
+    std::cout << "crc_engine catalog: " << (result_is_ok ? "ok" : "FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Compute the CRC of the data in chunks and combine the chunk CRCs.
+  auto crc_verify_combine(const data_type& data, const std::uint32_t expected) -> bool
+  {
+    constexpr auto chunk_count = static_cast<std::size_t>(UINT8_C(64));
+
+    const auto chunk_size = static_cast<std::size_t>(data.size() / chunk_count);
+
+    std::uint32_t crc { };
+
+    for(auto chunk = static_cast<std::size_t>(UINT8_C(0)); chunk < chunk_count; ++chunk)
+    {
+      const auto first = data.data() + (chunk * chunk_size);
+
+      const auto crc_chunk = math::checksums::crc::crc32_mpeg2<math::checksums::crc::crc32_mpeg2_engine_dispatch>(first, first + chunk_size);
+
+      crc = ((chunk == static_cast<std::size_t>(UINT8_C(0))) ? crc_chunk : math::checksums::crc::crc32_mpeg2_combine(crc, crc_chunk, chunk_size));
+    }
+
+    const auto result_is_ok = (crc == expected);
+
+    std::cout << "crc32_mpeg2_combine: " << (result_is_ok ? "ok" : "FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Run the ROM memory checksum over the data, which is divided into
+  // two memory blocks, with the given number of bytes per service call.
+  template<typename crc_engine_type>
+  auto crc_verify_rom_checksum(const char* name, const data_type& data, const std::size_t bytes_per_service) -> bool
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    using memory_address_type = std::uintptr_t;
+
+    using rom_memory_checksum_type = util::safety::rom_memory_checksum<memory_address_type, 2U, crc_engine_type>;
+
+    const auto data_address = reinterpret_cast<memory_address_type>(data.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    const auto size_of_block0 = static_cast<std::size_t>((data.size() / 3U) + 1U);
+
+    const typename rom_memory_checksum_type::memory_list_type memory_list =
+    {{
+      { data_address,                  size_of_block0 },
+      { data_address + size_of_block0, data.size() - size_of_block0 }
+    }};
+
+    // The expected result is stored with its most significant byte first.
+    const auto crc_expected = crc_engine_type::update_register(static_cast<std::uint32_t>(UINT8_C(0)), data.cbegin(), data.cend());
+
+    const std::array<std::uint8_t, 4U> result_in_rom =
+    {{
+      static_cast<std::uint8_t>(crc_expected >> 24U), static_cast<std::uint8_t>(crc_expected >> 16U),
+      static_cast<std::uint8_t>(crc_expected >>  8U), static_cast<std::uint8_t>(crc_expected)
+    }};
+
+    rom_memory_checksum_type rom_checksum(memory_list, reinterpret_cast<memory_address_type>(result_in_rom.data()), bytes_per_service); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    const auto start = clock_type::now();
+
+    while(rom_checksum.get_result_of_process() == rom_memory_checksum_type::result_is_undetermined)
+    {
+      rom_checksum.service();
+    }
+
+    const auto stop = clock_type::now();
+
+    const auto result_is_ok = (rom_checksum.get_result_of_process() == rom_memory_checksum_type::result_is_finished_and_correct);
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+
+    std::cout << "rom_memory_checksum " << std::left << std::setw(12) << name << std::right
+              << std::setw(10) << bytes_per_service << " bytes/service: "
+              << std::fixed << std::setprecision(3) << seconds << " s"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto crc_throughput() -> bool
+  {
+    data_type data(crc_size_max);
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x0376E6E7)) };
+
+    for(auto& value : data) { value = static_cast<std::uint8_t>(generator()); }
+
+    // The nibble engine is the reference for all others.
+    std::vector<std::uint32_t> expected { };
+
+    for(auto size = crc_size_min; size <= crc_size_max; size *= 16U)
+    {
+      expected.push_back(math::checksums::crc::crc32_mpeg2(data.data(), data.data() + size));
+    }
+
+    using namespace math::checksums::crc;
+
+    auto result_is_ok = (crc_verify_catalog() && crc_verify_combine(data, expected.back()));
+
+    result_is_ok = (crc_verify_and_report<crc32_mpeg2_engine_nibble>     ("nibble",      data, expected) && result_is_ok);
+    result_is_ok = (crc_verify_and_report<crc32_mpeg2_engine_byte>       ("byte",        data, expected) && result_is_ok);
+    result_is_ok = (crc_verify_and_report<crc32_mpeg2_engine_slice_by_8> ("slice_by_8",  data, expected) && result_is_ok);
+    result_is_ok = (crc_verify_and_report<crc32_mpeg2_engine_slice_by_16>("slice_by_16", data, expected) && result_is_ok);
+    result_is_ok = (crc_verify_and_report<crc32_mpeg2_engine_dispatch>   ((crc32_mpeg2_engine_dispatch::uses_clmul() ? "clmul" : "dispatch"), data, expected) && result_is_ok);
+
+    using rom_engine_byte_type = crc_engine<32U, crc32_mpeg2_polynomial, UINT32_C(0), false, false, UINT32_C(0), 8U>;
+
+    result_is_ok = (crc_verify_rom_checksum<util::safety::rom_memory_checksum_crc_engine_type>("nibble", data, 1U)           && result_is_ok);
+    result_is_ok = (crc_verify_rom_checksum<util::safety::rom_memory_checksum_crc_engine_type>("nibble", data, data.size())  && result_is_ok);
+    result_is_ok = (crc_verify_rom_checksum<rom_engine_byte_type>                             ("byte",   data, 4096U)        && result_is_ok);
+    result_is_ok = (crc_verify_rom_checksum<rom_engine_byte_type>                             ("byte",   data, data.size())  && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace local
+
+#endif // APP_BENCHMARK_CRC_THROUGHPUT
+
 int main()
 {
   auto result_is_ok = true;
@@ -74,6 +300,12 @@ int main()
   result_is_ok = (::app_benchmark_run_standalone       () && result_is_ok);
   result_is_ok = (::app_benchmark_get_standalone_result() && result_is_ok);
 
+  #if defined(APP_BENCHMARK_CRC_THROUGHPUT)
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_CRC -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_CRC_THROUGHPUT ./ref_app/src/app/benchmark/app_benchmark_crc.cpp -o ./ref_app/bin/app_benchmark_crc.exe
+
+  result_is_ok = (local::crc_throughput() && result_is_ok);
+  #endif
+
   return (result_is_ok ? 0 : -1);
 }
 
@@ -211,10 +211,301 @@ auto my_hardware_random_device_generator(void) -> unsigned int
   return static_cast<unsigned int>(util::make_long(pseudo_random1, pseudo_random2));
 }
 
+APP_BENCHMARK_REGISTER(ecc_generic_ecc)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_ECC_GENERIC_ECC_THROUGHPUT)
+
+// The speedup of the scalar multiplications in Jacobian coordinates
+// (comb table for the generator, wNAF for other points) over affine
+// double-and-add, and with the field in Montgomery form or with the
+// reduction for the special prime, is measured on the host only.
+
+#include <util/utility/util_thread_executor.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace local
+{
+  template<template<typename, const char*> class FieldType>
+  using curve_of_field_type =
+    generic_ecc::ecc_elliptic_curve<static_cast<unsigned>(UINT16_C(256)),
+                                    std::uint32_t,
+                                    curve_secp256k1::CurveName,            // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::FieldCharacteristicP, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::CurveCoefficientA,    // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::CurveCoefficientB,    // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::BasePointGx,          // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::BasePointGy,          // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::SubGroupOrderN,       // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                                    curve_secp256k1::SubGroupCoFactorH,
+                                    curve_secp256k1::hash_type,
+                                    FieldType>;
+
+  using curve_type            = curve_of_field_type<generic_ecc::ecc_field_generic>;
+  using curve_montgomery_type = curve_of_field_type<generic_ecc::ecc_field_montgomery>;
+  using curve_special_type    = curve_of_field_type<generic_ecc::ecc_field_special_prime>;
+
+  using point_type       = typename curve_type::point_type;
+  using uint_type        = typename curve_type::uint_type;
+
+  // The former scalar multiplication: affine double-and-add, with one
+  // inversion in each addition and each doubling.
+  auto scalar_mult_affine(const uint_type& k, const point_type& point) -> point_type
+  {
+    point_type result { };
+    point_type addend = point;
+
+    for(auto bit = static_cast<unsigned>(UINT8_C(0)); bit < static_cast<unsigned>(std::numeric_limits<uint_type>::digits); ++bit)
+    {
+      if((static_cast<unsigned>(k >> bit) & 1U) != 0U)
+      {
+        result = curve_type::point_add(result, addend);
+      }
+
+      addend = curve_type::point_add(addend, addend);
+    }
+
+    return result;
+  }
+
+  template<typename function_type>
+  auto microseconds_per_call(const unsigned count, function_type function) -> double
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    const auto start = clock_type::now();
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      function(index);
+    }
+
+    const auto stop = clock_type::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(stop - start).count() / static_cast<double>(count);
+  }
+
+  auto ecc_generic_ecc_throughput() -> bool
+  {
+    constexpr auto count = static_cast<unsigned>(UINT8_C(32));
+
+    std::array<uint_type, count> scalars { };
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x2E5C9A11)) };
+
+    for(auto& scalar : scalars)
+    {
+      for(auto index = static_cast<unsigned>(UINT8_C(0)); index < static_cast<unsigned>(UINT8_C(8)); ++index)
+      {
+        scalar = static_cast<uint_type>((scalar << 32U) | static_cast<uint_type>(generator()));
+      }
+    }
+
+    const point_type g { curve_type::curve_gx(), curve_type::curve_gy() };
+
+    const point_type q = curve_type::scalar_mult(scalars.back(), g);
+
+    auto result_is_ok = true;
+
+    std::array<point_type, count> expected { };
+    std::array<point_type, count> results  { };
+
+    const auto us_g_affine = microseconds_per_call(count, [&](const unsigned index) { expected[index] = scalar_mult_affine(scalars[index], g); });
+    const auto us_g        = microseconds_per_call(count, [&](const unsigned index) { results [index] = curve_type::scalar_mult(scalars[index], g); });
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      result_is_ok = ((results[index].my_x == expected[index].my_x) && (results[index].my_y == expected[index].my_y) && result_is_ok);
+    }
+
+    const auto us_q_affine = microseconds_per_call(count, [&](const unsigned index) { expected[index] = scalar_mult_affine(scalars[index], q); });
+    const auto us_q        = microseconds_per_call(count, [&](const unsigned index) { results [index] = curve_type::scalar_mult(scalars[index], q); });
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      result_is_ok = ((results[index].my_x == expected[index].my_x) && (results[index].my_y == expected[index].my_y) && result_is_ok);
+    }
+
+    // The same scalar multiplications with the field in Montgomery form
+    // and with the reduction for the special prime of secp256k1.
+    std::array<point_type, count> results_g { };
+
+    const auto us_g_montgomery = microseconds_per_call(count, [&](const unsigned index) { results_g[index] = curve_montgomery_type::scalar_mult(scalars[index], g); });
+    const auto us_q_montgomery = microseconds_per_call(count, [&](const unsigned index) { results  [index] = curve_montgomery_type::scalar_mult(scalars[index], q); });
+
+    std::array<point_type, count> expected_g { };
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      expected_g[index] = curve_type::scalar_mult(scalars[index], g);
+    }
+
+    const auto results_are_ok =
+      [&]()
+      {
+        auto results_ok = true;
+
+        for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+        {
+          results_ok = ((results_g[index].my_x == expected_g[index].my_x) && (results_g[index].my_y == expected_g[index].my_y) && results_ok);
+          results_ok = ((results  [index].my_x == expected  [index].my_x) && (results  [index].my_y == expected  [index].my_y) && results_ok);
+        }
+
+        return results_ok;
+      };
+
+    result_is_ok = (results_are_ok() && result_is_ok);
+
+    const auto us_g_special = microseconds_per_call(count, [&](const unsigned index) { results_g[index] = curve_special_type::scalar_mult(scalars[index], g); });
+    const auto us_q_special = microseconds_per_call(count, [&](const unsigned index) { results  [index] = curve_special_type::scalar_mult(scalars[index], q); });
+
+    result_is_ok = (results_are_ok() && result_is_ok);
+
+    // Sign and verify the message "Hello!" with the keys of the benchmark.
+    const std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(6))> msg_as_array { 'H', 'e', 'l', 'l', 'o', '!' };
+
+    std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(64))> sig { };
+
+    const auto us_sign =
+      microseconds_per_call
+      (
+        count,
+        [&](const unsigned)
+        {
+          static_cast<void>(ds.sign(msg_as_array.data(), msg_as_array.size(), private_key.data(), private_key.size(), sig.data(), nullptr, seed_sign.data(), seed_sign.size()));
+        }
+      );
+
+    result_is_ok = ((sig == sig_ctrl) && result_is_ok);
+
+    const auto us_verify =
+      microseconds_per_call
+      (
+        count,
+        [&](const unsigned)
+        {
+          result_is_ok = (ds.verify(msg_as_array.data(), msg_as_array.size(), sig.data(), sig.size(), public_key_xy.data(), public_key_xy.size()) && result_is_ok);
+        }
+      );
+
+    std::cout << std::fixed << std::setprecision(0)
+              << "k * G: affine "  << us_g_affine << " us, comb "  << us_g << " us (x" << std::setprecision(1) << (us_g_affine / us_g) << ")" << std::setprecision(0)
+              << ", k * Q: affine " << us_q_affine << " us, wNAF " << us_q << " us (x" << std::setprecision(1) << (us_q_affine / us_q) << ")" << std::setprecision(0)
+              << ", montgomery field: k * G " << us_g_montgomery << " us, k * Q " << us_q_montgomery << " us"
+              << ", special prime: k * G " << us_g_special << " us, k * Q " << us_q_special << " us"
+              << ", sign: " << us_sign << " us, verify: " << us_verify << " us"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Sign a batch of messages with distinct keys and verify them one
+  // after the other, as one batch, and as a batch in four partitions
+  // on threads. A few signatures, messages and keys are corrupted.
+  auto ecc_generic_ecc_verify_batch() -> bool
+  {
+    using item_type = typename digital_signature_secp256k1_type::verify_batch_item_type;
+
+    constexpr auto count = static_cast<std::size_t>(UINT8_C(64));
+
+    using key_type       = std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(64))>;
+    using signature_type = std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(64))>;
+    using message_type   = std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(40))>;
+
+    std::vector<key_type>       public_keys(count);
+    std::vector<signature_type> signatures (count);
+    std::vector<message_type>   messages   (count);
+    std::vector<item_type>      items      (count);
+
+    std::vector<bool> expected(count, true);
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x5EED0017)) };
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < count; ++index)
+    {
+      std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(32))> seed_key  { };
+      std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(32))> seed_sig  { };
+      std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(32))> secret_key { };
+
+      for(auto& value : seed_key)        { value = static_cast<std::uint8_t>(generator()); }
+      for(auto& value : seed_sig)        { value = static_cast<std::uint8_t>(generator()); }
+      for(auto& value : messages[index]) { value = static_cast<std::uint8_t>(generator()); }
+
+      // Keep the secret keys and the nonces below the order n.
+      seed_key.front() = static_cast<std::uint8_t>(seed_key.front() & UINT8_C(0x7F));
+      seed_sig.front() = static_cast<std::uint8_t>(seed_sig.front() & UINT8_C(0x7F));
+
+      static_cast<void>(ds.keypair_generate(public_keys[index].data(), nullptr, secret_key.data(), nullptr, seed_key.data(), seed_key.size()));
+
+      static_cast<void>(ds.sign(messages[index].data(), messages[index].size(), secret_key.data(), secret_key.size(), signatures[index].data(), nullptr, seed_sig.data(), seed_sig.size()));
+
+      items[index] = { messages[index].data(), messages[index].size(), signatures[index].data(), public_keys[index].data() };
+    }
+
+    signatures [ 5U][40U] ^= UINT8_C(0x01); expected[ 5U] = false;
+    messages   [17U][ 3U] ^= UINT8_C(0x80); expected[17U] = false;
+    public_keys[42U][60U] ^= UINT8_C(0x10); expected[42U] = false;
+    std::fill(signatures[50U].begin() + 32, signatures[50U].end(), UINT8_C(0)); expected[50U] = false;
+
+    auto result_is_ok = true;
+
+    bool results_single[count] { };   // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    bool results_batch [count] { };   // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    bool results_thread[count] { };   // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    // The timings are the minimum of a few rounds.
+    auto us_single = (std::numeric_limits<double>::max)();
+    auto us_batch  = (std::numeric_limits<double>::max)();
+    auto us_thread = (std::numeric_limits<double>::max)();
+
+    for(auto round = static_cast<unsigned>(UINT8_C(0)); round < static_cast<unsigned>(UINT8_C(4)); ++round)
+    {
+      us_single =
+        (std::min)
+        (
+          us_single,
+          microseconds_per_call
+          (
+            static_cast<unsigned>(count),
+            [&](const unsigned index)
+            {
+              results_single[index] = ds.verify(messages[index].data(), messages[index].size(), signatures[index].data(), signatures[index].size(), public_keys[index].data(), public_keys[index].size());
+            }
+          )
+        );
+
+      us_batch  = (std::min)(us_batch,  microseconds_per_call(1U, [&](const unsigned) { static_cast<void>(ds.verify_batch(items.data(), count, results_batch)); }) / static_cast<double>(count));
+      us_thread = (std::min)(us_thread, microseconds_per_call(1U, [&](const unsigned) { static_cast<void>(ds.verify_batch(items.data(), count, results_thread, 4U, util::thread_executor { })); }) / static_cast<double>(count));
+    }
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < count; ++index)
+    {
+      result_is_ok = (   (results_single[index] == expected[index])
+                      && (results_batch [index] == expected[index])
+                      && (results_thread[index] == expected[index])
+                      && result_is_ok);
+    }
+
+    std::cout << std::fixed << std::setprecision(0)
+              << "verify " << count << " signatures: single " << us_single << " us"
+              << ", batch " << us_batch << " us"
+              << ", batch on 4 threads " << us_thread << " us per signature"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace local
+
+#endif // APP_BENCHMARK_ECC_GENERIC_ECC_THROUGHPUT
+
 int main()
 {
-  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_ECC_GENERIC_ECC -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_hash.cpp -o ./ref_app/bin/app_benchmark_hash.exe
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_ECC_GENERIC_ECC -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_ECC_GENERIC_ECC_THROUGHPUT ./ref_app/src/app/benchmark/app_benchmark_ecc_generic_ecc.cpp -o ./ref_app/bin/app_benchmark_ecc_generic_ecc.exe
 
   auto result_is_ok = true;
 
@@ -223,6 +514,11 @@ int main()
     result_is_ok = (app::benchmark::run_ecc_generic_ecc() && result_is_ok);
   }
 
+  #if defined(APP_BENCHMARK_ECC_GENERIC_ECC_THROUGHPUT)
+  result_is_ok = (local::ecc_generic_ecc_throughput() && result_is_ok);
+  result_is_ok = (local::ecc_generic_ecc_verify_batch() && result_is_ok);
+  #endif
+
   return (result_is_ok ? 0 : -1);
 }
 
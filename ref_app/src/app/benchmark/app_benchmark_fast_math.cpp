@@ -46,6 +46,8 @@ auto app::benchmark::run_fast_math() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(fast_math)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -51,6 +51,8 @@ auto app::benchmark::run_filter() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(filter)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -49,6 +49,8 @@ auto app::benchmark::run_fixed_point() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(fixed_point)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -104,6 +104,8 @@ bool app::benchmark::run_float()
   return app_benchmark_result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(float)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -53,6 +53,8 @@ auto app::benchmark::run_hash() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(hash)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -54,10 +54,272 @@ auto app::benchmark::run_hash_sha256() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(hash_sha256)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_HASH_SHA256_THROUGHPUT)
+
+// The throughput of the single-stream and the multi-buffer SHA-256
+// and the incremental tree hash are measured on the host only, since
+// the large inputs do not fit on the targets.
+
+#include <math/checksums/hash/hash_sha256_multi.h>
+#include <math/checksums/hash/hash_sha256_tree.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace local
+{
+  using data_type = std::vector<std::uint8_t>;
+
+  constexpr auto hash_data_size = static_cast<std::size_t>(UINT32_C(0x01000000)); // 16 MiB
+
+  // Hash the data as records of the given size, one after the other.
+  auto hash_single(const data_type& data, const std::size_t record_size, std::vector<app_benchmark_hash_result_type>& results) -> void
+  {
+    app_benchmark_hash_type hash_object { };
+
+    for(std::size_t record = 0U; record < results.size(); ++record)
+    {
+      hash_object.hash(data.data() + (record * record_size), static_cast<app_benchmark_hash_count_type>(record_size));
+
+      hash_object.get_result(results[record].data());
+    }
+  }
+
+  // Hash the data as records of the given size, LaneCount records at a time.
+  template<const std::size_t LaneCount>
+  auto hash_multi(const data_type& data, const std::size_t record_size, std::vector<app_benchmark_hash_result_type>& results) -> void
+  {
+    math::checksums::hash::hash_sha256_multi<LaneCount> hash_object { };
+
+    std::array<const std::uint8_t*, LaneCount> messages { };
+    std::array<std::size_t, LaneCount>         counts   { };
+
+    counts.fill(record_size);
+
+    for(std::size_t record = 0U; record < results.size(); record += LaneCount)
+    {
+      for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+      {
+        messages[lane] = data.data() + ((record + lane) * record_size);
+      }
+
+      hash_object.hash(messages.data(), counts.data());
+
+      for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+      {
+        hash_object.get_result(lane, results[record + lane].data());
+      }
+    }
+  }
+
+  template<typename hash_function_type>
+  auto hash_verify_and_report(const char* name, const data_type& data, hash_function_type hash_function) -> bool
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    std::cout << std::left << std::setw(20) << name << std::right;
+
+    auto result_is_ok = true;
+
+    for(auto record_size = static_cast<std::size_t>(UINT8_C(64)); record_size <= static_cast<std::size_t>(UINT16_C(16384)); record_size *= 4U)
+    {
+      std::vector<app_benchmark_hash_result_type> expected(data.size() / record_size);
+      std::vector<app_benchmark_hash_result_type> results (data.size() / record_size);
+
+      hash_single(data, record_size, expected);
+
+      const auto start = clock_type::now();
+
+      hash_function(data, record_size, results);
+
+      const auto stop = clock_type::now();
+
+      result_is_ok = ((results == expected) && result_is_ok);
+
+      const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+
+      const auto mb_per_second = (static_cast<double>(data.size()) / seconds) / 1.0E6;
+
+      std::cout << std::setw(7) << record_size << " B: " << std::fixed << std::setprecision(0) << std::setw(5) << mb_per_second << " MB/s";
+    }
+
+    std::cout << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  auto hash_sha256_throughput() -> bool
+  {
+    data_type data(hash_data_size);
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x0376E6E7)) };
+
+    for(auto& value : data) { value = static_cast<std::uint8_t>(generator()); }
+
+    #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_SHANI)
+    const auto single_name = (math::checksums::hash::detail::sha256_shani::uses_shani() ? "single (sha-ni)" : "single (scalar)");
+    #else
+    const auto single_name = "single (scalar)";
+    #endif
+
+    const auto multi4_name = std::string("multi x4 (") + math::checksums::hash::hash_sha256_multi<4U>::engine_name() + ")";
+    const auto multi8_name = std::string("multi x8 (") + math::checksums::hash::hash_sha256_multi<8U>::engine_name() + ")";
+
+    auto result_is_ok = true;
+
+    result_is_ok = (hash_verify_and_report(single_name,         data, hash_single)   && result_is_ok);
+    result_is_ok = (hash_verify_and_report(multi4_name.c_str(), data, hash_multi<4U>) && result_is_ok);
+    result_is_ok = (hash_verify_and_report(multi8_name.c_str(), data, hash_multi<8U>) && result_is_ok);
+
+    return result_is_ok;
+  }
+
+  template<typename function_type>
+  auto milliseconds_of(function_type function) -> double
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    const auto start = clock_type::now();
+
+    function();
+
+    const auto stop = clock_type::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(stop - start).count();
+  }
+
+  // Hash an image of 64 MiB serially and as a tree, then patch a few bytes
+  // of the image and hash again only the modified leaf of the tree, which
+  // has been restored from its saved leaf digests. The roots are verified
+  // against the tree hash of the entire patched image.
+  auto hash_sha256_tree_incremental() -> bool
+  {
+    using tree_type = math::checksums::hash::hash_sha256_tree;
+
+    data_type image(static_cast<std::size_t>(UINT32_C(0x04000000)));
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x1D6E1A2B)) };
+
+    for(auto& value : image) { value = static_cast<std::uint8_t>(generator()); }
+
+    std::cout << "tree " << (image.size() / 1024U / 1024U) << " MiB, " << (tree_type::default_leaf_size / 1024U) << " KiB leaves:";
+
+    const auto ms_serial =
+      milliseconds_of
+      (
+        [&image]()
+        {
+          math::checksums::hash::hash_sha256<std::uint64_t> hash_object { };
+
+          hash_object.hash(image.data(), static_cast<std::uint64_t>(image.size()));
+        }
+      );
+
+    tree_type tree { };
+
+    const auto ms_full = milliseconds_of([&tree, &image]() { tree.hash(image.data(), image.size()); });
+
+    std::stringstream cache { };
+
+    auto result_is_ok = tree.save(cache);
+
+    {
+      // A cache with an invalid hex digit in a leaf digest is rejected.
+      auto text_corrupt = cache.str();
+
+      text_corrupt[text_corrupt.find('\n') + 2U] = 'g';
+
+      std::stringstream cache_corrupt { text_corrupt };
+
+      tree_type tree_corrupt { };
+
+      result_is_ok = ((!tree_corrupt.load(cache_corrupt)) && result_is_ok);
+    }
+
+    // Patch 16 bytes in the middle of the image.
+    const auto patch_offset = static_cast<std::size_t>(UINT32_C(0x01234567));
+    const auto patch_length = static_cast<std::size_t>(UINT8_C(16));
+
+    for(auto index = patch_offset; index < (patch_offset + patch_length); ++index)
+    {
+      image[index] = static_cast<std::uint8_t>(~image[index]);
+    }
+
+    tree_type tree_from_cache { };
+
+    const auto ms_update =
+      milliseconds_of
+      (
+        [&]()
+        {
+          result_is_ok = (tree_from_cache.load(cache) && result_is_ok);
+
+          tree_from_cache.update(image.data(), image.size(), patch_offset, patch_length);
+        }
+      );
+
+    tree_type tree_expected { };
+
+    app_benchmark_hash_result_type root          { };
+    app_benchmark_hash_result_type root_expected { };
+
+    tree_expected.hash(image.data(), image.size());
+
+    tree_from_cache.get_result(root.data());
+    tree_expected.get_result(root_expected.data());
+
+    result_is_ok = ((root == root_expected) && result_is_ok);
+
+    // Append a few bytes, which also changes the last leaf.
+    image.resize(image.size() + static_cast<std::size_t>(UINT16_C(1000)), static_cast<std::uint8_t>(UINT8_C(0x5A)));
+
+    tree_from_cache.update(image.data(), image.size(), image.size() - static_cast<std::size_t>(UINT16_C(1000)), static_cast<std::size_t>(UINT16_C(1000)));
+    tree_expected.hash(image.data(), image.size());
+
+    tree_from_cache.get_result(root.data());
+    tree_expected.get_result(root_expected.data());
+
+    result_is_ok = ((root == root_expected) && result_is_ok);
+
+    // Truncate the image in the middle of a leaf and report the removed
+    // bytes at the old end, beyond the new end, as the modified range.
+    // This shortens the new last leaf, which must be hashed again.
+    const auto image_size_old = image.size();
+
+    image.resize(image_size_old - static_cast<std::size_t>((tree_type::default_leaf_size / 2U) + static_cast<std::size_t>(UINT16_C(1000))));
+
+    tree_from_cache.update(image.data(), image.size(), image_size_old - static_cast<std::size_t>(UINT16_C(1000)), static_cast<std::size_t>(UINT16_C(1000)));
+    tree_expected.hash(image.data(), image.size());
+
+    tree_from_cache.get_result(root.data());
+    tree_expected.get_result(root_expected.data());
+
+    result_is_ok = ((root == root_expected) && result_is_ok);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << " serial: "                 << ms_serial << " ms"
+              << ", tree: "                  << ms_full   << " ms"
+              << ", cached leaves + patch: "  << ms_update << " ms"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace local
+
+#endif // APP_BENCHMARK_HASH_SHA256_THROUGHPUT
+
 int main()
 {
-  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH_SHA256 -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_hash.cpp -o ./ref_app/bin/app_benchmark_hash.exe
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH_SHA256 -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_HASH_SHA256_THROUGHPUT ./ref_app/src/app/benchmark/app_benchmark_hash_sha256.cpp -o ./ref_app/bin/app_benchmark_hash_sha256.exe
 
   auto result_is_ok = true;
 
@@ -66,6 +328,11 @@ int main()
     result_is_ok = (app::benchmark::run_hash_sha256() && result_is_ok);
   }
 
+  #if defined(APP_BENCHMARK_HASH_SHA256_THROUGHPUT)
+  result_is_ok = (local::hash_sha256_throughput() && result_is_ok);
+  result_is_ok = (local::hash_sha256_tree_incremental() && result_is_ok);
+  #endif
+
   return (result_is_ok ? 0 : -1);
 }
 #endif
@@ -260,6 +260,8 @@ auto app::benchmark::run_non_std_decimal() -> bool
 arithmetic_float_type xarg = static_cast<arithmetic_float_type>(1234) / 1000;
 arithmetic_float_type ctrl = static_cast<arithmetic_float_type>(UINT64_C(343494186080075997)) / UINT64_C(100000000000000000);
 
+APP_BENCHMARK_REGISTER(non_std_decimal)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
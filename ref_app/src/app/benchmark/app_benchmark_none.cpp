@@ -16,6 +16,8 @@ auto app::benchmark::run_none() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(none)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
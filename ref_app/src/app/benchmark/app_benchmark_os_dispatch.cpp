@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_DISPATCH))
+
+#include <util/utility/util_priority_bitmap.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace local
+{
+  // Model the ready-task search of the OS scheduler for a given task count.
+  // The linear search checks each task for an event or a timeout
+  // (as the scheduler did originally), whereas the bitmap search
+  // finds the lowest ready task index with count-trailing-zeros.
+
+  template<const std::size_t TaskCount>
+  class os_dispatch_model
+  {
+  public:
+    static constexpr auto task_count = TaskCount;
+
+    os_dispatch_model()
+    {
+      // Place every task's interval timer well into the future.
+      my_tick.fill(static_cast<std::uint32_t>(UINT32_C(1000)));
+    }
+
+    auto make_ready(const std::size_t index) -> void
+    {
+      my_event[index] = static_cast<std::uint16_t>(UINT8_C(1));
+
+      my_ready.set(index);
+    }
+
+    auto make_idle(const std::size_t index) -> void
+    {
+      my_event[index] = static_cast<std::uint16_t>(UINT8_C(0));
+
+      my_ready.reset(index);
+    }
+
+    auto find_linear(const std::uint32_t timepoint) const -> std::size_t
+    {
+      for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < task_count; ++index)
+      {
+        const auto task_does_have_timeout =
+          (static_cast<std::uint32_t>(timepoint - my_tick[index]) <= static_cast<std::uint32_t>(UINT32_C(0x7FFFFFFF)));
+
+        if((my_event[index] != static_cast<std::uint16_t>(UINT8_C(0))) || task_does_have_timeout)
+        {
+          return index;
+        }
+      }
+
+      return task_count;
+    }
+
+    auto find_bitmap() const -> std::size_t { return my_ready.find_first(); }
+
+  private:
+    std::array<std::uint16_t, task_count> my_event { };
+    std::array<std::uint32_t, task_count> my_tick  { };
+    util::priority_bitmap<task_count>     my_ready { };
+  };
+
+  template<const std::size_t TaskCount>
+  auto os_dispatch_verify() -> bool
+  {
+    using model_type = os_dispatch_model<TaskCount>;
+
+    model_type model { };
+
+    auto result_is_ok = (   (model.find_linear(static_cast<std::uint32_t>(UINT8_C(0))) == model_type::task_count)
+                         && (model.find_bitmap() == model_type::task_count));
+
+    // Make a single task ready at every position and verify that
+    // both searches find it. Then add a second, lower-priority task
+    // and verify that the higher-priority task still wins.
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < model_type::task_count; ++index)
+    {
+      model.make_ready(index);
+
+      const auto index_next = static_cast<std::size_t>(model_type::task_count - 1U);
+
+      if(index_next != index) { model.make_ready(index_next); }
+
+      result_is_ok = (   (model.find_linear(static_cast<std::uint32_t>(UINT8_C(0))) == index)
+                      && (model.find_bitmap() == index)
+                      && result_is_ok);
+
+      model.make_idle(index);
+      model.make_idle(index_next);
+    }
+
+    return result_is_ok;
+  }
+} // namespace local
+
+auto app::benchmark::run_os_dispatch() -> bool
+{
+  const auto result_is_ok = (   local::os_dispatch_verify<static_cast<std::size_t>(UINT16_C(  3))>()
+                             && local::os_dispatch_verify<static_cast<std::size_t>(UINT16_C( 32))>()
+                             && local::os_dispatch_verify<static_cast<std::size_t>(UINT16_C(256))>());
+
+  return result_is_ok;
+}
+
+APP_BENCHMARK_REGISTER(os_dispatch)
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace local
+{
+  template<const std::size_t TaskCount>
+  auto os_dispatch_report_latency() -> void
+  {
+    using model_type = os_dispatch_model<TaskCount>;
+
+    using clock_type = std::chrono::steady_clock;
+
+    constexpr auto dispatch_count = static_cast<std::uint32_t>(UINT32_C(1000000));
+
+    model_type model { };
+
+    // Only the lowest-priority task is ready. This is the
+    // worst case for the linear search in the scheduler.
+    model.make_ready(model_type::task_count - 1U);
+
+    volatile std::size_t sink { };
+
+    const auto start_linear = clock_type::now();
+
+    for(auto count = static_cast<std::uint32_t>(UINT8_C(0)); count < dispatch_count; ++count)
+    {
+      sink = model.find_linear(static_cast<std::uint32_t>(count & static_cast<std::uint32_t>(UINT8_C(0xFF))));
+    }
+
+    const auto stop_linear = clock_type::now();
+
+    const auto start_bitmap = clock_type::now();
+
+    for(auto count = static_cast<std::uint32_t>(UINT8_C(0)); count < dispatch_count; ++count)
+    {
+      sink = model.find_bitmap();
+    }
+
+    const auto stop_bitmap = clock_type::now();
+
+    static_cast<void>(sink);
+
+    const auto ns_linear = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_linear - start_linear).count()) / static_cast<double>(dispatch_count);
+    const auto ns_bitmap = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_bitmap - start_bitmap).count()) / static_cast<double>(dispatch_count);
+
+    std::cout << "tasks: "            << std::setw(3) << model_type::task_count
+              << ", linear [ns]: "    << std::fixed << std::setprecision(2) << ns_linear
+              << ", bitmap [ns]: "    << std::fixed << std::setprecision(2) << ns_bitmap
+              << std::endl;
+  }
+} // namespace local
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_DISPATCH -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_os_dispatch.cpp -o ./ref_app/bin/app_benchmark_os_dispatch.exe
+
+  const auto result_is_ok = app::benchmark::run_os_dispatch();
+
+  local::os_dispatch_report_latency<static_cast<std::size_t>(UINT16_C(  3))>();
+  local::os_dispatch_report_latency<static_cast<std::size_t>(UINT16_C( 32))>();
+  local::os_dispatch_report_latency<static_cast<std::size_t>(UINT16_C(256))>();
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
+
+#endif // APP_BENCHMARK_TYPE_OS_DISPATCH
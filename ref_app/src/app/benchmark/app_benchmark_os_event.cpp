@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EVENT))
+
+#include <os/os_atomic.h>
+#include <util/utility/util_priority_bitmap.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace local
+{
+  // Model the event handling of the OS scheduler for a given task count.
+  // Setting an event performs an atomic OR on the task's event and posts
+  // the task to the scheduler, which then merges the posted tasks into
+  // its own ready set. No interrupt lock is held for this when the
+  // atomic operations are lock-free.
+
+  template<const std::size_t TaskCount>
+  class os_event_model
+  {
+  public:
+    using event_type     = std::uint16_t;
+    using post_word_type = std::uint32_t;
+
+    static constexpr auto task_count = TaskCount;
+
+    static constexpr auto post_word_digits = static_cast<std::size_t>(std::numeric_limits<post_word_type>::digits);
+    static constexpr auto post_word_count  = static_cast<std::size_t>((task_count + (post_word_digits - 1U)) / post_word_digits);
+
+    auto set_event(const std::size_t index, const event_type event_to_set) -> void
+    {
+      static_cast<void>(os::detail::atomic_fetch_or(my_event[index], event_to_set));
+
+      static_cast<void>(os::detail::atomic_fetch_or(my_posted[index / post_word_digits], post_mask(index)));
+    }
+
+    auto post_event_batch(const std::size_t* first, const std::size_t* last, const event_type event_to_set) -> void
+    {
+      std::array<post_word_type, post_word_count> posted { };
+
+      for(auto it = first; it != last; ++it) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        static_cast<void>(os::detail::atomic_fetch_or(my_event[*it], event_to_set));
+
+        posted[*it / post_word_digits] = static_cast<post_word_type>(posted[*it / post_word_digits] | post_mask(*it));
+      }
+
+      for(auto word_index = static_cast<std::size_t>(UINT8_C(0)); word_index < post_word_count; ++word_index)
+      {
+        if(posted[word_index] != static_cast<post_word_type>(UINT8_C(0)))
+        {
+          static_cast<void>(os::detail::atomic_fetch_or(my_posted[word_index], posted[word_index]));
+        }
+      }
+    }
+
+    // Merge the posted tasks into the ready set, as the scheduler does.
+    auto merge() -> void
+    {
+      for(auto word_index = static_cast<std::size_t>(UINT8_C(0)); word_index < post_word_count; ++word_index)
+      {
+        auto posted = os::detail::atomic_exchange(my_posted[word_index], static_cast<post_word_type>(UINT8_C(0)));
+
+        while(posted != static_cast<post_word_type>(UINT8_C(0)))
+        {
+          my_ready.set((word_index * post_word_digits) + util::detail::priority_bitmap_ctz(posted));
+
+          posted = static_cast<post_word_type>(posted & static_cast<post_word_type>(posted - 1U));
+        }
+      }
+    }
+
+    // Run the highest-priority ready task, which consumes all of its events.
+    // Return the index of the task, or task_count if no task is ready.
+    auto run_next(event_type& event_consumed) -> std::size_t
+    {
+      merge();
+
+      const auto index = my_ready.find_first();
+
+      if(index < task_count)
+      {
+        event_consumed = os::detail::atomic_exchange(my_event[index], static_cast<event_type>(UINT8_C(0)));
+
+        if(os::detail::atomic_load(my_event[index]) == static_cast<event_type>(UINT8_C(0)))
+        {
+          my_ready.reset(index);
+        }
+      }
+
+      return index;
+    }
+
+    auto has_event() const -> bool
+    {
+      auto result_has_event = false;
+
+      for(const auto& event : my_event)
+      {
+        result_has_event = ((os::detail::atomic_load(event) != static_cast<event_type>(UINT8_C(0))) || result_has_event);
+      }
+
+      return result_has_event;
+    }
+
+  private:
+    std::array<event_type, task_count>          my_event  { };
+    std::array<post_word_type, post_word_count> my_posted { };
+    util::priority_bitmap<task_count>           my_ready  { };
+
+    static auto post_mask(const std::size_t index) -> post_word_type
+    {
+      return static_cast<post_word_type>(static_cast<post_word_type>(UINT8_C(1)) << static_cast<unsigned>(index % post_word_digits));
+    }
+  };
+
+  template<const std::size_t TaskCount>
+  auto os_event_verify() -> bool
+  {
+    using model_type = os_event_model<TaskCount>;
+
+    using event_type = typename model_type::event_type;
+
+    model_type model { };
+
+    auto event_consumed = event_type { };
+
+    auto result_is_ok = (model.run_next(event_consumed) == model_type::task_count);
+
+    // Post two events to the last task and one to the first.
+    // The first task runs first, and each task runs once.
+    model.set_event(model_type::task_count - 1U, static_cast<event_type>(UINT8_C(1)));
+    model.set_event(model_type::task_count - 1U, static_cast<event_type>(UINT8_C(4)));
+    model.set_event(static_cast<std::size_t>(UINT8_C(0)), static_cast<event_type>(UINT8_C(2)));
+
+    result_is_ok = ((model.run_next(event_consumed) == static_cast<std::size_t>(UINT8_C(0))) && (event_consumed == static_cast<event_type>(UINT8_C(2))) && result_is_ok);
+    result_is_ok = ((model.run_next(event_consumed) == (model_type::task_count - 1U))        && (event_consumed == static_cast<event_type>(UINT8_C(5))) && result_is_ok);
+    result_is_ok = ((model.run_next(event_consumed) == model_type::task_count) && result_is_ok);
+
+    // Post one event to every other task in one batch.
+    std::array<std::size_t, static_cast<std::size_t>((TaskCount + 1U) / 2U)> batch { };
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < batch.size(); ++index)
+    {
+      batch[index] = static_cast<std::size_t>(index * 2U);
+    }
+
+    model.post_event_batch(batch.data(), batch.data() + batch.size(), static_cast<event_type>(UINT8_C(8))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(const auto& index : batch)
+    {
+      result_is_ok = ((model.run_next(event_consumed) == index) && (event_consumed == static_cast<event_type>(UINT8_C(8))) && result_is_ok);
+    }
+
+    result_is_ok = ((model.run_next(event_consumed) == model_type::task_count) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace local
+
+auto app::benchmark::run_os_event() -> bool
+{
+  const auto result_is_ok = (   local::os_event_verify<static_cast<std::size_t>(UINT16_C(  3))>()
+                             && local::os_event_verify<static_cast<std::size_t>(UINT16_C( 32))>()
+                             && local::os_event_verify<static_cast<std::size_t>(UINT16_C(100))>());
+
+  return result_is_ok;
+}
+
+APP_BENCHMARK_REGISTER(os_event)
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#include <os/os.h>
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// The real scheduler is linked into the standalone benchmark.
+// Its tasks are never started, so they are empty here.
+auto sys::idle::task_init() noexcept -> void { }
+auto sys::idle::task_func() -> void { }
+auto app::led::task_init() -> void { }
+auto app::led::task_func() -> void { }
+auto app::benchmark::task_init() -> void { }
+auto app::benchmark::task_func() -> void { }
+auto sys::mon::task_init() -> void { }
+auto sys::mon::task_func() -> void { }
+
+namespace local
+{
+  using clock_type = std::chrono::steady_clock;
+
+  // Several threads (in place of interrupts) set events while the
+  // scheduler runs the ready tasks. Every event that is set must
+  // eventually be consumed, i.e., no post is lost.
+  auto os_event_verify_concurrent() -> bool
+  {
+    using model_type = os_event_model<static_cast<std::size_t>(UINT8_C(40))>;
+
+    using event_type = model_type::event_type;
+
+    constexpr auto poster_count = static_cast<unsigned>(UINT8_C(3));
+    constexpr auto post_count   = static_cast<std::uint32_t>(UINT32_C(200000));
+
+    model_type model { };
+
+    std::atomic<unsigned> posters_done { };
+
+    std::array<std::uint32_t, poster_count> consumed_count { };
+
+    std::array<std::thread, poster_count> posters { };
+
+    for(auto poster = static_cast<unsigned>(UINT8_C(0)); poster < poster_count; ++poster)
+    {
+      posters[poster] =
+        std::thread
+        {
+          [&model, &posters_done, poster]()
+          {
+            for(auto count = static_cast<std::uint32_t>(UINT8_C(0)); count < post_count; ++count)
+            {
+              model.set_event(static_cast<std::size_t>((count * 7U) % model_type::task_count), static_cast<event_type>(1U << poster));
+            }
+
+            ++posters_done;
+          }
+        };
+    }
+
+    auto all_posters_done = false;
+
+    for(;;)
+    {
+      auto event_consumed = event_type { };
+
+      if(model.run_next(event_consumed) < model_type::task_count)
+      {
+        for(auto poster = static_cast<unsigned>(UINT8_C(0)); poster < poster_count; ++poster)
+        {
+          if((event_consumed & static_cast<event_type>(1U << poster)) != static_cast<event_type>(UINT8_C(0)))
+          {
+            ++consumed_count[poster];
+          }
+        }
+      }
+      else if(all_posters_done)
+      {
+        break;
+      }
+      else
+      {
+        // Check for completion only when nothing is ready, and then
+        // run once more to pick up the posts that raced the check.
+        all_posters_done = (posters_done.load() == poster_count);
+      }
+    }
+
+    for(auto& poster : posters) { poster.join(); }
+
+    // Each poster must have had at least one of its events consumed.
+    // No event may be left behind at the end, which would be the case
+    // for an event whose post to the scheduler had been lost.
+    auto result_is_ok = true;
+
+    for(const auto& count : consumed_count)
+    {
+      result_is_ok = ((count != static_cast<std::uint32_t>(UINT8_C(0))) && result_is_ok);
+    }
+
+    auto event_consumed = event_type { };
+
+    return ((model.run_next(event_consumed) == model_type::task_count) && (!model.has_event()) && result_is_ok);
+  }
+
+  // Report the time per call of the real os::set_event() and
+  // os::post_event_from_isr() of the scheduler, including the wakeup
+  // of the idle task. On the host, mcal::irq::disable_all() is empty,
+  // so an interrupt-lock hold time can only be measured on a target.
+  auto os_event_report_set_event_time() -> void
+  {
+    constexpr auto set_count = static_cast<std::uint32_t>(UINT32_C(10000000));
+
+    constexpr auto task_count = static_cast<std::uint32_t>(os::task_id_type::task_id_end);
+
+    const auto start_set = clock_type::now();
+
+    for(auto count = static_cast<std::uint32_t>(UINT8_C(0)); count < set_count; ++count)
+    {
+      static_cast<void>(os::set_event(static_cast<os::task_id_type>(count % task_count), static_cast<os::event_type>(UINT8_C(1))));
+    }
+
+    const auto stop_set = clock_type::now();
+
+    const std::array<os::task_id_type, static_cast<std::size_t>(task_count)> task_ids =
+    {{
+      os::task_id_type::task_id_app_led,
+      os::task_id_type::task_id_app_benchmark,
+      os::task_id_type::task_id_sys_mon
+    }};
+
+    const auto start_post = clock_type::now();
+
+    for(auto count = static_cast<std::uint32_t>(UINT8_C(0)); count < static_cast<std::uint32_t>(set_count / task_count); ++count)
+    {
+      static_cast<void>(os::post_event_from_isr(task_ids.data(), task_ids.data() + task_ids.size(), static_cast<os::event_type>(UINT8_C(2)))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    const auto stop_post = clock_type::now();
+
+    const auto ns_set  = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_set  - start_set ).count()) / static_cast<double>(set_count);
+    const auto ns_post = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_post - start_post).count()) / static_cast<double>(set_count);
+
+    std::cout << "os::set_event           [ns per event]: " << std::fixed << std::setprecision(2) << ns_set  << std::endl;
+    std::cout << "os::post_event_from_isr [ns per event]: " << std::fixed << std::setprecision(2) << ns_post << std::endl;
+  }
+} // namespace local
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -pthread -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_EVENT -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_os_event.cpp ./ref_app/src/os/os.cpp ./ref_app/src/mcal/host/mcal_cpu.cpp ./ref_app/src/mcal/host/mcal_gpt.cpp -o ./ref_app/bin/app_benchmark_os_event.exe
+
+  const auto result_is_ok = (app::benchmark::run_os_event() && local::os_event_verify_concurrent());
+
+  local::os_event_report_set_event_time();
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
+
+#endif // APP_BENCHMARK_TYPE_OS_EVENT
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_EXECUTOR))
+
+// This benchmark exercises the multi-threaded executor of the
+// operating system task model. It is intended for the host only.
+
+#include <os/os_executor.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace local
+{
+  constexpr auto os_executor_task_count = static_cast<std::size_t>(UINT8_C(64));
+
+  using os_executor_type = os::executor<os_executor_task_count>;
+
+  os_executor_type* os_executor_ptr { nullptr };
+
+  std::atomic<std::uint32_t> os_executor_dispatch_count    { };
+  std::atomic<std::uint32_t> os_executor_dispatch_total    { };
+  std::atomic<bool>          os_executor_concurrency_error { };
+  std::atomic<std::uint32_t> os_executor_work_result       { };
+
+  std::array<std::atomic_flag, os_executor_task_count> os_executor_task_is_running { };
+
+  auto os_executor_task_init() -> void { }
+
+  // Each event-triggered task performs a small amount of work
+  // and then passes an event on to the next task.
+  template<const std::size_t TaskIndex>
+  auto os_executor_task_func() -> void
+  {
+    if(os_executor_task_is_running[TaskIndex].test_and_set())
+    {
+      os_executor_concurrency_error.store(true);
+    }
+
+    os_executor_ptr->clear_event(static_cast<os::event_type>(UINT8_C(1)));
+
+    auto x = static_cast<std::uint32_t>(TaskIndex + 1U);
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT16_C(2000)); ++i)
+    {
+      x ^= static_cast<std::uint32_t>(x << 13U); x ^= static_cast<std::uint32_t>(x >> 17U); x ^= static_cast<std::uint32_t>(x << 5U);
+    }
+
+    os_executor_work_result.store(x, std::memory_order_relaxed);
+
+    os_executor_task_is_running[TaskIndex].clear();
+
+    if(++os_executor_dispatch_count <= os_executor_dispatch_total.load())
+    {
+      os_executor_ptr->set_event((TaskIndex + 1U) % os_executor_task_count, static_cast<os::event_type>(UINT8_C(1)));
+    }
+  }
+
+  template<std::size_t... TaskIndices>
+  auto os_executor_make_task_list(std::index_sequence<TaskIndices...>) -> typename os_executor_type::task_list_type
+  {
+    return
+    {{
+      os::task_control_block(os_executor_task_init,
+                             os_executor_task_func<TaskIndices>,
+                             static_cast<os::tick_type>(UINT8_C(0)),
+                             static_cast<os::tick_type>(UINT8_C(0)))...
+    }};
+  }
+
+  // Dispatch the given number of events with the given number of worker threads.
+  auto os_executor_dispatch(const std::size_t worker_count, const std::uint32_t dispatch_total) -> bool
+  {
+    static const auto task_list = os_executor_make_task_list(std::make_index_sequence<os_executor_task_count> { });
+
+    os_executor_type executor(task_list, worker_count);
+
+    os_executor_ptr = &executor;
+
+    os_executor_dispatch_count.store(static_cast<std::uint32_t>(UINT8_C(0)));
+    os_executor_dispatch_total.store(dispatch_total);
+    os_executor_concurrency_error.store(false);
+
+    executor.start();
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < os_executor_task_count; index += 2U)
+    {
+      executor.set_event(index, static_cast<os::event_type>(UINT8_C(1)));
+    }
+
+    while(os_executor_dispatch_count.load() < dispatch_total)
+    {
+      std::this_thread::yield();
+    }
+
+    executor.stop();
+
+    os_executor_ptr = nullptr;
+
+    return (!os_executor_concurrency_error.load());
+  }
+} // namespace local
+
+auto app::benchmark::run_os_executor() -> bool
+{
+  const auto result_is_ok = local::os_executor_dispatch(static_cast<std::size_t>(UINT8_C(2)),
+                                                        static_cast<std::uint32_t>(UINT16_C(10000)));
+
+  return result_is_ok;
+}
+
+APP_BENCHMARK_REGISTER(os_executor)
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#include <algorithm>
+#include <iostream>
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -pthread -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_EXECUTOR -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_os_executor.cpp ./ref_app/src/mcal/host/mcal_gpt.cpp -o ./ref_app/bin/app_benchmark_os_executor.exe
+
+  auto result_is_ok = app::benchmark::run_os_executor();
+
+  const auto worker_count_max =
+    (std::max)(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(UINT8_C(1)));
+
+  constexpr auto dispatch_total = static_cast<std::uint32_t>(UINT32_C(200000));
+
+  for(auto worker_count = static_cast<std::size_t>(UINT8_C(1)); worker_count <= (std::min)(worker_count_max, static_cast<std::size_t>(UINT8_C(16))); worker_count *= 2U)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    result_is_ok = (local::os_executor_dispatch(worker_count, dispatch_total) && result_is_ok);
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "workers: "          << worker_count
+              << ", events per sec: " << static_cast<std::uint32_t>(static_cast<double>(dispatch_total) / elapsed)
+              << std::endl;
+  }
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
+
+#endif // APP_BENCHMARK_TYPE_OS_EXECUTOR
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <app/benchmark/app_benchmark.h>
+
+#if (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_OS_IDLE_SLEEP))
+
+// This benchmark exercises the tickless idle of the multitasking
+// scheduler. It requires a target supporting MCAL_CPU_HAS_IDLE_SLEEP,
+// which is presently the host.
+
+#include <mcal_cpu.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace local
+{
+  using clock_type = std::chrono::steady_clock;
+
+  auto os_idle_sleep_elapsed_microseconds(const std::uint32_t timeout_microseconds) -> std::uint32_t
+  {
+    const auto start = clock_type::now();
+
+    mcal::cpu::idle_sleep(timeout_microseconds);
+
+    return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count());
+  }
+} // namespace local
+
+auto app::benchmark::run_os_idle_sleep() -> bool
+{
+  // A sleep must last at least as long as its timeout.
+  const auto elapsed_timeout = local::os_idle_sleep_elapsed_microseconds(static_cast<std::uint32_t>(UINT16_C(1000)));
+
+  // A wakeup that is signaled before the sleep must not be lost.
+  mcal::cpu::idle_wakeup();
+
+  const auto elapsed_wakeup = local::os_idle_sleep_elapsed_microseconds(static_cast<std::uint32_t>(UINT32_C(50000)));
+
+  const auto result_is_ok = (   (elapsed_timeout >= static_cast<std::uint32_t>(UINT16_C(1000)))
+                             && (elapsed_wakeup  <  static_cast<std::uint32_t>(UINT32_C(50000))));
+
+  return result_is_ok;
+}
+
+APP_BENCHMARK_REGISTER(os_idle_sleep)
+
+#if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+namespace local
+{
+  auto os_idle_sleep_report_wakeup_latency() -> void
+  {
+    constexpr auto sample_count = static_cast<std::size_t>(UINT8_C(64));
+
+    std::array<std::uint32_t, sample_count> latency_microseconds { };
+
+    for(auto& latency : latency_microseconds)
+    {
+      clock_type::time_point time_of_wakeup { };
+
+      // Signal a wakeup from a second thread (in place of an interrupt)
+      // while the idle task sleeps with a long timeout.
+      std::thread waker
+      {
+        [&time_of_wakeup]()
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<unsigned>(UINT8_C(2))));
+
+          time_of_wakeup = clock_type::now();
+
+          mcal::cpu::idle_wakeup();
+        }
+      };
+
+      mcal::cpu::idle_sleep(static_cast<std::uint32_t>(UINT32_C(100000)));
+
+      const auto time_of_resume = clock_type::now();
+
+      waker.join();
+
+      latency = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(time_of_resume - time_of_wakeup).count());
+    }
+
+    std::sort(latency_microseconds.begin(), latency_microseconds.end());
+
+    std::cout << "wakeup latency [us], median: " << latency_microseconds[sample_count / 2U]
+              << ", max: "                       << latency_microseconds.back()
+              << std::endl;
+  }
+
+  template<typename IdleFunctionType>
+  auto os_idle_sleep_report_cpu_usage(const char* name, IdleFunctionType idle_function) -> void
+  {
+    // Idle for a total of 200ms with a task deadline every 4ms,
+    // as in the LED task of the reference application.
+    constexpr auto idle_total    = std::chrono::milliseconds(static_cast<unsigned>(UINT8_C(200)));
+    constexpr auto idle_deadline = std::chrono::microseconds(static_cast<unsigned>(UINT16_C(4000)));
+
+    auto clock_calls = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto cpu_start  = std::clock();
+    const auto wall_start = clock_type::now();
+
+    for(auto deadline = wall_start + idle_deadline; deadline <= (wall_start + idle_total); deadline += idle_deadline)
+    {
+      idle_function(deadline, clock_calls);
+    }
+
+    const auto wall_elapsed = std::chrono::duration<double>(clock_type::now() - wall_start).count();
+    const auto cpu_elapsed  = static_cast<double>(std::clock() - cpu_start) / static_cast<double>(CLOCKS_PER_SEC);
+
+    std::cout << name
+              << " CPU usage [%]: " << ((100.0 * cpu_elapsed) / wall_elapsed)
+              << ", clock calls: "  << clock_calls
+              << std::endl;
+  }
+} // namespace local
+
+int main()
+{
+  // g++ -Wall -O3 -march=native -pthread -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_IDLE_SLEEP -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_os_idle_sleep.cpp ./ref_app/src/mcal/host/mcal_cpu.cpp -o ./ref_app/bin/app_benchmark_os_idle_sleep.exe
+
+  const auto result_is_ok = app::benchmark::run_os_idle_sleep();
+
+  local::os_idle_sleep_report_wakeup_latency();
+
+  // The polling idle re-reads the clock until the deadline.
+  local::os_idle_sleep_report_cpu_usage
+  (
+    "polling idle ",
+    [](const local::clock_type::time_point& deadline, std::uint32_t& clock_calls)
+    {
+      while(local::clock_type::now() < deadline) { ++clock_calls; }
+
+      ++clock_calls;
+    }
+  );
+
+  // The tickless idle sleeps until the deadline.
+  local::os_idle_sleep_report_cpu_usage
+  (
+    "tickless idle",
+    [](const local::clock_type::time_point& deadline, std::uint32_t& clock_calls)
+    {
+      for(auto now = local::clock_type::now(); now < deadline; now = local::clock_type::now())
+      {
+        ++clock_calls;
+
+        mcal::cpu::idle_sleep(static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count()));
+      }
+
+      ++clock_calls;
+    }
+  );
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
+
+#endif // APP_BENCHMARK_TYPE_OS_IDLE_SLEEP
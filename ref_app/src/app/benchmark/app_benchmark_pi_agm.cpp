@@ -136,6 +136,8 @@ auto app::benchmark::run_pi_agm() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(pi_agm)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
@@ -75,6 +75,8 @@ auto app::benchmark::run_pi_spigot() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(pi_spigot)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
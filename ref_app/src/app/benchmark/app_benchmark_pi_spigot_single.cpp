@@ -66,6 +66,8 @@ auto app::benchmark::run_pi_spigot_single() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(pi_spigot_single)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
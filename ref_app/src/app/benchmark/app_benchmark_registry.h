@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef APP_BENCHMARK_REGISTRY_2026_10_17_H
+  #define APP_BENCHMARK_REGISTRY_2026_10_17_H
+
+  // A registry of the benchmarks, which is used by the unified benchmark
+  // runner on the host. Each benchmark registers its run-function with
+  // APP_BENCHMARK_REGISTER. This registration is active only when
+  // APP_BENCHMARK_REGISTRY is defined, so that the targets do not carry
+  // the static constructors of the registry entries.
+
+  namespace app { namespace benchmark {
+
+  class registry_entry final
+  {
+  public:
+    using function_type = bool(*)();
+
+    registry_entry(const char* name, const function_type func) noexcept
+      : my_name(name),
+        my_func(func),
+        my_next(head())
+    {
+      head() = this;
+    }
+
+    registry_entry() = delete;
+    registry_entry(const registry_entry&) = delete;
+    registry_entry(registry_entry&&) = delete;
+
+    ~registry_entry() = default;
+
+    auto operator=(const registry_entry&) -> registry_entry& = delete;
+    auto operator=(registry_entry&&) -> registry_entry& = delete;
+
+    static auto first() noexcept -> const registry_entry* { return head(); }
+
+    auto next() const noexcept -> const registry_entry* { return my_next; }
+    auto name() const noexcept -> const char*           { return my_name; }
+
+    auto run() const -> bool { return my_func(); }
+
+  private:
+    const char*           my_name;
+    const function_type   my_func;
+    const registry_entry* my_next;
+
+    static auto head() noexcept -> const registry_entry*&
+    {
+      static const registry_entry* my_head { nullptr };
+
+      return my_head;
+    }
+  };
+
+  } // namespace benchmark
+  } // namespace app
+
+  #if defined(APP_BENCHMARK_REGISTRY)
+  #define APP_BENCHMARK_REGISTER(name) namespace { const app::benchmark::registry_entry app_benchmark_registry_entry_##name(#name, &app::benchmark::run_##name); } // NOLINT(cert-err58-cpp,fuchsia-statically-constructed-objects)
+  #else
+  #define APP_BENCHMARK_REGISTER(name)
+  #endif
+
+#endif // APP_BENCHMARK_REGISTRY_2026_10_17_H
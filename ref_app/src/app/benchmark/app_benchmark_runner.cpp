@@ -0,0 +1,558 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// The unified benchmark runner for the host. Each benchmark is compiled
+// with its own APP_BENCHMARK_TYPE and with APP_BENCHMARK_REGISTRY, and
+// all of them are linked together with this runner into one binary.
+// See also ./target/build/test_app_benchmark_runner.sh.
+
+// The runner can save its results to a baseline file and compare
+// later runs against it. A benchmark is flagged as a regression
+// when the 95% confidence interval of the change of its mean time
+// lies entirely above the given threshold.
+
+#if defined(APP_BENCHMARK_REGISTRY)
+
+#include <app/benchmark/app_benchmark_registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace local
+{
+  struct runner_options
+  {
+    std::vector<std::string> filter           { };
+    unsigned                 warmup           { static_cast<unsigned>(UINT8_C(1)) };
+    unsigned                 repetitions      { static_cast<unsigned>(UINT8_C(10)) };
+    std::string              format           { "text" };
+    bool                     list_only        { false };
+    std::string              baseline_save    { };
+    std::string              baseline_compare { };
+    double                   threshold        { 5.0 };
+  };
+
+  struct runner_statistics
+  {
+    unsigned repetitions  { };
+    double   ns_mean      { };
+    double   ns_stddev    { };
+    double   ns_median    { };
+    double   instructions { -1.0 };
+  };
+
+  struct runner_result
+  {
+    std::string       name         { };
+    bool              result_is_ok { };
+    runner_statistics stats        { };
+    double            ns_min       { };
+    double            ns_p99       { };
+    double            ops_per_sec  { };
+
+    // The comparison with the baseline, in percent of the baseline mean.
+    bool              has_baseline { };
+    double            change       { };
+    double            change_low   { };
+    double            change_high  { };
+    const char*       verdict      { "" };
+  };
+
+  // Count the instructions retired in user space with perf_event_open.
+  // This is available on Linux only, and only if the kernel permits it.
+  // Otherwise the instruction count is reported as -1.
+  class runner_instruction_counter final
+  {
+  public:
+    runner_instruction_counter()
+    {
+      #if defined(__linux__)
+      perf_event_attr attr { };
+
+      attr.type           = static_cast<std::uint32_t>(PERF_TYPE_HARDWARE);
+      attr.size           = static_cast<std::uint32_t>(sizeof(perf_event_attr));
+      attr.config         = static_cast<std::uint64_t>(PERF_COUNT_HW_INSTRUCTIONS);
+      attr.disabled       = 1U;
+      attr.exclude_kernel = 1U;
+      attr.exclude_hv     = 1U;
+
+      my_fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL)); // NOLINT(cppcoreguidelines-pro-type-vararg)
+      #endif
+    }
+
+    runner_instruction_counter(const runner_instruction_counter&) = delete;
+    runner_instruction_counter(runner_instruction_counter&&) = delete;
+
+    ~runner_instruction_counter()
+    {
+      #if defined(__linux__)
+      if(is_available()) { static_cast<void>(::close(my_fd)); }
+      #endif
+    }
+
+    auto operator=(const runner_instruction_counter&) -> runner_instruction_counter& = delete;
+    auto operator=(runner_instruction_counter&&) -> runner_instruction_counter& = delete;
+
+    auto is_available() const noexcept -> bool { return (my_fd >= 0); }
+
+    auto start() const -> void
+    {
+      #if defined(__linux__)
+      if(is_available())
+      {
+        static_cast<void>(::ioctl(my_fd, PERF_EVENT_IOC_RESET, 0));  // NOLINT(cppcoreguidelines-pro-type-vararg)
+        static_cast<void>(::ioctl(my_fd, PERF_EVENT_IOC_ENABLE, 0)); // NOLINT(cppcoreguidelines-pro-type-vararg)
+      }
+      #endif
+    }
+
+    auto stop() const -> std::uint64_t
+    {
+      std::uint64_t count { };
+
+      #if defined(__linux__)
+      if(is_available())
+      {
+        static_cast<void>(::ioctl(my_fd, PERF_EVENT_IOC_DISABLE, 0)); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        if(::read(my_fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+        {
+          count = static_cast<std::uint64_t>(UINT8_C(0));
+        }
+      }
+      #endif
+
+      return count;
+    }
+
+  private:
+    int my_fd { -1 };
+  };
+
+  auto runner_parse(const int argc, char** argv, runner_options& options) -> bool
+  {
+    for(auto i = 1; i < argc; ++i)
+    {
+      const std::string arg { argv[i] }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto pos_eq = arg.find('=');
+
+      const std::string key   { arg.substr(static_cast<std::size_t>(UINT8_C(0)), pos_eq) };
+      const std::string value { (pos_eq != std::string::npos) ? arg.substr(pos_eq + 1U) : std::string { } };
+
+      if(key == "--filter")
+      {
+        // A comma-separated list of name substrings.
+        for(std::size_t first = static_cast<std::size_t>(UINT8_C(0)); first <= value.length(); )
+        {
+          const auto last = (std::min)(value.find(',', first), value.length());
+
+          if(last > first) { options.filter.push_back(value.substr(first, last - first)); }
+
+          first = last + 1U;
+        }
+      }
+      else if(key == "--warmup")           { options.warmup           = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10)); }
+      else if(key == "--repetitions")      { options.repetitions      = (std::max)(static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10)), static_cast<unsigned>(UINT8_C(2))); }
+      else if(key == "--format")           { options.format           = value; }
+      else if(key == "--list")             { options.list_only        = true; }
+      else if(key == "--baseline-save")    { options.baseline_save    = value; }
+      else if(key == "--baseline-compare") { options.baseline_compare = value; }
+      else if(key == "--threshold")        { options.threshold        = std::strtod(value.c_str(), nullptr); }
+      else
+      {
+        std::cerr << "usage: " << argv[0] // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  << " [--filter=name[,name...]] [--warmup=n] [--repetitions=n] [--format=text|json|csv] [--list]"
+                  << " [--baseline-save=file] [--baseline-compare=file] [--threshold=percent]"
+                  << std::endl;
+
+        return false;
+      }
+    }
+
+    return ((options.format == "text") || (options.format == "json") || (options.format == "csv"));
+  }
+
+  auto runner_is_selected(const runner_options& options, const std::string& name) -> bool
+  {
+    return (   options.filter.empty()
+            || std::any_of(options.filter.cbegin(),
+                           options.filter.cend(),
+                           [&name](const std::string& str) { return (name.find(str) != std::string::npos); }));
+  }
+
+  auto runner_run(const app::benchmark::registry_entry& entry,
+                  const runner_options& options,
+                  const runner_instruction_counter& counter) -> runner_result
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    runner_result result { entry.name(), true };
+
+    for(auto count = static_cast<unsigned>(UINT8_C(0)); count < options.warmup; ++count)
+    {
+      result.result_is_ok = (entry.run() && result.result_is_ok);
+    }
+
+    std::vector<double> ns(static_cast<std::size_t>(options.repetitions));
+
+    double instructions_sum { };
+
+    for(auto& ns_run : ns)
+    {
+      counter.start();
+
+      const auto start = clock_type::now();
+
+      result.result_is_ok = (entry.run() && result.result_is_ok);
+
+      const auto stop = clock_type::now();
+
+      instructions_sum += static_cast<double>(counter.stop());
+
+      ns_run = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+    }
+
+    const auto ns_count = static_cast<double>(ns.size());
+
+    double ns_sum { };
+
+    for(const auto& ns_run : ns) { ns_sum += ns_run; }
+
+    result.stats.repetitions = options.repetitions;
+    result.stats.ns_mean     = ns_sum / ns_count;
+
+    double ns_sum_of_squares { };
+
+    for(const auto& ns_run : ns)
+    {
+      ns_sum_of_squares += ((ns_run - result.stats.ns_mean) * (ns_run - result.stats.ns_mean));
+    }
+
+    result.stats.ns_stddev    = std::sqrt(ns_sum_of_squares / (ns_count - 1.0));
+    result.stats.instructions = (counter.is_available() ? (instructions_sum / ns_count) : -1.0);
+
+    std::sort(ns.begin(), ns.end());
+
+    // Use the nearest-rank method for the median and the 99th percentile.
+    const auto rank = [&ns](const unsigned percent) -> double
+    {
+      const auto index = static_cast<std::size_t>(((ns.size() * percent) + 99U) / 100U);
+
+      return ns[(index != static_cast<std::size_t>(UINT8_C(0))) ? (index - 1U) : index];
+    };
+
+    result.ns_min          = ns.front();
+    result.stats.ns_median = rank(static_cast<unsigned>(UINT8_C(50)));
+    result.ns_p99          = rank(static_cast<unsigned>(UINT8_C(99)));
+    result.ops_per_sec     = ((result.stats.ns_median > 0.0) ? (1.0E9 / result.stats.ns_median) : 0.0);
+
+    return result;
+  }
+
+  // The baseline file is a versioned text file. The first line is the
+  // header with the version, followed by one line per benchmark:
+  // name repetitions ns_mean ns_stddev ns_median instructions
+  constexpr char     runner_baseline_header[] = "app_benchmark_runner_baseline"; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+  constexpr unsigned runner_baseline_version  = static_cast<unsigned>(UINT8_C(1));
+
+  auto runner_baseline_save(const std::string& filename, const std::vector<runner_result>& results) -> bool
+  {
+    std::ofstream out(filename);
+
+    out << runner_baseline_header << ' ' << runner_baseline_version << '\n'
+        << std::setprecision(17);
+
+    for(const auto& result : results)
+    {
+      out << result.name               << ' '
+          << result.stats.repetitions  << ' '
+          << result.stats.ns_mean      << ' '
+          << result.stats.ns_stddev    << ' '
+          << result.stats.ns_median    << ' '
+          << result.stats.instructions << '\n';
+    }
+
+    return static_cast<bool>(out);
+  }
+
+  auto runner_baseline_load(const std::string& filename, std::map<std::string, runner_statistics>& baseline) -> bool
+  {
+    std::ifstream in(filename);
+
+    std::string header  { };
+    unsigned    version { };
+
+    if(   (!(in >> header >> version))
+       || (header  != runner_baseline_header)
+       || (version != runner_baseline_version))
+    {
+      std::cerr << "baseline file " << filename << " is missing or has an unsupported version" << std::endl;
+
+      return false;
+    }
+
+    std::string line { };
+
+    while(std::getline(in, line))
+    {
+      std::istringstream line_in(line);
+
+      std::string       name  { };
+      runner_statistics stats { };
+
+      if(     (line_in >> name >> stats.repetitions >> stats.ns_mean >> stats.ns_stddev >> stats.ns_median >> stats.instructions)
+         &&   (stats.repetitions > static_cast<unsigned>(UINT8_C(1))))
+      {
+        baseline[name] = stats;
+      }
+    }
+
+    return true;
+  }
+
+  // The two-sided 95% quantile of Student's t-distribution
+  // for the given degrees of freedom (Cornish-Fisher expansion).
+  auto runner_t_quantile_95(const double df) -> double
+  {
+    constexpr auto z  = 1.959963984540054;
+    constexpr auto z3 = (z * z) * z;
+    constexpr auto z5 = (z3 * z) * z;
+
+    return z + ((z3 + z) / (4.0 * df)) + ((((5.0 * z5) + (16.0 * z3)) + (3.0 * z)) / ((96.0 * df) * df));
+  }
+
+  // Compare the mean time with the baseline using the Welch confidence
+  // interval for the difference of the two means. The verdict is only
+  // a regression (or an improvement) if the entire interval lies beyond
+  // the threshold, so that noise alone does not trigger it.
+  auto runner_compare(runner_result& result, const runner_statistics& baseline, const double threshold) -> void
+  {
+    const auto& stats = result.stats;
+
+    const auto var_m = ((stats.ns_stddev    * stats.ns_stddev)    / static_cast<double>(stats.repetitions));
+    const auto var_b = ((baseline.ns_stddev * baseline.ns_stddev) / static_cast<double>(baseline.repetitions));
+
+    // Get the Welch-Satterthwaite degrees of freedom.
+    const auto df_denominator =   ((var_m * var_m) / static_cast<double>(stats.repetitions    - 1U))
+                                + ((var_b * var_b) / static_cast<double>(baseline.repetitions - 1U));
+
+    const auto df = ((df_denominator > 0.0) ? (((var_m + var_b) * (var_m + var_b)) / df_denominator) : 1.0E6);
+
+    const auto half_width = runner_t_quantile_95((std::max)(df, 1.0)) * std::sqrt(var_m + var_b);
+
+    const auto diff = stats.ns_mean - baseline.ns_mean;
+
+    const auto to_percent = ((baseline.ns_mean > 0.0) ? (100.0 / baseline.ns_mean) : 0.0);
+
+    result.has_baseline = true;
+    result.change       = diff * to_percent;
+    result.change_low   = (diff - half_width) * to_percent;
+    result.change_high  = (diff + half_width) * to_percent;
+
+    if     (result.change_low  >  threshold) { result.verdict = "REGRESSION"; }
+    else if(result.change_high < -threshold) { result.verdict = "improvement"; }
+    else                                     { result.verdict = "unchanged"; }
+  }
+
+  auto runner_print(const std::vector<runner_result>& results, const runner_options& options) -> void
+  {
+    std::cout << std::fixed << std::setprecision(0);
+
+    const auto has_compare = (!options.baseline_compare.empty());
+
+    if(options.format == "json")
+    {
+      std::cout << "{\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.repetitions << ",\n  \"benchmarks\":\n  [\n";
+
+      for(auto it = results.cbegin(); it != results.cend(); ++it)
+      {
+        std::cout << "    { \"name\": \""   << it->name
+                  << "\", \"result_is_ok\": " << (it->result_is_ok ? "true" : "false")
+                  << ", \"ns_min\": "        << it->ns_min
+                  << ", \"ns_median\": "     << it->stats.ns_median
+                  << ", \"ns_p99\": "        << it->ns_p99
+                  << ", \"ns_mean\": "       << it->stats.ns_mean
+                  << ", \"ns_stddev\": "     << it->stats.ns_stddev
+                  << ", \"ops_per_sec\": "   << it->ops_per_sec
+                  << ", \"instructions\": "  << it->stats.instructions;
+
+        if(it->has_baseline)
+        {
+          std::cout << std::setprecision(2)
+                    << ", \"change_percent\": "      << it->change
+                    << ", \"change_low_percent\": "  << it->change_low
+                    << ", \"change_high_percent\": " << it->change_high
+                    << ", \"verdict\": \""           << it->verdict << '"'
+                    << std::setprecision(0);
+        }
+
+        std::cout << " }" << (((it + 1) != results.cend()) ? ",\n" : "\n");
+      }
+
+      std::cout << "  ]\n}" << std::endl;
+    }
+    else if(options.format == "csv")
+    {
+      std::cout << "name,result_is_ok,ns_min,ns_median,ns_p99,ns_mean,ns_stddev,ops_per_sec,instructions"
+                << (has_compare ? ",change_percent,change_low_percent,change_high_percent,verdict\n" : "\n");
+
+      for(const auto& result : results)
+      {
+        std::cout << result.name                   << ','
+                  << (result.result_is_ok ? 1 : 0) << ','
+                  << result.ns_min                 << ','
+                  << result.stats.ns_median        << ','
+                  << result.ns_p99                 << ','
+                  << result.stats.ns_mean          << ','
+                  << result.stats.ns_stddev        << ','
+                  << result.ops_per_sec            << ','
+                  << result.stats.instructions;
+
+        if(has_compare)
+        {
+          std::cout << std::setprecision(2)
+                    << ',' << result.change
+                    << ',' << result.change_low
+                    << ',' << result.change_high
+                    << ',' << result.verdict
+                    << std::setprecision(0);
+        }
+
+        std::cout << '\n';
+      }
+
+      std::cout.flush();
+    }
+    else
+    {
+      for(const auto& result : results)
+      {
+        std::cout << result.name
+                  << (result.result_is_ok ? ": ok" : ": FAILED")
+                  << ", min [ns]: "    << result.ns_min
+                  << ", median [ns]: " << result.stats.ns_median
+                  << ", p99 [ns]: "    << result.ns_p99
+                  << ", ops/s: "       << result.ops_per_sec;
+
+        if(result.stats.instructions >= 0.0)
+        {
+          std::cout << ", instructions: " << result.stats.instructions;
+        }
+
+        if(result.has_baseline)
+        {
+          std::cout << std::setprecision(1)
+                    << ", change [%]: " << result.change
+                    << " [" << result.change_low << ", " << result.change_high << "] "
+                    << result.verdict
+                    << std::setprecision(0);
+        }
+
+        std::cout << std::endl;
+      }
+    }
+  }
+} // namespace local
+
+int main(int argc, char** argv)
+{
+  local::runner_options options { };
+
+  if(!local::runner_parse(argc, argv, options))
+  {
+    return -1;
+  }
+
+  // Collect the selected benchmarks and order them by name.
+  std::vector<const app::benchmark::registry_entry*> entries { };
+
+  for(auto entry = app::benchmark::registry_entry::first(); entry != nullptr; entry = entry->next())
+  {
+    if(local::runner_is_selected(options, entry->name()))
+    {
+      entries.push_back(entry);
+    }
+  }
+
+  std::sort(entries.begin(),
+            entries.end(),
+            [](const app::benchmark::registry_entry* a, const app::benchmark::registry_entry* b)
+            {
+              return (std::string(a->name()) < std::string(b->name()));
+            });
+
+  if(options.list_only)
+  {
+    for(const auto& entry : entries) { std::cout << entry->name() << std::endl; }
+
+    return 0;
+  }
+
+  std::map<std::string, local::runner_statistics> baseline { };
+
+  if((!options.baseline_compare.empty()) && (!local::runner_baseline_load(options.baseline_compare, baseline)))
+  {
+    return -1;
+  }
+
+  const local::runner_instruction_counter counter { };
+
+  std::vector<local::runner_result> results { };
+
+  auto has_regression = false;
+
+  for(const auto& entry : entries)
+  {
+    results.push_back(local::runner_run(*entry, options, counter));
+
+    const auto it_baseline = baseline.find(results.back().name);
+
+    if(it_baseline != baseline.cend())
+    {
+      local::runner_compare(results.back(), it_baseline->second, options.threshold);
+
+      has_regression = ((std::string(results.back().verdict) == "REGRESSION") || has_regression);
+    }
+  }
+
+  local::runner_print(results, options);
+
+  if((!options.baseline_save.empty()) && (!local::runner_baseline_save(options.baseline_save, results)))
+  {
+    std::cerr << "baseline file " << options.baseline_save << " could not be written" << std::endl;
+
+    return -1;
+  }
+
+  const auto result_is_ok =
+    std::all_of(results.cbegin(),
+                results.cend(),
+                [](const local::runner_result& result) { return result.result_is_ok; });
+
+  return ((result_is_ok && (!has_regression)) ? 0 : -1);
+}
+
+#endif // APP_BENCHMARK_REGISTRY
@@ -209,6 +209,8 @@ auto app::benchmark::run_soft_double_h2f1() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(soft_double_h2f1)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 int main()
 {
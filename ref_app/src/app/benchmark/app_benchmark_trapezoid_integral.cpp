@@ -112,6 +112,8 @@ auto app::benchmark::run_trapezoid_integral() -> bool
   return app_benchmark_result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(trapezoid_integral)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
 auto main() -> int
 {
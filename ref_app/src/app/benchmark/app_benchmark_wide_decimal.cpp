@@ -13,7 +13,9 @@
 #if (defined(APP_BENCHMARK_TYPE) && (APP_BENCHMARK_TYPE == APP_BENCHMARK_TYPE_WIDE_DECIMAL))
 
 #define WIDE_DECIMAL_DISABLE_IOSTREAM
+#if !defined(APP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT)
 #define WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+#endif
 #define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
 #define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
 #define WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION
@@ -67,10 +69,495 @@ auto app::benchmark::run_wide_decimal() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(wide_decimal)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT)
+
+// The FFT and the NTT used for large-digit multiplication and the pi
+// calculations which use them are measured on the host only. These use
+// the dynamically allocated (and reused) workspaces of decwide_t.
+
+#include <math/wide_decimal/decwide_t_binary_splitting.h>
+#include <util/utility/util_thread_executor.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace local
+{
+  template<typename function_type>
+  auto microseconds_min_of_calls(function_type function) -> double
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    auto result = (std::numeric_limits<double>::max)();
+
+    const auto start_all = clock_type::now();
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < static_cast<unsigned>(UINT16_C(1000)); ++index)
+    {
+      const auto start = clock_type::now();
+
+      function();
+
+      const auto stop = clock_type::now();
+
+      result = (std::min)(result, std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(stop - start).count());
+
+      if((index >= static_cast<unsigned>(UINT8_C(3))) && ((stop - start_all) > std::chrono::milliseconds(100)))
+      {
+        break;
+      }
+    }
+
+    return result;
+  }
+
+  // Time the forward transform, the convolution of the real-valued
+  // spectra and the inverse transform of one FFT multiplication on
+  // their own. The convolution of random half-limbs is verified
+  // exactly through the sums (at x = 1) and the alternating sums
+  // (at x = -1) of the operands and of the rounded result.
+  auto wide_decimal_fft_throughput(const std::uint32_t n_fft) -> bool
+  {
+    using fft_float_type = double;
+
+    namespace fft = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail::fft;
+
+    const auto n_complex = static_cast<std::uint32_t>(n_fft / 2U);
+
+    std::vector<fft_float_type> twiddle_pool(static_cast<std::size_t>(n_fft * 2U));
+
+    fft::fft_twiddles_make(n_fft, twiddle_pool.data());
+
+    const auto tw = fft::fft_twiddles_view(n_fft, twiddle_pool.data());
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x5A17C3E9)) };
+
+    std::vector<std::uint32_t> u(static_cast<std::size_t>(n_fft / 2U));
+    std::vector<std::uint32_t> v(static_cast<std::size_t>(n_fft / 2U));
+
+    for(auto& value : u) { value = static_cast<std::uint32_t>(generator() % UINT32_C(10000)); }
+    for(auto& value : v) { value = static_cast<std::uint32_t>(generator() % UINT32_C(10000)); }
+
+    // Pack the points into the real and imaginary parts (even and odd points)
+    // in the lower half of the arrays. The upper half is the zero padding.
+    std::vector<fft_float_type> a(static_cast<std::size_t>(n_fft));
+    std::vector<fft_float_type> b(static_cast<std::size_t>(n_fft));
+
+    const auto pack =
+      [n_complex](std::vector<fft_float_type>& x, const std::vector<std::uint32_t>& points)
+      {
+        std::fill(x.begin(), x.end(), static_cast<fft_float_type>(0));
+
+        for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < points.size(); ++index)
+        {
+          x[(index % 2U == 0U) ? (index / 2U) : (static_cast<std::size_t>(n_complex) + (index / 2U))] = static_cast<fft_float_type>(points[index]);
+        }
+      };
+
+    pack(a, u);
+    pack(b, v);
+
+    const auto us_forward = microseconds_min_of_calls([&]() { fft::fft_dif_forward(n_complex, a.data(), a.data() + n_complex, tw); pack(a, u); });
+    const auto us_pack    = microseconds_min_of_calls([&]() { pack(a, u); });
+
+    fft::fft_dif_forward(n_complex, b.data(), b.data() + n_complex, tw);
+
+    std::vector<fft_float_type> a_spectrum(a.size());
+
+    fft::fft_dif_forward(n_complex, a.data(), a.data() + n_complex, tw);
+
+    std::copy(a.cbegin(), a.cend(), a_spectrum.begin());
+
+    const auto us_convolve = microseconds_min_of_calls([&]() { fft::fft_convolve_bitrev(n_complex, a.data(), a.data() + n_complex, b.data(), b.data() + n_complex, tw); std::copy(a_spectrum.cbegin(), a_spectrum.cend(), a.begin()); });
+    const auto us_copy     = microseconds_min_of_calls([&]() { std::copy(a_spectrum.cbegin(), a_spectrum.cend(), a.begin()); });
+
+    fft::fft_convolve_bitrev(n_complex, a.data(), a.data() + n_complex, b.data(), b.data() + n_complex, tw);
+
+    std::vector<fft_float_type> c_spectrum(a.size());
+
+    std::copy(a.cbegin(), a.cend(), c_spectrum.begin());
+
+    const auto us_inverse = microseconds_min_of_calls([&]() { fft::fft_dit_inverse(n_complex, a.data(), a.data() + n_complex, tw); std::copy(c_spectrum.cbegin(), c_spectrum.cend(), a.begin()); });
+
+    fft::fft_dit_inverse(n_complex, a.data(), a.data() + n_complex, tw);
+
+    // Remove the scale of 8 * n_complex and round the result points.
+    auto sum_u = static_cast<std::int64_t>(INT8_C(0)); auto alt_u = static_cast<std::int64_t>(INT8_C(0));
+    auto sum_v = static_cast<std::int64_t>(INT8_C(0)); auto alt_v = static_cast<std::int64_t>(INT8_C(0));
+    auto sum_c = static_cast<std::int64_t>(INT8_C(0)); auto alt_c = static_cast<std::int64_t>(INT8_C(0));
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < u.size(); ++index)
+    {
+      const auto sign = static_cast<std::int64_t>((index % 2U == 0U) ? INT8_C(1) : INT8_C(-1));
+
+      sum_u += static_cast<std::int64_t>(u[index]); alt_u += sign * static_cast<std::int64_t>(u[index]);
+      sum_v += static_cast<std::int64_t>(v[index]); alt_v += sign * static_cast<std::int64_t>(v[index]);
+    }
+
+    auto max_error = static_cast<fft_float_type>(0);
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < static_cast<std::size_t>(n_fft); ++index)
+    {
+      const auto value = a[(index % 2U == 0U) ? (index / 2U) : (static_cast<std::size_t>(n_complex) + (index / 2U))] / static_cast<fft_float_type>(static_cast<std::uint32_t>(n_complex * 8U));
+
+      const auto rounded = static_cast<std::int64_t>(value + static_cast<fft_float_type>(0.5L));
+
+      max_error = (std::max)(max_error, static_cast<fft_float_type>(std::fabs(value - static_cast<fft_float_type>(rounded))));
+
+      const auto sign = static_cast<std::int64_t>((index % 2U == 0U) ? INT8_C(1) : INT8_C(-1));
+
+      sum_c += rounded;
+      alt_c += sign * rounded;
+    }
+
+    const auto result_is_ok = ((sum_c == (sum_u * sum_v)) && (alt_c == (alt_u * alt_v)));
+
+    std::cout << "n_fft: " << std::setw(8) << n_fft << std::fixed << std::setprecision(1)
+              << ", forward: "   << std::setw(8) << (us_forward  - us_pack) << " us"
+              << ", convolve: "  << std::setw(8) << (us_convolve - us_copy) << " us"
+              << ", inverse: "   << std::setw(8) << (us_inverse  - us_copy) << " us"
+              << ", max. rounding error: " << std::setprecision(4) << max_error
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Time one multiplication of random limbs with the FFT and with
+  // the exact NTT and check that both products agree. The last two
+  // limbs are not compared, since the FFT releases its carries only
+  // from the lowest retained limb on, whereas the NTT starts below it.
+  auto wide_decimal_ntt_throughput(const std::int32_t prec) -> bool
+  {
+    namespace detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x2C9E4F17)) };
+
+    std::vector<std::uint32_t> u(static_cast<std::size_t>(prec));
+    std::vector<std::uint32_t> v(static_cast<std::size_t>(prec));
+
+    for(auto& value : u) { value = static_cast<std::uint32_t>(generator() % UINT32_C(100000000)); }
+    for(auto& value : v) { value = static_cast<std::uint32_t>(generator() % UINT32_C(100000000)); }
+
+    std::vector<std::uint32_t> r_fft(static_cast<std::size_t>(prec));
+    std::vector<std::uint32_t> r_ntt(static_cast<std::size_t>(prec));
+
+    const auto n_fft =
+      static_cast<std::uint32_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec)) * 4U);
+
+    std::vector<double> af(static_cast<std::size_t>(n_fft));
+    std::vector<double> bf(static_cast<std::size_t>(n_fft));
+    std::vector<double> fft_twiddle_pool(static_cast<std::size_t>(n_fft * 2U));
+
+    detail::fft::fft_twiddles_make(n_fft, fft_twiddle_pool.data());
+
+    const auto fft_tw = detail::fft::fft_twiddles_view(n_fft, fft_twiddle_pool.data());
+
+    const auto n_points_in =
+      static_cast<std::uint32_t>
+      (
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec) + static_cast<std::uint32_t>(detail::ntt_limbs_per_point<std::uint32_t>() - 1U))
+        / detail::ntt_limbs_per_point<std::uint32_t>()
+      );
+
+    const auto n_ntt =
+      static_cast<std::uint32_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(n_points_in * 2U) - 1U)));
+
+    std::vector<std::uint64_t> ntt_pool(static_cast<std::size_t>(n_ntt * 4U));
+    std::vector<std::uint64_t> ntt_twiddle_pool(static_cast<std::size_t>(n_ntt * 6U));
+
+    const auto ntt_tw = detail::ntt::ntt_twiddles_make(n_ntt, ntt_twiddle_pool.data());
+
+    const auto us_fft = microseconds_min_of_calls([&]() { detail::mul_loop_fft(r_fft.data(), u.data(), v.data(), af.data(), bf.data(), fft_tw, prec, n_fft, prec); });
+    const auto us_ntt = microseconds_min_of_calls([&]() { detail::mul_loop_ntt(r_ntt.data(), u.data(), v.data(), ntt_pool.data(), ntt_tw, prec, n_ntt, prec); });
+
+    const auto result_is_ok = std::equal(r_fft.cbegin(), r_fft.cend() - 2, r_ntt.cbegin());
+
+    std::cout << "limbs: " << std::setw(8) << prec << std::fixed << std::setprecision(1)
+              << ", FFT: " << std::setw(9) << us_fft << " us"
+              << ", NTT: " << std::setw(9) << us_ntt << " us"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Time the calculation of pi at a precision, which multiplies
+  // with the FFT (or with the NTT, depending on the multiplication
+  // policy), and check its digits against the digits of pi
+  // at a precision, which multiplies with Karatsuba only.
+  template<const std::int32_t Digits10,
+           typename MultiplyPolicyType = double>
+  auto wide_decimal_pi_throughput() -> bool
+  {
+    using local_limb_type = std::uint32_t;
+
+    constexpr auto low_digits10 = static_cast<std::int32_t>(INT32_C(10001));
+
+    using local_wide_decimal_type     = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<Digits10,     local_limb_type, std::allocator<void>, double, std::int32_t, MultiplyPolicyType>;
+    using local_wide_decimal_low_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<low_digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>;
+
+    static_assert(local_wide_decimal_type::decwide_t_elem_number >= local_wide_decimal_type::decwide_t_elems_for_fft,
+                  "Error: The pi throughput is intended for FFT or NTT multiplication");
+
+    using clock_type = std::chrono::steady_clock;
+
+    const auto start = clock_type::now();
+
+    const local_wide_decimal_type my_pi =
+      WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, MultiplyPolicyType>();
+
+    const auto stop = clock_type::now();
+
+    const local_wide_decimal_low_type my_pi_low =
+      WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<low_digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>();
+
+    const auto compare_count =
+      static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(low_digits10 / local_wide_decimal_low_type::decwide_t_elem_digits10) - static_cast<std::ptrdiff_t>(INT8_C(1)));
+
+    const auto result_is_ok = std::equal(my_pi_low.crepresentation().cbegin(),
+                                         my_pi_low.crepresentation().cbegin() + compare_count,
+                                         my_pi.crepresentation().cbegin());
+
+    std::cout << "pi digits: " << std::setw(8) << Digits10 << std::fixed << std::setprecision(3)
+              << ", multiply: " << ((local_wide_decimal_type::decwide_t_elem_number >= local_wide_decimal_type::decwide_t_elems_for_ntt) ? "NTT" : "FFT")
+              << ", time: " << std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count() << " s"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Time the calculation of pi with and without an executor scope,
+  // in which the large multiplications (and the sub-terms of the
+  // square roots) run in the threads of util::thread_executor.
+  // The digits and the reports of the callback must be the same.
+  template<const std::int32_t Digits10>
+  auto wide_decimal_pi_parallel_throughput() -> bool
+  {
+    using local_limb_type = std::uint32_t;
+
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>;
+
+    using executor_type = util::thread_executor;
+
+    const auto partition_count =
+      static_cast<std::size_t>((std::max)(std::thread::hardware_concurrency(), static_cast<unsigned>(UINT8_C(2))));
+
+    using clock_type = std::chrono::steady_clock;
+
+    // The callback is a plain function pointer, which records its reports here.
+    static std::vector<std::uint32_t> reports { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    const auto pfn_report = [](const std::uint32_t digits10) { reports.push_back(digits10); };
+
+    reports.clear();
+
+    const auto start_sequential = clock_type::now();
+
+    const local_wide_decimal_type my_pi_sequential =
+      WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>
+      (
+        pfn_report
+      );
+
+    const auto stop_sequential = clock_type::now();
+
+    const auto reports_sequential = reports;
+
+    reports.clear();
+
+    executor_type executor { };
+
+    const auto start_parallel = clock_type::now();
+
+    const local_wide_decimal_type my_pi_parallel =
+      [&executor, &partition_count, &pfn_report]()
+      {
+        const WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t_executor_scope<executor_type> scope(executor, partition_count);
+
+        return
+          WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>
+          (
+            pfn_report
+          );
+      }();
+
+    const auto stop_parallel = clock_type::now();
+
+    const auto result_is_ok =
+    (
+         (my_pi_parallel == my_pi_sequential)
+      && (reports == reports_sequential)
+      && (reports.size() > static_cast<std::size_t>(UINT8_C(2)))
+    );
+
+    const auto time_sequential = std::chrono::duration_cast<std::chrono::duration<double>>(stop_sequential - start_sequential).count();
+    const auto time_parallel   = std::chrono::duration_cast<std::chrono::duration<double>>(stop_parallel   - start_parallel).count();
+
+    std::cout << "pi digits: " << std::setw(8) << Digits10 << ", partitions: " << partition_count << std::fixed << std::setprecision(3)
+              << ", time: " << time_sequential << " s"
+              << ", parallel: " << time_parallel << " s"
+              << ", speedup: " << std::setprecision(2) << (time_sequential / time_parallel)
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+  // Time the calculation of pi with the Chudnovsky series (binary
+  // splitting) and with the AGM, and check the digits of each series
+  // against independent calculations. The binary splitting is also
+  // resumed from a state, which is saved and restored in its limbs.
+  template<const std::int32_t Digits10>
+  auto wide_decimal_binary_splitting_throughput() -> bool
+  {
+    using local_limb_type = std::uint32_t;
+
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>;
+
+    namespace wide_decimal = WIDE_DECIMAL_NAMESPACE::math::wide_decimal;
+
+    using clock_type = std::chrono::steady_clock;
+
+    // Compare all limbs except the last, which hold the guard digits.
+    const auto digits_are_equal =
+      [](const local_wide_decimal_type& a, const local_wide_decimal_type& b)
+      {
+        const auto compare_count =
+          static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(Digits10 / local_wide_decimal_type::decwide_t_elem_digits10) - static_cast<std::ptrdiff_t>(INT8_C(1)));
+
+        return std::equal(a.crepresentation().cbegin(),
+                          a.crepresentation().cbegin() + compare_count,
+                          b.crepresentation().cbegin());
+      };
+
+    const auto start_agm = clock_type::now();
+
+    const local_wide_decimal_type my_pi_agm =
+      wide_decimal::calc_pi<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>();
+
+    const auto stop_agm = clock_type::now();
+
+    const auto start_chudnovsky = clock_type::now();
+
+    const local_wide_decimal_type my_pi_chudnovsky = wide_decimal::calc_pi_chudnovsky<local_wide_decimal_type>();
+
+    const auto stop_chudnovsky = clock_type::now();
+
+    auto result_is_ok = digits_are_equal(my_pi_agm, my_pi_chudnovsky);
+
+    result_is_ok = (digits_are_equal(exp(local_wide_decimal_type(static_cast<unsigned>(UINT8_C(1)))), wide_decimal::calc_e_binary_splitting<local_wide_decimal_type>()) && result_is_ok);
+
+    result_is_ok = (digits_are_equal(wide_decimal::calc_ln_two<Digits10, local_limb_type, std::allocator<void>, double, std::int32_t, double>(), wide_decimal::calc_ln_two_binary_splitting<local_wide_decimal_type>()) && result_is_ok);
+
+    // The leading digits of zeta(3) = 1.20205690315959428539973816151144999076498629...
+    {
+      const local_wide_decimal_type my_zeta_three = wide_decimal::calc_zeta_three_binary_splitting<local_wide_decimal_type>();
+
+      const std::array<local_limb_type, static_cast<std::size_t>(UINT8_C(6))> zeta_three_limbs =
+      {{
+        static_cast<local_limb_type>(UINT32_C(1)),
+        static_cast<local_limb_type>(UINT32_C(20205690)),
+        static_cast<local_limb_type>(UINT32_C(31595942)),
+        static_cast<local_limb_type>(UINT32_C(85399738)),
+        static_cast<local_limb_type>(UINT32_C(16151144)),
+        static_cast<local_limb_type>(UINT32_C(99907649))
+      }};
+
+      result_is_ok = (std::equal(zeta_three_limbs.cbegin(), zeta_three_limbs.cend(), my_zeta_three.crepresentation().cbegin()) && result_is_ok);
+    }
+
+    // Resume the series from a restored state, which holds one third of the terms.
+    {
+      using series_type = wide_decimal::binary_splitting_series_pi_chudnovsky;
+      using state_type  = wide_decimal::decwide_t_binary_splitting_state<local_wide_decimal_type>;
+
+      const auto terms = wide_decimal::binary_splitting_terms<series_type, local_wide_decimal_type>();
+
+      state_type state_saved { };
+
+      wide_decimal::binary_splitting_advance<series_type>(state_saved, static_cast<std::uint32_t>(terms / 3U));
+
+      const auto restored =
+        [](const typename state_type::integer_type& x)
+        {
+          return typename state_type::integer_type(x.crepresentation().data(), x.crepresentation().size(), x.is_neg());
+        };
+
+      state_type state_restored { };
+
+      state_restored.terms = state_saved.terms;
+      state_restored.p     = restored(state_saved.p);
+      state_restored.q     = restored(state_saved.q);
+      state_restored.t     = restored(state_saved.t);
+
+      wide_decimal::binary_splitting_advance<series_type>(state_restored, terms);
+
+      result_is_ok = ((wide_decimal::binary_splitting_value<series_type>(state_restored) == my_pi_chudnovsky) && result_is_ok);
+    }
+
+    std::cout << "pi digits: " << std::setw(8) << Digits10 << std::fixed << std::setprecision(3)
+              << ", AGM: " << std::chrono::duration_cast<std::chrono::duration<double>>(stop_agm - start_agm).count() << " s"
+              << ", Chudnovsky: " << std::chrono::duration_cast<std::chrono::duration<double>>(stop_chudnovsky - start_chudnovsky).count() << " s"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+  // Check the constexpr tables of pi and log(2), from which the cached
+  // constants are taken up to about 1000 decimal digits, against the
+  // AGM calculations of these constants.
+  template<typename LimbType>
+  auto wide_decimal_constant_tables_check() -> bool
+  {
+    constexpr auto digits10 = static_cast<std::int32_t>(INT32_C(1001));
+
+    using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<digits10, LimbType, std::allocator<void>, double, std::int32_t, double>;
+
+    namespace detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+
+    using table_pi_type     = detail::decwide_t_constant_table_pi<>;
+    using table_ln_two_type = detail::decwide_t_constant_table_ln_two<>;
+
+    static_assert(   detail::constant_table_fits<LimbType, table_pi_type>    (local_wide_decimal_type::decwide_t_elem_number)
+                  && detail::constant_table_fits<LimbType, table_ln_two_type>(local_wide_decimal_type::decwide_t_elem_number),
+                  "Error: The constant tables are intended to hold 1001 decimal digits");
+
+    const local_wide_decimal_type my_pi     = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi    <digits10, LimbType, std::allocator<void>, double, std::int32_t, double>();
+    const local_wide_decimal_type my_ln_two = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_ln_two<digits10, LimbType, std::allocator<void>, double, std::int32_t, double>();
+
+    // Compare all limbs except the last, which hold the guard digits.
+    // The first limb of pi is its integer part.
+    const auto compare_count =
+      static_cast<std::size_t>(static_cast<std::size_t>(digits10 / local_wide_decimal_type::decwide_t_elem_digits10) - static_cast<std::size_t>(UINT8_C(1)));
+
+    auto result_is_ok = (my_pi.crepresentation().front() == static_cast<LimbType>(table_pi_type::integer_part));
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < compare_count; ++index)
+    {
+      result_is_ok = ((my_pi.crepresentation()    [index + 1U] == detail::constant_table_fraction_limb<LimbType, table_pi_type>    (index)) && result_is_ok);
+      result_is_ok = ((my_ln_two.crepresentation()[index]      == detail::constant_table_fraction_limb<LimbType, table_ln_two_type>(index)) && result_is_ok);
+    }
+
+    std::cout << "constant tables, limb digits: " << local_wide_decimal_type::decwide_t_elem_digits10
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+} // namespace local
+
+#endif // APP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT
+
 int main()
 {
-  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_decimal.cpp -o ./ref_app/bin/app_benchmark_wide_decimal.exe
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT ./ref_app/src/app/benchmark/app_benchmark_wide_decimal.cpp -o ./ref_app/bin/app_benchmark_wide_decimal.exe
 
   bool result_is_ok = true;
 
@@ -79,6 +566,32 @@ int main()
     result_is_ok &= app::benchmark::run_wide_decimal();
   }
 
+  #if defined(APP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT)
+  for(auto n_fft = static_cast<std::uint32_t>(UINT32_C(8192)); n_fft <= static_cast<std::uint32_t>(UINT32_C(524288)); n_fft *= 4U)
+  {
+    result_is_ok = (local::wide_decimal_fft_throughput(n_fft) && result_is_ok);
+  }
+
+  for(auto prec = static_cast<std::int32_t>(INT32_C(16384)); prec <= static_cast<std::int32_t>(INT32_C(262144)); prec *= 4)
+  {
+    result_is_ok = (local::wide_decimal_ntt_throughput(prec) && result_is_ok);
+  }
+
+  result_is_ok = (local::wide_decimal_pi_throughput<static_cast<std::int32_t>(INT32_C(100001))>() && result_is_ok);
+
+  using local_ntt_policy_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t_multiply_policy<double, static_cast<std::int32_t>(INT8_C(0))>;
+
+  result_is_ok = (local::wide_decimal_pi_throughput<static_cast<std::int32_t>(INT32_C(100001)), local_ntt_policy_type>() && result_is_ok);
+
+  result_is_ok = (local::wide_decimal_pi_parallel_throughput<static_cast<std::int32_t>(INT32_C(100001))>() && result_is_ok);
+
+  result_is_ok = (local::wide_decimal_binary_splitting_throughput<static_cast<std::int32_t>(INT32_C(100001))>() && result_is_ok);
+
+  result_is_ok = (local::wide_decimal_constant_tables_check<std::uint32_t>() && result_is_ok);
+  result_is_ok = (local::wide_decimal_constant_tables_check<std::uint16_t>() && result_is_ok);
+  result_is_ok = (local::wide_decimal_constant_tables_check<std::uint8_t> () && result_is_ok);
+  #endif
+
   return result_is_ok ? 0 : -1;
 }
 #endif
@@ -27,6 +27,10 @@
 #define WIDE_INTEGER_DISABLE_IMPLEMENT_UTIL_DYNAMIC_ARRAY
 #define WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS
 
+#if defined(APP_BENCHMARK_WIDE_INTEGER_THROUGHPUT)
+#define WIDE_INTEGER_HAS_LIMB_TYPE_UINT64
+#endif
+
 #if !defined(WIDE_INTEGER_NAMESPACE)
 #define WIDE_INTEGER_NAMESPACE ckormanyos
 #endif
@@ -145,10 +149,378 @@ auto app::benchmark::run_wide_integer() -> bool
   return result_is_ok;
 }
 
+APP_BENCHMARK_REGISTER(wide_integer)
+
 #if defined(APP_BENCHMARK_STANDALONE_MAIN)
+
+#if defined(APP_BENCHMARK_WIDE_INTEGER_THROUGHPUT)
+
+// The speedup of the modular exponentiation in the Montgomery field
+// over powm() with Barrett reduction, the multiplication tiers, the
+// reductions and divisions of very wide integers and the sliding window
+// and fixed-base exponentiations are measured on the host only.
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+
+namespace local
+{
+  template<typename function_type>
+  auto microseconds_per_call(const unsigned count, function_type function) -> double
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    const auto start = clock_type::now();
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      function(index);
+    }
+
+    const auto stop = clock_type::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(stop - start).count() / static_cast<double>(count);
+  }
+
+  template<typename LimbType>
+  auto wide_integer_powm_throughput(const char* name) -> bool
+  {
+    using local_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), LimbType>;
+
+    using local_field_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_field<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), LimbType>;
+
+    constexpr auto count = static_cast<unsigned>(UINT8_C(64));
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x6B1D3C27)) };
+
+    const auto random_value =
+      [&generator]()
+      {
+        local_uint_type value { };
+
+        for(auto index = static_cast<unsigned>(UINT8_C(0)); index < static_cast<unsigned>(UINT8_C(8)); ++index)
+        {
+          value = static_cast<local_uint_type>((value << 32U) | local_uint_type(static_cast<std::uint32_t>(generator())));
+        }
+
+        return value;
+      };
+
+    // The modulus is the field characteristic of secp256k1.
+    const local_uint_type m("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+
+    const local_field_type field(m);
+
+    std::array<local_uint_type, count> bases     { };
+    std::array<local_uint_type, count> exponents { };
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+    {
+      bases    [index] = random_value() % m;
+      exponents[index] = random_value();
+    }
+
+    std::array<local_uint_type, count> expected { };
+    std::array<local_uint_type, count> results  { };
+
+    const auto us_powm       = microseconds_per_call(count, [&](const unsigned index) { expected[index] = powm(bases[index], exponents[index], m); });
+    const auto us_montgomery = microseconds_per_call(count, [&](const unsigned index) { results [index] = field.powm(bases[index], exponents[index]); });
+
+    const auto result_is_ok = (results == expected);
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(0)
+              << "powm: " << us_powm << " us, montgomery: " << us_montgomery << " us"
+              << " (x" << std::setprecision(1) << (us_powm / us_montgomery) << ")"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Calibrate the thresholds of the multiplication tiers. Each tier is
+  // timed at each width (the minimum of repeated single calls is used,
+  // which is robust against the noise of a busy host) and the results
+  // of all tiers are verified against each other. The recommended
+  // thresholds are the smallest widths from which on Toom-Cook 3-way
+  // beats Karatsuba and the NTT beats both of them.
+
+  template<typename function_type>
+  auto microseconds_min_of_calls(function_type function) -> double
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    auto result = (std::numeric_limits<double>::max)();
+
+    const auto start_all = clock_type::now();
+
+    for(auto index = static_cast<unsigned>(UINT8_C(0)); index < static_cast<unsigned>(UINT16_C(1000)); ++index)
+    {
+      const auto start = clock_type::now();
+
+      function();
+
+      const auto stop = clock_type::now();
+
+      result = (std::min)(result, std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(stop - start).count());
+
+      if((index >= static_cast<unsigned>(UINT8_C(3))) && ((stop - start_all) > std::chrono::milliseconds(100)))
+      {
+        break;
+      }
+    }
+
+    return result;
+  }
+
+  struct multiplication_timing
+  {
+    std::uint32_t width;
+    double        us_karatsuba;
+    double        us_toom3;
+    double        us_ntt;
+  };
+
+  template<const std::uint32_t Width2, typename LimbType>
+  auto wide_integer_multiplication_timing(multiplication_timing& timing) -> bool
+  {
+    using local_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(Width2), LimbType, std::allocator<void>>;
+
+    using local_algorithm_type = typename local_uint_type::multiplication_algorithm;
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x3C0B2E71)) };
+
+    local_uint_type a { };
+    local_uint_type b { };
+
+    for(auto& limb : a.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+    for(auto& limb : b.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+
+    local_uint_type result_karatsuba { };
+    local_uint_type result_toom3     { };
+    local_uint_type result_ntt       { };
+
+    timing.width        = Width2;
+    timing.us_karatsuba = microseconds_min_of_calls([&]() { result_karatsuba = a; result_karatsuba.mul_with_algorithm(b, local_algorithm_type::karatsuba); });
+    timing.us_toom3     = microseconds_min_of_calls([&]() { result_toom3     = a; result_toom3.mul_with_algorithm    (b, local_algorithm_type::toom3); });
+    timing.us_ntt       = microseconds_min_of_calls([&]() { result_ntt       = a; result_ntt.mul_with_algorithm      (b, local_algorithm_type::ntt); });
+
+    auto result_is_ok = ((result_toom3 == result_karatsuba) && (result_ntt == result_karatsuba));
+
+    // The schoolbook tier is verified at the smaller widths only.
+    if(Width2 <= static_cast<std::uint32_t>(UINT32_C(65536)))
+    {
+      local_uint_type result_schoolbook(a);
+
+      result_schoolbook.mul_with_algorithm(b, local_algorithm_type::schoolbook);
+
+      result_is_ok = ((result_schoolbook == result_karatsuba) && result_is_ok);
+    }
+
+    std::cout << std::setw(8) << Width2 << " bits: " << std::fixed << std::setprecision(0)
+              << "karatsuba: " << std::setw(7) << timing.us_karatsuba << " us, "
+              << "toom3: "     << std::setw(7) << timing.us_toom3     << " us, "
+              << "ntt: "       << std::setw(7) << timing.us_ntt       << " us"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto wide_integer_multiplication_calibration(const char* name) -> bool
+  {
+    std::cout << "multiplication tiers, " << name << std::endl;
+
+    std::array<multiplication_timing, static_cast<std::size_t>(UINT8_C(7))> timings { };
+
+    auto result_is_ok = true;
+
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C(  8192)), LimbType>(timings[0U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C( 16384)), LimbType>(timings[1U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C( 32768)), LimbType>(timings[2U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C( 65536)), LimbType>(timings[3U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C(131072)), LimbType>(timings[4U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C(262144)), LimbType>(timings[5U]) && result_is_ok);
+    result_is_ok = (wide_integer_multiplication_timing<static_cast<std::uint32_t>(UINT32_C(1048576)), LimbType>(timings[6U]) && result_is_ok);
+
+    // Find the smallest widths from which on the faster tier stays faster.
+    auto toom3_threshold = static_cast<std::uint32_t>(UINT8_C(0));
+    auto ntt_threshold   = static_cast<std::uint32_t>(UINT8_C(0));
+
+    for(auto index = timings.size(); index > static_cast<std::size_t>(UINT8_C(0)); --index)
+    {
+      const auto& timing = timings[index - 1U];
+
+      if(timing.us_toom3 < timing.us_karatsuba)
+      {
+        toom3_threshold = timing.width;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    for(auto index = timings.size(); index > static_cast<std::size_t>(UINT8_C(0)); --index)
+    {
+      const auto& timing = timings[index - 1U];
+
+      if(timing.us_ntt < (std::min)(timing.us_karatsuba, timing.us_toom3))
+      {
+        ntt_threshold = timing.width;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    std::cout << "recommended: WIDE_INTEGER_TOOM3_THRESHOLD_BITS=" << toom3_threshold
+              << ", WIDE_INTEGER_NTT_THRESHOLD_BITS="              << ntt_threshold << std::endl;
+
+    return result_is_ok;
+  }
+
+  // Compare the modular multiplication with a long division of the
+  // double-width product against barrett_reduction, which reduces with
+  // the precomputed reciprocal of the modulus, and time the division,
+  // which switches to a Newton reciprocal above its threshold.
+
+  template<const std::uint32_t Width2, typename LimbType>
+  auto wide_integer_reduction_timing() -> bool
+  {
+    using local_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(Width2), LimbType, std::allocator<void>>;
+
+    using local_double_width_type = typename local_uint_type::double_width_type;
+
+    using local_reduction_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_reduction<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(Width2), LimbType, std::allocator<void>>;
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x51E7A9C3)) };
+
+    local_uint_type m { };
+    local_uint_type u { };
+
+    for(auto& limb : m.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+    for(auto& limb : u.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+
+    const local_uint_type a(u % m);
+    const local_uint_type b(~u);
+
+    // The divisor of the division has half of the width.
+    const local_uint_type v(m >> static_cast<unsigned>(Width2 / 2U));
+
+    const local_reduction_type reduction(m);
+
+    local_uint_type result_division  { };
+    local_uint_type result_reduction { };
+    local_uint_type q                { };
+
+    const auto us_division  = microseconds_min_of_calls([&]() { result_division = local_uint_type((local_double_width_type(a) * local_double_width_type(b)) % local_double_width_type(m)); });
+    const auto us_reduction = microseconds_min_of_calls([&]() { result_reduction = reduction.multiply(a, b); });
+    const auto us_quotient  = microseconds_min_of_calls([&]() { q = u / v; });
+
+    const local_uint_type r(u - (q * v));
+
+    const auto result_is_ok = ((result_reduction == result_division) && (r < v));
+
+    std::cout << std::setw(8) << Width2 << " bits: " << std::fixed << std::setprecision(0)
+              << "mulmod with division: " << std::setw(7) << us_division  << " us, "
+              << "barrett: "              << std::setw(7) << us_reduction << " us, "
+              << "u / v: "                << std::setw(7) << us_quotient  << " us"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto wide_integer_reduction_throughput(const char* name) -> bool
+  {
+    std::cout << "reduction and division, " << name << std::endl;
+
+    auto result_is_ok = true;
+
+    result_is_ok = (wide_integer_reduction_timing<static_cast<std::uint32_t>(UINT32_C(  1024)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_reduction_timing<static_cast<std::uint32_t>(UINT32_C(  4096)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_reduction_timing<static_cast<std::uint32_t>(UINT32_C( 16384)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_reduction_timing<static_cast<std::uint32_t>(UINT32_C( 65536)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_reduction_timing<static_cast<std::uint32_t>(UINT32_C(262144)), LimbType>() && result_is_ok);
+
+    return result_is_ok;
+  }
+  // Time powm() with sliding window exponentiation for a random base and
+  // for the single-limb base 2 (as in the Miller-Rabin and Fermat tests),
+  // and fixed_base_powm, which precomputes a comb of powers of the base
+  // once and reuses them for all exponents. The results are verified
+  // against each other.
+
+  template<const std::uint32_t Width2, typename LimbType>
+  auto wide_integer_exponentiation_timing() -> bool
+  {
+    using local_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(Width2), LimbType>;
+
+    using local_fixed_base_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::fixed_base_powm<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(Width2), LimbType>;
+
+    std::mt19937 generator { static_cast<std::mt19937::result_type>(UINT32_C(0x2C5A9F41)) };
+
+    local_uint_type m { };
+    local_uint_type b { };
+    local_uint_type p { };
+
+    for(auto& limb : m.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+    for(auto& limb : b.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+    for(auto& limb : p.representation()) { limb = static_cast<LimbType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(generator()) << 32U) | generator()); }
+
+    m |= static_cast<unsigned>(UINT8_C(1));
+    b %= m;
+
+    const local_uint_type two(static_cast<unsigned>(UINT8_C(2)));
+
+    const local_fixed_base_type fixed_base    (b,   m);
+    const local_fixed_base_type fixed_base_two(two, m);
+
+    local_uint_type result_powm       { };
+    local_uint_type result_powm_two   { };
+    local_uint_type result_fixed_base { };
+
+    const auto us_powm       = microseconds_min_of_calls([&]() { result_powm       = powm(b, p, m); });
+    const auto us_powm_two   = microseconds_min_of_calls([&]() { result_powm_two   = powm(two, p, m); });
+    const auto us_fixed_base = microseconds_min_of_calls([&]() { result_fixed_base = fixed_base.powm(p); });
+
+    const auto result_is_ok = ((result_fixed_base == result_powm) && (fixed_base_two.powm(p) == result_powm_two));
+
+    std::cout << std::setw(8) << Width2 << " bits: " << std::fixed << std::setprecision(0)
+              << "powm: "          << std::setw(7) << us_powm       << " us, "
+              << "powm base 2: "   << std::setw(7) << us_powm_two   << " us, "
+              << "fixed base: "    << std::setw(7) << us_fixed_base << " us"
+              << (result_is_ok ? "" : " FAILED") << std::endl;
+
+    return result_is_ok;
+  }
+
+  template<typename LimbType>
+  auto wide_integer_exponentiation_throughput(const char* name) -> bool
+  {
+    std::cout << "exponentiation, " << name << std::endl;
+
+    auto result_is_ok = true;
+
+    result_is_ok = (wide_integer_exponentiation_timing<static_cast<std::uint32_t>(UINT32_C( 128)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_exponentiation_timing<static_cast<std::uint32_t>(UINT32_C( 256)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_exponentiation_timing<static_cast<std::uint32_t>(UINT32_C(1024)), LimbType>() && result_is_ok);
+    result_is_ok = (wide_integer_exponentiation_timing<static_cast<std::uint32_t>(UINT32_C(2048)), LimbType>() && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace local
+
+#endif // APP_BENCHMARK_WIDE_INTEGER_THROUGHPUT
+
 int main()
 {
-  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER -DAPP_BENCHMARK_STANDALONE_MAIN ./ref_app/src/app/benchmark/app_benchmark_wide_integer.cpp -o ./ref_app/bin/app_benchmark_wide_integer.exe
+  // g++ -Wall -O3 -march=native -I./ref_app/src/mcal/host -I./ref_app/src -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_WIDE_INTEGER_THROUGHPUT ./ref_app/src/app/benchmark/app_benchmark_wide_integer.cpp -o ./ref_app/bin/app_benchmark_wide_integer.exe
 
   auto result_is_ok = true;
 
@@ -157,6 +529,18 @@ int main()
     result_is_ok &= app::benchmark::run_wide_integer();
   }
 
+  #if defined(APP_BENCHMARK_WIDE_INTEGER_THROUGHPUT)
+  result_is_ok = (local::wide_integer_powm_throughput<std::uint32_t>("256 bits, 32-bit limbs: ") && result_is_ok);
+  result_is_ok = (local::wide_integer_powm_throughput<std::uint64_t>("256 bits, 64-bit limbs: ") && result_is_ok);
+
+  result_is_ok = (local::wide_integer_multiplication_calibration<std::uint32_t>("32-bit limbs") && result_is_ok);
+  result_is_ok = (local::wide_integer_multiplication_calibration<std::uint64_t>("64-bit limbs") && result_is_ok);
+
+  result_is_ok = (local::wide_integer_reduction_throughput<std::uint32_t>("32-bit limbs") && result_is_ok);
+
+  result_is_ok = (local::wide_integer_exponentiation_throughput<std::uint32_t>("32-bit limbs") && result_is_ok);
+  #endif
+
   return result_is_ok ? 0 : -1;
 }
 #endif
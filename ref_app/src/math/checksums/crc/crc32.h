@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2007 - 2019.
+//  Copyright Christopher Kormanyos 2007 - 2026.
 //  Distributed under the Boost Software License,
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -8,59 +8,186 @@
 #ifndef CRC32_2015_01_26_H_
   #define CRC32_2015_01_26_H_
 
-  #include <array>
+  #include <cstddef>
   #include <cstdint>
+  #include <iterator>
+
+  #include <math/checksums/crc/crc_engine.h>
 
   namespace math { namespace checksums { namespace crc {
 
-  template<typename input_iterator>
-  std::uint32_t crc32_mpeg2(input_iterator first,
-                            input_iterator last)
+  // Name            : CRC-32/MPEG-2
+  // Polynomial      : 0x04C11DB7
+  // Initial value   : 0xFFFFFFFF
+  // Test: '1'...'9' : 0x0376E6E7
+
+  // ISO/IEC 13818-1:2000
+  // Recommendation H.222.0 Annex A
+
+  // The CRC32/MPEG2 is available with several engines, which are
+  // selected at compile time as a template parameter of crc32_mpeg2().
+  // All engines produce bit-identical results. The default nibble
+  // engine has the smallest table (64 bytes) and is the right choice
+  // for small microcontrollers. The byte engine uses a 1 kB table,
+  // and the slice-by-8 and slice-by-16 engines use 8 kB and 16 kB
+  // tables, which pays off on 32-bit and 64-bit CPUs with caches.
+  // See also crc_engine.h for the generic CRC engine and crc32_clmul.h
+  // for the carry-less multiplication engine and the run-time dispatch
+  // on x86-64.
+
+  // Each engine provides the function update(crc, first, last),
+  // which continues the CRC calculation of a stream of bytes.
+
+  constexpr auto crc32_mpeg2_polynomial    = static_cast<std::uint32_t>(UINT32_C(0x04C11DB7));
+  constexpr auto crc32_mpeg2_initial_value = static_cast<std::uint32_t>(UINT32_C(0xFFFFFFFF));
+
+  // The nibble and byte engines are the generic CRC engine
+  // with tables of 16 and 256 entries, respectively.
+  template<const unsigned TableBits>
+  using crc32_mpeg2_crc_engine = crc_engine<32U, crc32_mpeg2_polynomial, crc32_mpeg2_initial_value, false, false, UINT32_C(0), TableBits>;
+
+  struct crc32_mpeg2_engine_nibble
   {
-    // Name            : CRC-32/MPEG-2
-    // Polynomial      : 0x04C11DB7
-    // Initial value   : 0xFFFFFFFF
-    // Test: '1'...'9' : 0x0376E6E7
-
-    // ISO/IEC 13818-1:2000
-    // Recommendation H.222.0 Annex A
-
-    // CRC32/MPEG2 Table based on nibbles.
-    constexpr std::array<std::uint32_t, 16U> table =
-    {{
-      UINT32_C(0x00000000), UINT32_C(0x04C11DB7),
-      UINT32_C(0x09823B6E), UINT32_C(0x0D4326D9),
-      UINT32_C(0x130476DC), UINT32_C(0x17C56B6B),
-      UINT32_C(0x1A864DB2), UINT32_C(0x1E475005),
-      UINT32_C(0x2608EDB8), UINT32_C(0x22C9F00F),
-      UINT32_C(0x2F8AD6D6), UINT32_C(0x2B4BCB61),
-      UINT32_C(0x350C9B64), UINT32_C(0x31CD86D3),
-      UINT32_C(0x3C8EA00A), UINT32_C(0x384FBDBD)
-    }};
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last) -> std::uint32_t
+    {
+      return crc32_mpeg2_crc_engine<4U>::update_register(crc, first, last);
+    }
+  };
 
-    // Set the initial value and loop through the input data stream.
+  namespace detail {
 
-    std::uint32_t crc = UINT32_C(0xFFFFFFFF);
+  // The slice tables of the CRC32/MPEG2. The entry value[s][b] is the CRC
+  // of the byte b followed by s zero bytes, starting from a zero CRC.
+  template<const std::size_t SliceCount>
+  struct crc32_mpeg2_slice_table
+  {
+    std::uint32_t value[SliceCount][256U]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+  };
 
-    for( ; first != last; ++first)
+  template<const std::size_t SliceCount>
+  constexpr auto crc32_mpeg2_make_slice_table() -> crc32_mpeg2_slice_table<SliceCount>
+  {
+    crc32_mpeg2_slice_table<SliceCount> table { };
+
+    for(std::size_t index = 0U; index < 256U; ++index)
     {
-      const std::uint_fast8_t the_byte = uint_fast8_t((*first) & UINT8_C(0xFF));
+      auto crc = static_cast<std::uint32_t>(index << 24U);
 
-      std::uint_fast8_t index;
+      for(unsigned bit = 0U; bit < 8U; ++bit)
+      {
+        crc = (((crc & UINT32_C(0x80000000)) != 0U) ? static_cast<std::uint32_t>((crc << 1U) ^ crc32_mpeg2_polynomial)
+                                                    : static_cast<std::uint32_t>(crc << 1U));
+      }
 
-      // Perform the CRC32/MPEG2 algorithm.
-      index = ((std::uint_fast8_t(crc >> 28)) ^ (std::uint_fast8_t(the_byte >>  4))) & UINT8_C(0x0F);
+      table.value[0U][index] = crc;
+    }
 
-      crc   = std::uint32_t(std::uint32_t(crc << 4) & UINT32_C(0xFFFFFFF0)) ^ table[index];
+    for(std::size_t slice = 1U; slice < SliceCount; ++slice)
+    {
+      for(std::size_t index = 0U; index < 256U; ++index)
+      {
+        const auto previous = table.value[slice - 1U][index];
 
-      index = ((std::uint_fast8_t(crc >> 28)) ^ (std::uint_fast8_t(the_byte))) & UINT8_C(0x0F);
+        table.value[slice][index] = static_cast<std::uint32_t>(previous << 8U) ^ table.value[0U][previous >> 24U];
+      }
+    }
+
+    return table;
+  }
+
+  template<const std::size_t SliceCount>
+  auto crc32_mpeg2_get_slice_table() -> const crc32_mpeg2_slice_table<SliceCount>&
+  {
+    static constexpr crc32_mpeg2_slice_table<SliceCount> table = crc32_mpeg2_make_slice_table<SliceCount>();
+
+    return table;
+  }
+
+  template<typename input_iterator>
+  auto crc32_mpeg2_update_bytes(std::uint32_t crc, input_iterator first, input_iterator last, const std::uint32_t* table) -> std::uint32_t
+  {
+    for( ; first != last; ++first)
+    {
+      const auto the_byte = static_cast<std::uint_fast8_t>((*first) & UINT8_C(0xFF));
 
-      crc   = std::uint32_t(std::uint32_t(crc << 4) & UINT32_C(0xFFFFFFF0)) ^ table[index];
+      crc = static_cast<std::uint32_t>(crc << 8U) ^ table[static_cast<std::uint_fast8_t>(crc >> 24U) ^ the_byte]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
     return crc;
   }
 
+  } // namespace detail
+
+  struct crc32_mpeg2_engine_byte
+  {
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last) -> std::uint32_t
+    {
+      return crc32_mpeg2_crc_engine<8U>::update_register(crc, first, last);
+    }
+  };
+
+  // The slicing engine processes SliceCount bytes per step with
+  // SliceCount independent table lookups. The input bytes are read
+  // one at a time through the iterator, so that the result does not
+  // depend on the byte order or on the alignment of the data.
+  template<const std::size_t SliceCount>
+  struct crc32_mpeg2_engine_slice
+  {
+    static_assert((SliceCount >= 4U) && ((SliceCount % 4U) == 0U),
+                  "Error: The slice count must be a multiple of 4");
+
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last) -> std::uint32_t
+    {
+      const auto& table = detail::crc32_mpeg2_get_slice_table<SliceCount>().value;
+
+      for(auto count = static_cast<std::size_t>(std::distance(first, last)); count >= SliceCount; count -= SliceCount)
+      {
+        std::uint32_t word { };
+
+        for(std::size_t index = 0U; index < 4U; ++index)
+        {
+          word = static_cast<std::uint32_t>(word << 8U) | static_cast<std::uint32_t>(static_cast<std::uint_fast8_t>((*first++) & UINT8_C(0xFF)));
+        }
+
+        word ^= crc;
+
+        crc =   table[SliceCount - 1U][static_cast<std::uint8_t>(word >> 24U)]
+              ^ table[SliceCount - 2U][static_cast<std::uint8_t>(word >> 16U)]
+              ^ table[SliceCount - 3U][static_cast<std::uint8_t>(word >>  8U)]
+              ^ table[SliceCount - 4U][static_cast<std::uint8_t>(word)];
+
+        for(std::size_t index = 4U; index < SliceCount; ++index)
+        {
+          crc ^= table[(SliceCount - 1U) - index][static_cast<std::uint_fast8_t>((*first++) & UINT8_C(0xFF))];
+        }
+      }
+
+      return detail::crc32_mpeg2_update_bytes(crc, first, last, table[0U]);
+    }
+  };
+
+  using crc32_mpeg2_engine_slice_by_8  = crc32_mpeg2_engine_slice<8U>;
+  using crc32_mpeg2_engine_slice_by_16 = crc32_mpeg2_engine_slice<16U>;
+
+  template<typename engine_type = crc32_mpeg2_engine_nibble,
+           typename input_iterator>
+  std::uint32_t crc32_mpeg2(input_iterator first,
+                            input_iterator last)
+  {
+    // Set the initial value and loop through the input data stream.
+    return engine_type::update(crc32_mpeg2_initial_value, first, last);
+  }
+
+  // Get the CRC32/MPEG2 of the concatenation of two sequences
+  // from their CRCs and the length of the second one in bytes.
+  inline auto crc32_mpeg2_combine(const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uintmax_t length_b) -> std::uint32_t
+  {
+    return crc32_mpeg2_crc_engine<8U>::combine(crc_a, crc_b, length_b);
+  }
+
   } } } // namespace math::checksums::crc
 
 #endif // CRC32_2015_01_26_H_
@@ -0,0 +1,215 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC32_CLMUL_2026_10_17_H
+  #define CRC32_CLMUL_2026_10_17_H
+
+  #include <math/checksums/crc/crc32.h>
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <iterator>
+  #include <type_traits>
+
+  #if (defined(__GNUC__) && defined(__x86_64__))
+  #define MATH_CHECKSUMS_CRC32_HAS_CLMUL
+  #include <immintrin.h>
+  #endif
+
+  namespace math { namespace checksums { namespace crc {
+
+  // The CRC32/MPEG2 with carry-less multiplication (PCLMULQDQ) on x86-64.
+  // The data stream is folded in blocks of 16 bytes with four parallel
+  // accumulators. Since only the remainder modulo the polynomial matters,
+  // each fold simply replaces A * x^n by the congruent sum of its two
+  // halves multiplied by the (32-bit) remainders of x^(n+64) and x^n.
+  // The final 128-bit accumulator and the tail of the stream are then
+  // reduced with the slice-by-16 engine.
+
+  // The engine is compiled with a function-specific target, so that no
+  // compiler flags are needed. It may only be called on a CPU that supports
+  // PCLMULQDQ and SSSE3, see crc32_mpeg2_engine_dispatch below, which
+  // does this check at run time.
+
+  namespace detail {
+
+  // Get x^exponent modulo the CRC32/MPEG2 polynomial.
+  constexpr auto crc32_mpeg2_x_pow_mod(const unsigned exponent) -> std::uint64_t
+  {
+    auto remainder = static_cast<std::uint32_t>(UINT8_C(1));
+
+    for(unsigned count = 0U; count < exponent; ++count)
+    {
+      remainder = (((remainder & UINT32_C(0x80000000)) != 0U) ? static_cast<std::uint32_t>((remainder << 1U) ^ crc32_mpeg2_polynomial)
+                                                              : static_cast<std::uint32_t>(remainder << 1U));
+    }
+
+    return static_cast<std::uint64_t>(remainder);
+  }
+
+  template<typename input_iterator>
+  struct crc32_mpeg2_is_byte_pointer
+    : std::integral_constant<bool,    std::is_pointer<input_iterator>::value
+                                   && (sizeof(typename std::iterator_traits<input_iterator>::value_type) == 1U)> { };
+
+  } // namespace detail
+
+  #if defined(MATH_CHECKSUMS_CRC32_HAS_CLMUL)
+
+  struct crc32_mpeg2_engine_clmul
+  {
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last) -> std::uint32_t
+    {
+      return update(crc, first, last, detail::crc32_mpeg2_is_byte_pointer<input_iterator>());
+    }
+
+    __attribute__((target("pclmul,ssse3")))
+    static auto update_bytes(std::uint32_t crc, const std::uint8_t* data, std::size_t count) -> std::uint32_t
+    {
+      constexpr auto block_size = static_cast<std::size_t>(UINT8_C(16));
+
+      if(count < (4U * block_size))
+      {
+        return crc32_mpeg2_engine_slice_by_16::update(crc, data, data + count); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      constexpr auto k128 = detail::crc32_mpeg2_x_pow_mod(128U);
+      constexpr auto k192 = detail::crc32_mpeg2_x_pow_mod(192U);
+      constexpr auto k512 = detail::crc32_mpeg2_x_pow_mod(512U);
+      constexpr auto k576 = detail::crc32_mpeg2_x_pow_mod(576U);
+
+      // The byte swap converts the stream into a big-endian 128-bit number,
+      // in which the first bit of the stream has the highest degree.
+      const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+      const __m128i fold_by_1 = _mm_set_epi64x(static_cast<long long>(k192), static_cast<long long>(k128));
+      const __m128i fold_by_4 = _mm_set_epi64x(static_cast<long long>(k576), static_cast<long long>(k512));
+
+      // The CRC register is added to the first 32 bits of the stream.
+      __m128i a0 = _mm_xor_si128(load(data, swap), _mm_set_epi32(static_cast<int>(crc), 0, 0, 0));
+      __m128i a1 = load(data + 16U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      __m128i a2 = load(data + 32U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      __m128i a3 = load(data + 48U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      data  += 4U * block_size; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      count -= 4U * block_size;
+
+      for( ; count >= (4U * block_size); count -= (4U * block_size))
+      {
+        a0 = fold(a0, fold_by_4, load(data, swap));
+        a1 = fold(a1, fold_by_4, load(data + 16U, swap)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        a2 = fold(a2, fold_by_4, load(data + 32U, swap)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        a3 = fold(a3, fold_by_4, load(data + 48U, swap)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        data += 4U * block_size; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      // Combine the four accumulators and fold the remaining whole blocks.
+      __m128i accumulator = fold(fold(fold(a0, fold_by_1, a1), fold_by_1, a2), fold_by_1, a3);
+
+      for( ; count >= block_size; count -= block_size)
+      {
+        accumulator = fold(accumulator, fold_by_1, load(data, swap));
+
+        data += block_size; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      // The CRC of the accumulator, starting from zero, is the CRC
+      // of the stream so far. Then continue with the tail.
+      alignas(16) std::uint8_t block[block_size]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      _mm_store_si128(reinterpret_cast<__m128i*>(block), _mm_shuffle_epi8(accumulator, swap)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+      crc = crc32_mpeg2_engine_slice_by_16::update(static_cast<std::uint32_t>(UINT8_C(0)), block, block + block_size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      return crc32_mpeg2_engine_slice_by_16::update(crc, data, data + count); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    static auto is_supported() -> bool
+    {
+      __builtin_cpu_init();
+
+      return (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3"));
+    }
+
+  private:
+    __attribute__((target("pclmul,ssse3")))
+    static auto load(const std::uint8_t* p, const __m128i swap) -> __m128i
+    {
+      return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), swap); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    __attribute__((target("pclmul,ssse3")))
+    static auto fold(const __m128i accumulator, const __m128i constants, const __m128i next) -> __m128i
+    {
+      return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(accumulator, constants, 0x11),
+                                         _mm_clmulepi64_si128(accumulator, constants, 0x00)),
+                           next);
+    }
+
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last, std::true_type) -> std::uint32_t
+    {
+      return update_bytes(crc, reinterpret_cast<const std::uint8_t*>(first), static_cast<std::size_t>(last - first)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last, std::false_type) -> std::uint32_t
+    {
+      return crc32_mpeg2_engine_slice_by_16::update(crc, first, last);
+    }
+  };
+
+  #endif // MATH_CHECKSUMS_CRC32_HAS_CLMUL
+
+  // The run-time dispatch selects the fastest engine that the CPU supports,
+  // once at the first call. Contiguous byte data are needed for the
+  // carry-less multiplication, all other inputs use the slice-by-16 engine.
+  struct crc32_mpeg2_engine_dispatch
+  {
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last) -> std::uint32_t
+    {
+      return update(crc, first, last, detail::crc32_mpeg2_is_byte_pointer<input_iterator>());
+    }
+
+    static auto uses_clmul() -> bool
+    {
+      #if defined(MATH_CHECKSUMS_CRC32_HAS_CLMUL)
+      static const bool is_supported = crc32_mpeg2_engine_clmul::is_supported();
+
+      return is_supported;
+      #else
+      return false;
+      #endif
+    }
+
+  private:
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last, std::true_type) -> std::uint32_t
+    {
+      #if defined(MATH_CHECKSUMS_CRC32_HAS_CLMUL)
+      if(uses_clmul())
+      {
+        return crc32_mpeg2_engine_clmul::update_bytes(crc, reinterpret_cast<const std::uint8_t*>(first), static_cast<std::size_t>(last - first)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      }
+      #endif
+
+      return crc32_mpeg2_engine_slice_by_16::update(crc, first, last);
+    }
+
+    template<typename input_iterator>
+    static auto update(std::uint32_t crc, input_iterator first, input_iterator last, std::false_type) -> std::uint32_t
+    {
+      return crc32_mpeg2_engine_slice_by_16::update(crc, first, last);
+    }
+  };
+
+  } } } // namespace math::checksums::crc
+
+#endif // CRC32_CLMUL_2026_10_17_H
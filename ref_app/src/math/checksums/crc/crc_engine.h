@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_ENGINE_2026_10_17_H
+  #define CRC_ENGINE_2026_10_17_H
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <type_traits>
+
+  namespace math { namespace checksums { namespace crc {
+
+  // A generic table-driven CRC, parametrized with the usual
+  // Rocksoft model (Width, Poly, Init, RefIn, RefOut, XorOut).
+  // Init and Poly are given in the non-reflected orientation
+  // as in the well-known catalogues of CRC parameters.
+
+  // The lookup table has 2^TableBits entries and is generated at
+  // compile time. Use TableBits = 8 (one lookup per byte) for speed,
+  // TableBits = 4 (one lookup per nibble) for small tables, and
+  // TableBits = 1 for a plain shifter with two table entries.
+
+  // The register is held in the orientation of the processing, that
+  // is reflected for RefIn. The value of the CRC is the register
+  // reflected once more if RefOut differs from RefIn and then
+  // exclusive-ored with XorOut.
+
+  namespace detail {
+
+  template<const unsigned Width, typename EnableType = void>
+  struct crc_value_type_helper
+  {
+    static_assert((Width >= 8U) && (Width <= 64U),
+                  "Error: crc_value_type_helper is not intended to be used for this Width");
+  };
+
+  template<const unsigned Width> struct crc_value_type_helper<Width, typename std::enable_if<(Width >=  8U) && (Width <=  8U)>::type> { using exact_unsigned_type = std::uint8_t;  };
+  template<const unsigned Width> struct crc_value_type_helper<Width, typename std::enable_if<(Width >=  9U) && (Width <= 16U)>::type> { using exact_unsigned_type = std::uint16_t; };
+  template<const unsigned Width> struct crc_value_type_helper<Width, typename std::enable_if<(Width >= 17U) && (Width <= 32U)>::type> { using exact_unsigned_type = std::uint32_t; };
+  template<const unsigned Width> struct crc_value_type_helper<Width, typename std::enable_if<(Width >= 33U) && (Width <= 64U)>::type> { using exact_unsigned_type = std::uint64_t; };
+
+  template<const unsigned Width>
+  constexpr auto crc_mask() -> std::uint64_t
+  {
+    return ((Width < 64U) ? static_cast<std::uint64_t>((UINT64_C(1) << (Width % 64U)) - 1U)
+                          : static_cast<std::uint64_t>(UINT64_C(0xFFFFFFFFFFFFFFFF)));
+  }
+
+  template<const unsigned Width>
+  constexpr auto crc_reflect(std::uint64_t value) -> std::uint64_t
+  {
+    std::uint64_t result { };
+
+    for(unsigned bit = 0U; bit < Width; ++bit)
+    {
+      result = static_cast<std::uint64_t>(result << 1U) | static_cast<std::uint64_t>(value & 1U);
+
+      value >>= 1U;
+    }
+
+    return result;
+  }
+
+  template<typename ValueType, const std::size_t TableSize>
+  struct crc_table
+  {
+    ValueType value[TableSize]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+  };
+
+  } // namespace detail
+
+  template<const unsigned      Width,
+           const std::uint64_t Poly,
+           const std::uint64_t Init,
+           const bool          RefIn,
+           const bool          RefOut,
+           const std::uint64_t XorOut,
+           const unsigned      TableBits = 8U>
+  class crc_engine
+  {
+  public:
+    static_assert((TableBits == 1U) || (TableBits == 2U) || (TableBits == 4U) || (TableBits == 8U),
+                  "Error: The number of table bits must be 1, 2, 4 or 8");
+
+    using value_type = typename detail::crc_value_type_helper<Width>::exact_unsigned_type;
+
+    static constexpr auto width = Width;
+
+    constexpr crc_engine() = default;
+
+    auto reset() noexcept -> void { my_register = initial_register(); }
+
+    template<typename input_iterator>
+    auto update(input_iterator first, input_iterator last) -> void
+    {
+      my_register = update_register(my_register, first, last);
+    }
+
+    auto value() const noexcept -> value_type { return finalize(my_register); }
+
+    template<typename input_iterator>
+    static auto compute(input_iterator first, input_iterator last) -> value_type
+    {
+      return finalize(update_register(initial_register(), first, last));
+    }
+
+    // The register functions are the raw building blocks, which can
+    // also be used to process a stream one byte at a time.
+    static constexpr auto initial_register() noexcept -> value_type
+    {
+      return static_cast<value_type>(RefIn ? detail::crc_reflect<Width>(Init) : (Init & detail::crc_mask<Width>()));
+    }
+
+    template<typename input_iterator>
+    static auto update_register(value_type reg, input_iterator first, input_iterator last) -> value_type
+    {
+      const auto& table = get_table().value;
+
+      for( ; first != last; ++first)
+      {
+        const auto the_byte = static_cast<std::uint_fast8_t>((*first) & UINT8_C(0xFF));
+
+        for(unsigned chunk = 0U; chunk < 8U; chunk += TableBits)
+        {
+          if(RefIn)
+          {
+            // Process the chunks of the byte beginning with the least significant one.
+            const auto index = static_cast<std::uint_fast8_t>((static_cast<std::uint_fast8_t>(reg) ^ static_cast<std::uint_fast8_t>(the_byte >> chunk)) & table_mask);
+
+            reg = static_cast<value_type>(shift_right(reg) ^ table[index]);
+          }
+          else
+          {
+            // Process the chunks of the byte beginning with the most significant one.
+            const auto index = static_cast<std::uint_fast8_t>((static_cast<std::uint_fast8_t>(reg >> (Width - TableBits)) ^ static_cast<std::uint_fast8_t>(the_byte >> ((8U - TableBits) - chunk))) & table_mask);
+
+            reg = static_cast<value_type>((shift_left(reg) & detail::crc_mask<Width>()) ^ table[index]);
+          }
+        }
+      }
+
+      return reg;
+    }
+
+    static constexpr auto finalize(const value_type reg) noexcept -> value_type
+    {
+      return static_cast<value_type>(((RefIn != RefOut) ? detail::crc_reflect<Width>(reg) : reg) ^ (XorOut & detail::crc_mask<Width>()));
+    }
+
+    // Get the CRC of the concatenation of two sequences A and B from
+    // the CRC of A, the CRC of B and the length of B in bytes. This
+    // allows for the CRC of a stream to be computed in parallel chunks.
+    static auto combine(const value_type crc_a, const value_type crc_b, const std::uintmax_t length_b) -> value_type
+    {
+      // The register of the non-reflected algorithm after a sequence
+      // of n bytes is r(n) = Init * x^(8n) + M * x^Width (mod Poly).
+      // So r(AB) = (r(A) + Init) * x^(8 n_B) + r(B), (mod Poly).
+
+      const auto r_a = to_polynomial(crc_a);
+      const auto r_b = to_polynomial(crc_b);
+
+      const auto r_ab = multiply_mod(r_a ^ (Init & detail::crc_mask<Width>()), x_pow_8n_mod(length_b)) ^ r_b;
+
+      return static_cast<value_type>((RefOut ? detail::crc_reflect<Width>(r_ab) : r_ab) ^ (XorOut & detail::crc_mask<Width>()));
+    }
+
+    // The register counterpart of combine(). Here, reg_a is the register
+    // after the sequence A and reg_b is the register after the sequence B
+    // started from a zero register. The result is the register after the
+    // sequence AB, so chunks can be processed independently and merged.
+    static auto combine_register(const value_type reg_a, const value_type reg_b, const std::uintmax_t length_b) -> value_type
+    {
+      // The update is linear: r(A, B) = r(A) * x^(8 n_B) + r(0, B), (mod Poly).
+      const auto r_a = static_cast<std::uint64_t>(RefIn ? detail::crc_reflect<Width>(reg_a) : reg_a);
+
+      const auto r_ab = multiply_mod(r_a, x_pow_8n_mod(length_b));
+
+      return static_cast<value_type>((RefIn ? detail::crc_reflect<Width>(r_ab) : r_ab) ^ reg_b);
+    }
+
+  private:
+    static constexpr auto table_size = static_cast<std::size_t>(1ULL << TableBits);
+    static constexpr auto table_mask = static_cast<std::uint_fast8_t>(table_size - 1U);
+
+    using table_type = detail::crc_table<value_type, table_size>;
+
+    value_type my_register { initial_register() };
+
+    static constexpr auto shift_left (const value_type reg) noexcept -> std::uint64_t { return ((TableBits < Width) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(reg) << (TableBits % Width)) : static_cast<std::uint64_t>(UINT8_C(0))); }
+    static constexpr auto shift_right(const value_type reg) noexcept -> std::uint64_t { return ((TableBits < Width) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(reg) >> (TableBits % Width)) : static_cast<std::uint64_t>(UINT8_C(0))); }
+
+    static constexpr auto make_table() -> table_type
+    {
+      table_type table { };
+
+      constexpr auto top_bit = static_cast<std::uint64_t>(UINT64_C(1) << (Width - 1U));
+
+      constexpr auto poly_reflected = detail::crc_reflect<Width>(Poly);
+
+      for(std::size_t index = 0U; index < table_size; ++index)
+      {
+        auto reg = static_cast<std::uint64_t>(RefIn ? index : static_cast<std::uint64_t>(static_cast<std::uint64_t>(index) << (Width - TableBits)));
+
+        for(unsigned bit = 0U; bit < TableBits; ++bit)
+        {
+          if(RefIn)
+          {
+            reg = (((reg & 1U) != 0U) ? static_cast<std::uint64_t>((reg >> 1U) ^ poly_reflected) : static_cast<std::uint64_t>(reg >> 1U));
+          }
+          else
+          {
+            reg = (((reg & top_bit) != 0U) ? static_cast<std::uint64_t>((reg << 1U) ^ Poly) : static_cast<std::uint64_t>(reg << 1U));
+          }
+        }
+
+        table.value[index] = static_cast<value_type>(reg & detail::crc_mask<Width>());
+      }
+
+      return table;
+    }
+
+    static auto get_table() -> const table_type&
+    {
+      static constexpr table_type table = make_table();
+
+      return table;
+    }
+
+    // Get the polynomial remainder of a CRC value, which is the
+    // register of the non-reflected algorithm.
+    static constexpr auto to_polynomial(const value_type crc) noexcept -> std::uint64_t
+    {
+      return (RefOut ? detail::crc_reflect<Width>(crc ^ (XorOut & detail::crc_mask<Width>()))
+                     : static_cast<std::uint64_t>(crc ^ (XorOut & detail::crc_mask<Width>())));
+    }
+
+    // Compute x^(8 n) (mod Poly) by repeated squaring of x^8.
+    static auto x_pow_8n_mod(std::uintmax_t length) noexcept -> std::uint64_t
+    {
+      std::uint64_t x_pow { static_cast<std::uint64_t>(UINT8_C(1)) };
+      std::uint64_t x_sqr { multiply_mod(static_cast<std::uint64_t>(UINT8_C(0x10)), static_cast<std::uint64_t>(UINT8_C(0x10))) };
+
+      for( ; length != 0U; length >>= 1U)
+      {
+        if((length & 1U) != 0U) { x_pow = multiply_mod(x_pow, x_sqr); }
+
+        x_sqr = multiply_mod(x_sqr, x_sqr);
+      }
+
+      return x_pow;
+    }
+
+    // Multiply two polynomial remainders modulo Poly (non-reflected).
+    static constexpr auto multiply_mod(const std::uint64_t a, const std::uint64_t b) noexcept -> std::uint64_t
+    {
+      constexpr auto top_bit = static_cast<std::uint64_t>(UINT64_C(1) << (Width - 1U));
+
+      std::uint64_t result { };
+
+      for(unsigned bit = Width; bit-- > 0U; )
+      {
+        result = ((((result & top_bit) != 0U) ? static_cast<std::uint64_t>((result << 1U) ^ Poly) : static_cast<std::uint64_t>(result << 1U)) & detail::crc_mask<Width>());
+
+        if(((a >> bit) & 1U) != 0U) { result ^= b; }
+      }
+
+      return result;
+    }
+  };
+
+  } } } // namespace math::checksums::crc
+
+#endif // CRC_ENGINE_2026_10_17_H
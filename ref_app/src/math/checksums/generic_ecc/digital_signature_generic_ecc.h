@@ -29,7 +29,8 @@ namespace generic_ecc
            const char* CoordGy,
            const char* SubGroupOrderN,
            const int   SubGroupCoFactorH,
-           typename HashType>
+           typename HashType,
+           template<typename, const char*> class FieldType = ecc_field_special_prime>
   class digital_signature_generic_ecc : public ecc_elliptic_curve<CurveBits,
                                                                   LimbType,
                                                                   CurveName,
@@ -40,7 +41,8 @@ namespace generic_ecc
                                                                   CoordGy,
                                                                   SubGroupOrderN,
                                                                   SubGroupCoFactorH,
-                                                                  HashType>,
+                                                                  HashType,
+                                                                  FieldType>,
                                         public digital_signature_base
   {
   private:
@@ -54,7 +56,8 @@ namespace generic_ecc
                                                             CoordGy,
                                                             SubGroupOrderN,
                                                             SubGroupCoFactorH,
-                                                            HashType>;
+                                                            HashType,
+                                                            FieldType>;
 
     using hash_type = typename ecc_elliptic_curve_base_type::hash_type;
 
@@ -278,12 +281,116 @@ namespace generic_ecc
       return result_verify_is_ok;
     }
 
+    // One item of a batch verification: a message, its signature
+    // and the public key of the signer.
+    struct verify_batch_item_type
+    {
+      const std::uint8_t* message_data    { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::size_t         message_size    { };         // NOLINT(misc-non-private-member-variables-in-classes)
+      const std::uint8_t* signature_data  { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+      const std::uint8_t* public_key_data { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    // Verify the items [items, items + count) and store the result of
+    // each item in results. The signatures share their inversions, see
+    // verify_signature_batch_ph(). Return true if all of them are valid.
+    auto verify_batch(const verify_batch_item_type* items,
+                      const std::size_t             count,
+                            bool*                   results) const -> bool
+    {
+      verify_batch_range(items, count, results);
+
+      return std::all_of(results, results + count, [](const bool result_is_ok) { return result_is_ok; });
+    }
+
+    // Verify the items in partition_count partitions of the batch. The
+    // executor is called with executor(partition_count, task), and it
+    // must call task(partition) for each partition, for instance in
+    // parallel threads, before it returns. See also util_thread_executor.h.
+    template<typename ExecutorType>
+    auto verify_batch(const verify_batch_item_type* items,
+                      const std::size_t             count,
+                            bool*                   results,
+                      const std::size_t             partition_count,
+                            ExecutorType&&          executor) const -> bool
+    {
+      const auto partitions = (std::max)(static_cast<std::size_t>(UINT8_C(1)), (std::min)(partition_count, count));
+
+      executor
+      (
+        partitions,
+        [this, items, count, results, partitions](const std::size_t partition)
+        {
+          const auto first = static_cast<std::size_t>((count *  partition)       / partitions);
+          const auto last  = static_cast<std::size_t>((count * (partition + 1U)) / partitions);
+
+          verify_batch_range(items + first, static_cast<std::size_t>(last - first), results + first);
+        }
+      );
+
+      return std::all_of(results, results + count, [](const bool result_is_ok) { return result_is_ok; });
+    }
+
     auto get_public_key_size() const -> std::size_t override { return my_public_key_size(); }
     auto get_secret_key_size() const -> std::size_t override { return my_secret_key_size(); }
     auto get_signature_size () const -> std::size_t override { return my_signature_size(); }
 
   private:
     hash_type my_hash { };
+
+    static auto import_pair(const std::uint8_t* data, const std::size_t size, std::pair<uint_type, uint_type>& values) -> void
+    {
+      static_cast<void>
+      (
+        import_bits(values.first, data + static_cast<std::size_t>(UINT8_C(0)), data + static_cast<std::size_t>(size / static_cast<std::size_t>(UINT8_C(2))))
+      );
+
+      static_cast<void>
+      (
+        import_bits(values.second, data + static_cast<std::size_t>(size / static_cast<std::size_t>(UINT8_C(2))), data + size)
+      );
+    }
+
+    static auto verify_batch_range(const verify_batch_item_type* items,
+                                   const std::size_t             count,
+                                         bool*                   results) -> void
+    {
+      constexpr auto group_size = ecc_elliptic_curve_base_type::verify_batch_size;
+
+      std::array<std::pair<uint_type, uint_type>, group_size> pub_values { };
+      std::array<std::pair<uint_type, uint_type>, group_size> sig_values { };
+      std::array<uint_type, group_size>                       z_msg_hashes { };
+
+      for(auto first = static_cast<std::size_t>(UINT8_C(0)); first < count; first += group_size)
+      {
+        const auto group_count = (std::min)(group_size, static_cast<std::size_t>(count - first));
+
+        for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < group_count; ++index)
+        {
+          const auto& item = items[first + index];
+
+          import_pair(item.public_key_data, my_public_key_size(), pub_values[index]);
+          import_pair(item.signature_data,  my_signature_size(),  sig_values[index]);
+
+          hash_type hash_object { };
+
+          hash_object.initialize();
+          hash_object.process(item.message_data, static_cast<typename hash_type::count_type>(item.message_size));
+          hash_object.finalize();
+
+          typename hash_type::result_type hash_result { };
+
+          hash_object.get_result(hash_result.data());
+
+          static_cast<void>
+          (
+            import_bits(z_msg_hashes[index], hash_result.cbegin(), hash_result.cend())
+          );
+        }
+
+        ecc_elliptic_curve_base_type::verify_signature_batch_ph(pub_values.data(), z_msg_hashes.data(), sig_values.data(), group_count, results + first);
+      }
+    }
   };
 } // namespace generic_ecc
 
@@ -49,20 +49,23 @@ THE SOFTWARE.
 #ifndef ECC_ELLIPTIC_CURVE_2023_02_18_H
 #define ECC_ELLIPTIC_CURVE_2023_02_18_H
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 
-#define WIDE_INTEGER_DISABLE_IOSTREAM
-#define WIDE_INTEGER_DISABLE_TO_STRING
-#define WIDE_INTEGER_DISABLE_IMPLEMENT_UTIL_DYNAMIC_ARRAY
-#define WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS
+#include <math/checksums/generic_ecc/ecc_field.h>
 
-#if !defined(WIDE_INTEGER_NAMESPACE)
-#define WIDE_INTEGER_NAMESPACE ckormanyos
+// The number of signatures that share their inversions in a batch
+// verification. Each one costs a table of odd multiples of its public
+// key on the stack, so small targets can set this to 1.
+#if !defined(GENERIC_ECC_VERIFY_BATCH_SIZE)
+#define GENERIC_ECC_VERIFY_BATCH_SIZE 16
 #endif
 
-#include <math/wide_integer/uintwide_t.h>
-
 namespace generic_ecc
 {
   template<const unsigned CurveBits,
@@ -103,7 +106,8 @@ namespace generic_ecc
            const char* CoordGy,
            const char* SubGroupOrderN,
            const int   SubGroupCoFactorH,
-           typename HashType>
+           typename HashType,
+           template<typename, const char*> class FieldType = ecc_field_special_prime>
   struct ecc_elliptic_curve : public ecc_point<CurveBits, LimbType, CoordGx, CoordGy>
   {
     using hash_type = HashType;
@@ -117,6 +121,8 @@ namespace generic_ecc
 
     using keypair_type = std::pair<uint_type, std::pair<uint_type, uint_type>>;
 
+    using field_type = FieldType<uint_type, FieldCharacteristicP>;
+
     using quadruple_sint_type   = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(4))),  limb_type, void, true>;
     using sexatuple_sint_type   = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(6))),  limb_type, void, true>;
     using duodectuple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(12))), limb_type, void, true>;
@@ -265,49 +271,509 @@ namespace generic_ecc
       };
     }
 
-    static auto scalar_mult(const double_sint_type& k, const point_type& point) -> point_type // NOLINT(misc-no-recursion)
+    // Field arithmetic modulo p. The field elements are held in the
+    // form of the field_type, which is generic or Montgomery form, see
+    // ecc_field.h. The coordinates are converted with to_field() and
+    // from_field() at the boundaries of the point arithmetic.
+
+    static auto field_a() -> const uint_type&
     {
-      // Returns k * point computed using the double and point_add algorithm.
+      static const uint_type my_a = field_type::to_field(uint_type(CurveCoefficientA)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
 
-      if(((k % curve_n()) == 0) || ((point.my_x == 0) && (point.my_y == 0)))
+      return my_a;
+    }
+
+    static auto field_add(const uint_type& a, const uint_type& b) -> uint_type { return field_type::add(a, b); }
+    static auto field_sub(const uint_type& a, const uint_type& b) -> uint_type { return field_type::subtract(a, b); }
+    static auto field_mul(const uint_type& a, const uint_type& b) -> uint_type { return field_type::multiply(a, b); }
+    static auto field_sqr(const uint_type& a)                     -> uint_type { return field_type::square(a); }
+
+    static auto field_inv(const uint_type& a) -> uint_type
+    {
+      return field_type::to_field(uint_type(inverse_mod(double_sint_type(field_type::from_field(a)), curve_p())));
+    }
+
+    // Points in Jacobian coordinates (X, Y, Z) represent the affine
+    // point (X / Z^2, Y / Z^3). The point at infinity has Z = 0.
+    // Additions and doublings need no inversion, so that a scalar
+    // multiplication needs only one single inversion at the end.
+
+    struct affine_point_type
+    {
+      uint_type my_x { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_y { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    struct jacobian_point_type
+    {
+      uint_type my_x { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_y { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_z { }; // NOLINT(misc-non-private-member-variables-in-classes)
+
+      auto is_infinity() const -> bool { return (my_z == 0U); }
+    };
+
+    static auto to_jacobian(const affine_point_type& point) -> jacobian_point_type
+    {
+      return { point.my_x, point.my_y, field_type::one() };
+    }
+
+    static auto to_affine(const jacobian_point_type& point) -> point_type
+    {
+      if(point.is_infinity())
       {
         return point_type { }; // LCOV_EXCL_LINE
       }
 
-      if(k < 0)
+      const auto z_inv  = field_inv(point.my_z);
+      const auto z_inv2 = field_sqr(z_inv);
+
+      return
       {
-        // k * point = -k * (-point)
-        return scalar_mult(-k, point_neg(point)); // LCOV_EXCL_LINE
+        double_sint_type(field_type::from_field(field_mul(point.my_x, z_inv2))),
+        double_sint_type(field_type::from_field(field_mul(point.my_y, field_mul(z_inv2, z_inv))))
+      };
+    }
+
+    // Convert points, none of which is at infinity, to affine coordinates
+    // with a single inversion (Montgomery's simultaneous inversion).
+    template<typename InputIterator,
+             typename OutputIterator>
+    static auto to_affine_batch(InputIterator first, InputIterator last, OutputIterator result) -> void
+    {
+      if(first == last)
+      {
+        return; // LCOV_EXCL_LINE
       }
 
-      point_type result { };
-      point_type addend = point;
+      // Store the running products of the Z-coordinates in the results.
+      auto z_product = field_type::one();
 
-      double_sint_type k_val(k);
+      auto out = result;
 
-      while(k_val != 0) // NOLINT(altera-id-dependent-backward-branch)
+      for(auto it = first; it != last; ++it)
       {
-        const auto lo_bit =
-          static_cast<unsigned>
-          (
-            static_cast<unsigned>(k_val) & static_cast<unsigned>(UINT8_C(1))
-          );
+        z_product = field_mul(z_product, it->my_z);
+
+        out->my_x = z_product;
+
+        ++out;
+      }
+
+      auto z_product_inv = field_inv(z_product);
+
+      // Walk back to undo the running products one after the other.
+      for(auto it = last; it != first; )
+      {
+        --it;
+        --out;
+
+        auto z_inv = z_product_inv;
+
+        if(it != first)
+        {
+          auto out_previous = out;
+
+          --out_previous;
+
+          z_inv = field_mul(z_product_inv, out_previous->my_x);
+
+          z_product_inv = field_mul(z_product_inv, it->my_z);
+        }
+
+        const auto z_inv2 = field_sqr(z_inv);
+
+        out->my_x = field_mul(it->my_x, z_inv2);
+        out->my_y = field_mul(it->my_y, field_mul(z_inv2, z_inv));
+      }
+    }
+
+    static auto point_double_jacobian(const jacobian_point_type& point) -> jacobian_point_type
+    {
+      if(point.is_infinity() || (point.my_y == 0U))
+      {
+        return jacobian_point_type { }; // LCOV_EXCL_LINE
+      }
+
+      constexpr auto a_is_zero = (uint_type(CurveCoefficientA) == 0U); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      const auto yy = field_sqr(point.my_y);
+
+      // s = 4 * x * y^2, m = 3 * x^2 + a * z^4
+      const auto s  = field_mul(field_add(point.my_x, point.my_x), field_add(yy, yy));
+
+      const auto xx = field_sqr(point.my_x);
+
+      auto m = field_add(field_add(xx, xx), xx);
+
+      if(!a_is_zero)
+      {
+        m = field_add(m, field_mul(field_a(), field_sqr(field_sqr(point.my_z))));
+      }
+
+      const auto x3 = field_sub(field_sqr(m), field_add(s, s));
+
+      const auto yyyy_2 = field_sqr(field_add(yy, yy));
+
+      // y3 = m * (s - x3) - 8 * y^4, z3 = 2 * y * z
+      const auto y3 = field_sub(field_mul(m, field_sub(s, x3)), field_add(yyyy_2, yyyy_2));
+
+      const auto z3 = field_mul(field_add(point.my_y, point.my_y), point.my_z);
+
+      return { x3, y3, z3 };
+    }
+
+    // Add an affine point (mixed addition), which saves several multiplications.
+    static auto point_add_mixed(const jacobian_point_type& point1, const affine_point_type& point2) -> jacobian_point_type
+    {
+      if(point1.is_infinity())
+      {
+        return to_jacobian(point2);
+      }
+
+      const auto z1z1 = field_sqr(point1.my_z);
+
+      const auto h = field_sub(field_mul(point2.my_x, z1z1), point1.my_x);
+      const auto r = field_sub(field_mul(point2.my_y, field_mul(point1.my_z, z1z1)), point1.my_y);
+
+      if(h == 0U)
+      {
+        return ((r == 0U) ? point_double_jacobian(point1) : jacobian_point_type { }); // LCOV_EXCL_LINE
+      }
+
+      const auto hh  = field_sqr(h);
+      const auto hhh = field_mul(h, hh);
+      const auto v   = field_mul(point1.my_x, hh);
+
+      const auto x3 = field_sub(field_sub(field_sqr(r), hhh), field_add(v, v));
+      const auto y3 = field_sub(field_mul(r, field_sub(v, x3)), field_mul(point1.my_y, hhh));
+      const auto z3 = field_mul(point1.my_z, h);
+
+      return { x3, y3, z3 };
+    }
+
+    static auto point_add_jacobian(const jacobian_point_type& point1, const jacobian_point_type& point2) -> jacobian_point_type
+    {
+      if(point1.is_infinity()) { return point2; }
+      if(point2.is_infinity()) { return point1; } // LCOV_EXCL_LINE
+
+      const auto z1z1 = field_sqr(point1.my_z);
+      const auto z2z2 = field_sqr(point2.my_z);
+
+      const auto u1 = field_mul(point1.my_x, z2z2);
+      const auto u2 = field_mul(point2.my_x, z1z1);
+      const auto s1 = field_mul(point1.my_y, field_mul(point2.my_z, z2z2));
+      const auto s2 = field_mul(point2.my_y, field_mul(point1.my_z, z1z1));
+
+      const auto h = field_sub(u2, u1);
+      const auto r = field_sub(s2, s1);
+
+      if(h == 0U)
+      {
+        return ((r == 0U) ? point_double_jacobian(point1) : jacobian_point_type { }); // LCOV_EXCL_LINE
+      }
+
+      const auto hh  = field_sqr(h);
+      const auto hhh = field_mul(h, hh);
+      const auto v   = field_mul(u1, hh);
+
+      const auto x3 = field_sub(field_sub(field_sqr(r), hhh), field_add(v, v));
+      const auto y3 = field_sub(field_mul(r, field_sub(v, x3)), field_mul(s1, hhh));
+      const auto z3 = field_mul(field_mul(point1.my_z, point2.my_z), h);
+
+      return { x3, y3, z3 };
+    }
+
+    // Scalar multiplication of an arbitrary point with the width-w
+    // non-adjacent form (wNAF) of the scalar. The odd multiples P, 3P,
+    // ..., (2^(w-1) - 1)P are precomputed in affine coordinates.
+    // Note: The run time depends on the scalar (not constant-time).
+
+    static constexpr auto wnaf_window = static_cast<unsigned>(UINT8_C(4));
+
+    using wnaf_digits_type = std::array<std::int8_t, static_cast<std::size_t>(CurveBits + 1U)>;
+
+    template<const unsigned Window>
+    using wnaf_multiples_type = std::array<jacobian_point_type, static_cast<std::size_t>(1U << (Window - 2U))>;
+
+    using wnaf_table_type = std::array<affine_point_type, static_cast<std::size_t>(1U << (wnaf_window - 2U))>;
+
+    static auto scalar_bits(const uint_type& k, const unsigned position, const unsigned count) -> unsigned
+    {
+      constexpr auto limb_bits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
+
+      auto bits = static_cast<unsigned>(UINT8_C(0));
+
+      for(auto index = static_cast<unsigned>(UINT8_C(0)); index < count; ++index)
+      {
+        const auto bit_position = static_cast<unsigned>(position + index);
 
-        if(lo_bit != static_cast<unsigned>(UINT8_C(0)))
+        if(bit_position < CurveBits)
         {
-          // Add.
-          result = point_add(result, addend);
+          const auto limb = k.crepresentation()[static_cast<std::size_t>(bit_position / limb_bits)];
+
+          bits |= static_cast<unsigned>(static_cast<unsigned>(static_cast<limb_type>(limb >> static_cast<unsigned>(bit_position % limb_bits)) & 1U) << index);
+        }
+      }
+
+      return bits;
+    }
+
+    template<const unsigned Window>
+    static auto wnaf_recode(const uint_type& k, wnaf_digits_type& digits) -> void
+    {
+      // Scan the scalar from the least significant bit upwards and carry
+      // into the next window when a digit becomes negative.
+
+      digits.fill(static_cast<std::int8_t>(INT8_C(0)));
+
+      auto carry = static_cast<unsigned>(UINT8_C(0));
+
+      for(auto position = static_cast<unsigned>(UINT8_C(0)); position < static_cast<unsigned>(digits.size()); )
+      {
+        if(scalar_bits(k, position, 1U) == carry)
+        {
+          ++position;
+
+          continue;
         }
 
-        // Double.
-        addend = point_add(addend, addend);
+        auto word = static_cast<int>(scalar_bits(k, position, Window) + carry);
+
+        carry = static_cast<unsigned>((static_cast<unsigned>(word) >> (Window - 1U)) & 1U);
+
+        word -= static_cast<int>(carry << Window);
+
+        digits[static_cast<std::size_t>(position)] = static_cast<std::int8_t>(word);
+
+        position += Window;
+      }
+    }
+
+    // The odd multiples P, 3P, ..., (2^(Window - 1) - 1)P of the point.
+    template<const unsigned Window>
+    static auto wnaf_multiples(const affine_point_type& point) -> wnaf_multiples_type<Window>
+    {
+      wnaf_multiples_type<Window> multiples { };
+
+      multiples.front() = to_jacobian(point);
+
+      const auto point_twice = point_double_jacobian(multiples.front());
 
-        k_val >>= static_cast<unsigned>(UINT8_C(1));
+      for(auto index = static_cast<std::size_t>(UINT8_C(1)); index < multiples.size(); ++index)
+      {
+        multiples[index] = point_add_jacobian(multiples[index - 1U], point_twice);
+      }
+
+      return multiples;
+    }
+
+    // Add the odd multiple of the point that belongs to the wNAF digit.
+    template<typename TableType>
+    static auto point_add_wnaf_digit(const jacobian_point_type& point, const TableType& table, const int digit) -> jacobian_point_type
+    {
+      if(digit > 0)
+      {
+        return point_add_mixed(point, table[static_cast<std::size_t>(digit / 2)]);
+      }
+
+      if(digit < 0)
+      {
+        const auto& addend = table[static_cast<std::size_t>((-digit) / 2)];
+
+        return point_add_mixed(point, { addend.my_x, field_sub(uint_type(static_cast<unsigned>(UINT8_C(0))), addend.my_y) });
+      }
+
+      return point;
+    }
+
+    static auto scalar_mult_wnaf(const uint_type& k, const affine_point_type& point) -> jacobian_point_type
+    {
+      const auto multiples = wnaf_multiples<wnaf_window>(point);
+
+      wnaf_table_type table { };
+
+      to_affine_batch(multiples.cbegin(), multiples.cend(), table.begin());
+
+      wnaf_digits_type digits { };
+
+      wnaf_recode<wnaf_window>(k, digits);
+
+      jacobian_point_type result { };
+
+      for(auto position = digits.size(); position-- > 0U; )
+      {
+        result = point_double_jacobian(result);
+
+        result = point_add_wnaf_digit(result, table, static_cast<int>(digits[position]));
       }
 
       return result;
     }
 
+    // Calculate u1 * G + u2 * Q with Shamir's trick: the wNAF digits of
+    // both scalars are added in one common chain of doublings. The odd
+    // multiples of G for a wider window are computed once, at their first
+    // use. The odd multiples of Q are given in affine coordinates.
+
+    static constexpr auto wnaf_window_base = static_cast<unsigned>(UINT8_C(6));
+
+    using wnaf_table_base_type = std::array<affine_point_type, static_cast<std::size_t>(1U << (wnaf_window_base - 2U))>;
+
+    static auto wnaf_table_base() -> const wnaf_table_base_type&
+    {
+      static const wnaf_table_base_type table = make_wnaf_table_base();
+
+      return table;
+    }
+
+    static auto make_wnaf_table_base() -> wnaf_table_base_type
+    {
+      const auto multiples = wnaf_multiples<wnaf_window_base>({ field_type::to_field(uint_type(CoordGx)), field_type::to_field(uint_type(CoordGy)) }); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      wnaf_table_base_type table { };
+
+      to_affine_batch(multiples.cbegin(), multiples.cend(), table.begin());
+
+      return table;
+    }
+
+    static auto scalar_mult_shamir(const uint_type& u1, const uint_type& u2, const affine_point_type* table_q) -> jacobian_point_type
+    {
+      const auto& table_g = wnaf_table_base();
+
+      wnaf_digits_type digits_g { };
+      wnaf_digits_type digits_q { };
+
+      wnaf_recode<wnaf_window_base>(u1, digits_g);
+      wnaf_recode<wnaf_window>     (u2, digits_q);
+
+      jacobian_point_type result { };
+
+      for(auto position = digits_g.size(); position-- > 0U; )
+      {
+        result = point_double_jacobian(result);
+
+        result = point_add_wnaf_digit(result, table_g, static_cast<int>(digits_g[position]));
+        result = point_add_wnaf_digit(result, table_q, static_cast<int>(digits_q[position]));
+      }
+
+      return result;
+    }
+
+    // Scalar multiplication of the generator G with the comb method
+    // (Lim-Lee). The scalar is split into comb_teeth rows of comb_spacing
+    // bits. The table holds all sums of the multiples 2^(j * comb_spacing) G,
+    // one for each combination of the rows. One column of bits of the scalar
+    // then selects one entry, so that only comb_spacing doublings and
+    // additions are needed. The table is computed once, at its first use.
+
+    static constexpr auto comb_teeth   = static_cast<unsigned>(UINT8_C(4));
+    static constexpr auto comb_spacing = static_cast<unsigned>((CurveBits + (comb_teeth - 1U)) / comb_teeth);
+
+    using comb_table_type = std::array<affine_point_type, static_cast<std::size_t>((1U << comb_teeth) - 1U)>;
+
+    static auto comb_table() -> const comb_table_type&
+    {
+      static const comb_table_type table = make_comb_table();
+
+      return table;
+    }
+
+    static auto make_comb_table() -> comb_table_type
+    {
+      std::array<jacobian_point_type, std::tuple_size<comb_table_type>::value> sums { };
+
+      // The entry with the index (b - 1) holds the sum for the combination b.
+      auto row_point = to_jacobian({ field_type::to_field(uint_type(CoordGx)), field_type::to_field(uint_type(CoordGy)) }); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      for(auto tooth = static_cast<unsigned>(UINT8_C(0)); tooth < comb_teeth; ++tooth)
+      {
+        const auto row_bit = static_cast<unsigned>(1U << tooth);
+
+        sums[static_cast<std::size_t>(row_bit - 1U)] = row_point;
+
+        for(auto lower = static_cast<unsigned>(UINT8_C(1)); lower < row_bit; ++lower)
+        {
+          sums[static_cast<std::size_t>((row_bit + lower) - 1U)] = point_add_jacobian(sums[static_cast<std::size_t>(lower - 1U)], row_point);
+        }
+
+        for(auto doubling = static_cast<unsigned>(UINT8_C(0)); doubling < comb_spacing; ++doubling)
+        {
+          row_point = point_double_jacobian(row_point);
+        }
+      }
+
+      comb_table_type table { };
+
+      to_affine_batch(sums.cbegin(), sums.cend(), table.begin());
+
+      return table;
+    }
+
+    static auto scalar_mult_base_jacobian(const uint_type& k) -> jacobian_point_type
+    {
+      const auto& table = comb_table();
+
+      jacobian_point_type result { };
+
+      for(auto column = comb_spacing; column-- > 0U; )
+      {
+        result = point_double_jacobian(result);
+
+        auto combination = static_cast<unsigned>(UINT8_C(0));
+
+        for(auto tooth = static_cast<unsigned>(UINT8_C(0)); tooth < comb_teeth; ++tooth)
+        {
+          combination |= static_cast<unsigned>(scalar_bits(k, static_cast<unsigned>((tooth * comb_spacing) + column), 1U) << tooth);
+        }
+
+        if(combination != 0U)
+        {
+          result = point_add_mixed(result, table[static_cast<std::size_t>(combination - 1U)]);
+        }
+      }
+
+      return result;
+    }
+
+    static auto scalar_to_uint(const double_sint_type& k) -> uint_type
+    {
+      // The scalar is reduced modulo the order n only when it is too wide.
+      return
+        uint_type
+        (
+          (k > double_sint_type((std::numeric_limits<uint_type>::max)())) ? divmod(k, curve_n()).second : k
+        );
+    }
+
+    static auto scalar_mult(const double_sint_type& k, const point_type& point) -> point_type // NOLINT(misc-no-recursion)
+    {
+      // Returns k * point computed in Jacobian coordinates using the wNAF
+      // of the scalar. The generator uses the precomputed comb table.
+
+      if(((k % curve_n()) == 0) || ((point.my_x == 0) && (point.my_y == 0)))
+      {
+        return point_type { }; // LCOV_EXCL_LINE
+      }
+
+      if(k < 0)
+      {
+        // k * point = -k * (-point)
+        return scalar_mult(-k, point_neg(point)); // LCOV_EXCL_LINE
+      }
+
+      if((point.my_x == curve_gx()) && (point.my_y == curve_gy()))
+      {
+        return to_affine(scalar_mult_base_jacobian(scalar_to_uint(k)));
+      }
+
+      // The y-coordinate of a negated point can be negative.
+      const auto y = ((point.my_y < 0) ? double_sint_type(point.my_y + curve_p()) : point.my_y);
+
+      return to_affine(scalar_mult_wnaf(scalar_to_uint(k), { field_type::to_field(uint_type(point.my_x)), field_type::to_field(uint_type(y)) }));
+    }
+
     template<typename UnknownWideUintType>
     static auto get_pseudo_random_uint() -> UnknownWideUintType
     {
@@ -342,7 +808,7 @@ namespace generic_ecc
           (p_uint_seed == nullptr) ? get_pseudo_random_uint<uint_type>() : *p_uint_seed
         );
 
-      const auto public_key  = scalar_mult(private_key, { curve_gx(), curve_gy() } );
+      const auto public_key  = to_affine(scalar_mult_base_jacobian(private_key));
 
       return
       {
@@ -376,7 +842,7 @@ namespace generic_ecc
             (p_uint_seed == nullptr) ? static_cast<double_sint_type>(get_pseudo_random_uint<uint_type>()) : static_cast<double_sint_type>(*p_uint_seed)
           );
 
-        const auto pt = scalar_mult(k, { curve_gx(), curve_gy() } );
+        const auto pt = to_affine(scalar_mult_base_jacobian(scalar_to_uint(k)));
 
         r = divmod(pt.my_x, curve_n()).second;
 
@@ -400,26 +866,212 @@ namespace generic_ecc
                                     const uint_type&                       z_msg_hash,
                                     const std::pair<uint_type, uint_type>& sig) -> bool
     {
-      const auto w = quadruple_sint_type(inverse_mod(sig.second, curve_n()));
+      // A single signature needs only one table of the odd multiples
+      // of its public key and none of the arrays of the batch path.
+      affine_point_type point_q { };
 
-      const auto n = quadruple_sint_type(curve_n());
+      if(!is_valid_signature_input(pub, sig, point_q))
+      {
+        return false;
+      }
 
-      const auto u1 = double_sint_type(divmod(quadruple_sint_type(z_msg_hash) * w, n).second);
-      const auto u2 = double_sint_type(divmod(quadruple_sint_type(sig.first)  * w, n).second);
+      const auto w = uint_type(inverse_mod(double_sint_type(sig.second), curve_n()));
 
-      const auto pt =
-        point_add
-        (
-          scalar_mult(u1, { curve_gx(), curve_gy() } ),
-          scalar_mult(u2, { pub.first,  pub.second } )
-        );
+      const auto multiples_q = wnaf_multiples<wnaf_window>(point_q);
+
+      wnaf_table_type table_q { };
+
+      to_affine_batch(multiples_q.cbegin(), multiples_q.cend(), table_q.begin());
 
-      const auto result_verify_is_ok =
-      (
-        divmod(double_sint_type(sig.first), curve_n()).second == divmod(pt.my_x, curve_n()).second
-      );
+      return verify_signature_shamir(z_msg_hash, sig.first, w, table_q.data());
+    }
 
-      return result_verify_is_ok;
+    // Verify a batch of signatures, each one with its own public key and
+    // message hash. The signatures are processed in groups of up to
+    // verify_batch_size, which share their inversions (Montgomery's
+    // simultaneous inversion): one inversion modulo n for the values
+    // of s^-1, and one inversion modulo p for the odd multiples of the
+    // public keys. The sum u1 * G + u2 * Q is calculated with Shamir's
+    // trick and compared with r in Jacobian coordinates, without an
+    // inversion. The stack of a group grows with verify_batch_size,
+    // see GENERIC_ECC_VERIFY_BATCH_SIZE. A size of 1 verifies each
+    // signature on its own with verify_signature_ph().
+
+    static constexpr auto verify_batch_size = static_cast<std::size_t>(GENERIC_ECC_VERIFY_BATCH_SIZE);
+
+    static_assert(verify_batch_size > static_cast<std::size_t>(UINT8_C(0)),
+                  "Error: The size of a verification group must be at least 1");
+
+    static auto verify_signature_batch_ph(const std::pair<uint_type, uint_type>* pubs,
+                                          const uint_type*                       z_msg_hashes,
+                                          const std::pair<uint_type, uint_type>* sigs,
+                                          const std::size_t                      count,
+                                                bool*                            results) -> void
+    {
+      for(auto first = static_cast<std::size_t>(UINT8_C(0)); first < count; first += verify_batch_size)
+      {
+        const auto group_size = (std::min)(verify_batch_size, static_cast<std::size_t>(count - first));
+
+        if(group_size == static_cast<std::size_t>(UINT8_C(1)))
+        {
+          results[first] = verify_signature_ph(pubs[first], z_msg_hashes[first], sigs[first]);
+        }
+        else
+        {
+          verify_signature_group_ph(pubs + first, z_msg_hashes + first, sigs + first, group_size, results + first);
+        }
+      }
+    }
+
+    // The arithmetic of the scalars modulo the order n.
+    using scalar_field_type = ecc_field_generic<uint_type, SubGroupOrderN>;
+
+    static auto is_on_curve_field(const affine_point_type& point) -> bool
+    {
+      // Test the condition y^2 = x^3 + a x + b in the field.
+      const auto b = field_type::to_field(uint_type(CurveCoefficientB)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      const auto rhs = field_add(field_mul(field_add(field_sqr(point.my_x), field_a()), point.my_x), b);
+
+      return (field_sqr(point.my_y) == rhs);
+    }
+
+    // Check that r and s are in [1, n) and that the public key is
+    // a point on the curve. The point is returned in the field.
+    static auto is_valid_signature_input(const std::pair<uint_type, uint_type>& pub,
+                                         const std::pair<uint_type, uint_type>& sig,
+                                               affine_point_type&               point_q) -> bool
+    {
+      const auto p = uint_type(FieldCharacteristicP); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+      const auto n = uint_type(SubGroupOrderN);       // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      if(   (sig.first  == 0U) || (sig.first  >= n)
+         || (sig.second == 0U) || (sig.second >= n)
+         || (pub.first  >= p)  || (pub.second >= p))
+      {
+        return false;
+      }
+
+      point_q = { field_type::to_field(pub.first), field_type::to_field(pub.second) };
+
+      return is_on_curve_field(point_q);
+    }
+
+    // Calculate u1 * G + u2 * Q with u1 = z * w and u2 = r * w, where
+    // w = s^-1 mod n, and compare its x-coordinate with r.
+    static auto verify_signature_shamir(const uint_type&         z_msg_hash,
+                                        const uint_type&         r,
+                                        const uint_type&         w,
+                                        const affine_point_type* table_q) -> bool
+    {
+      const auto u1 = scalar_field_type::multiply(z_msg_hash, w);
+      const auto u2 = scalar_field_type::multiply(r,          w);
+
+      const auto pt = scalar_mult_shamir(u1, u2, table_q);
+
+      if(pt.is_infinity())
+      {
+        return false;
+      }
+
+      const auto p = uint_type(FieldCharacteristicP); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+      const auto n = uint_type(SubGroupOrderN);       // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      // The affine x = X / Z^2 is compared with r and, if it is less
+      // than p, with r + n, since x has been reduced modulo n.
+      const auto zz = field_sqr(pt.my_z);
+
+      const auto r_plus_n = uint_type(r + n);
+
+      return
+        (     (field_mul(field_type::to_field(r), zz) == pt.my_x)
+          || ((r_plus_n > r) && (r_plus_n < p) && (field_mul(field_type::to_field(r_plus_n), zz) == pt.my_x)));
+    }
+
+    static auto verify_signature_group_ph(const std::pair<uint_type, uint_type>* pubs,
+                                          const uint_type*                       z_msg_hashes,
+                                          const std::pair<uint_type, uint_type>* sigs,
+                                          const std::size_t                      count,
+                                                bool*                            results) -> void
+    {
+      // Collect the signatures with r and s in [1, n) and a public key
+      // on the curve. The others are not valid.
+      std::array<std::size_t, verify_batch_size> valid_index { };
+
+      std::array<affine_point_type, verify_batch_size> points_q { };
+
+      auto valid_count = static_cast<std::size_t>(UINT8_C(0));
+
+      for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < count; ++index)
+      {
+        results[index] = false;
+
+        if(is_valid_signature_input(pubs[index], sigs[index], points_q[valid_count]))
+        {
+          valid_index[valid_count] = index;
+
+          ++valid_count;
+        }
+      }
+
+      if(valid_count == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        return;
+      }
+
+      // Invert all values of s modulo n with a single inversion.
+      std::array<uint_type, verify_batch_size> s_products { };
+
+      auto s_product = uint_type(static_cast<unsigned>(UINT8_C(1)));
+
+      for(auto valid = static_cast<std::size_t>(UINT8_C(0)); valid < valid_count; ++valid)
+      {
+        s_product = scalar_field_type::multiply(s_product, sigs[valid_index[valid]].second);
+
+        s_products[valid] = s_product;
+      }
+
+      auto s_product_inv = uint_type(inverse_mod(double_sint_type(s_product), curve_n()));
+
+      std::array<uint_type, verify_batch_size> w { };
+
+      for(auto valid = valid_count; valid-- > static_cast<std::size_t>(UINT8_C(0)); )
+      {
+        if(valid == static_cast<std::size_t>(UINT8_C(0)))
+        {
+          w[valid] = s_product_inv;
+        }
+        else
+        {
+          w[valid] = scalar_field_type::multiply(s_product_inv, s_products[valid - 1U]);
+
+          s_product_inv = scalar_field_type::multiply(s_product_inv, sigs[valid_index[valid]].second);
+        }
+      }
+
+      // Convert the odd multiples of all public keys to affine
+      // coordinates with a single inversion.
+      constexpr auto table_size = std::tuple_size<wnaf_table_type>::value;
+
+      std::array<jacobian_point_type, static_cast<std::size_t>(verify_batch_size * table_size)> multiples { };
+
+      for(auto valid = static_cast<std::size_t>(UINT8_C(0)); valid < valid_count; ++valid)
+      {
+        const auto multiples_q = wnaf_multiples<wnaf_window>(points_q[valid]);
+
+        std::copy(multiples_q.cbegin(), multiples_q.cend(), multiples.begin() + static_cast<std::ptrdiff_t>(valid * table_size));
+      }
+
+      std::array<affine_point_type, static_cast<std::size_t>(verify_batch_size * table_size)> tables_q { };
+
+      to_affine_batch(multiples.cbegin(), multiples.cbegin() + static_cast<std::ptrdiff_t>(valid_count * table_size), tables_q.begin());
+
+      for(auto valid = static_cast<std::size_t>(UINT8_C(0)); valid < valid_count; ++valid)
+      {
+        const auto index = valid_index[valid];
+
+        results[index] = verify_signature_shamir(z_msg_hashes[index], sigs[index].first, w[valid], tables_q.data() + (valid * table_size));
+      }
     }
   };
 } // namespace generic_ecc
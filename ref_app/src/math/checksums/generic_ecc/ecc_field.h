@@ -0,0 +1,454 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#ifndef ECC_FIELD_2026_10_17_H
+#define ECC_FIELD_2026_10_17_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#define WIDE_INTEGER_DISABLE_IOSTREAM
+#define WIDE_INTEGER_DISABLE_TO_STRING
+#define WIDE_INTEGER_DISABLE_IMPLEMENT_UTIL_DYNAMIC_ARRAY
+#define WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS
+
+#if !defined(WIDE_INTEGER_NAMESPACE)
+#define WIDE_INTEGER_NAMESPACE ckormanyos
+#endif
+
+#include <math/wide_integer/uintwide_t.h>
+
+namespace generic_ecc
+{
+  // The arithmetic of the prime field GF(p) of an elliptic curve.
+  // The field elements are represented by unsigned integers in the
+  // range [0, p), possibly in a different form than the integer values.
+  // The curve converts its coordinates with to_field() and from_field()
+  // at the boundaries of the point arithmetic.
+
+  // The generic field reduces each double-width product modulo p
+  // with a division.
+
+  template<typename UintType,
+           const char* FieldCharacteristicP>
+  struct ecc_field_generic
+  {
+    using uint_type = UintType;
+
+    using double_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(2))), typename uint_type::limb_type, void, false>;
+
+    static constexpr auto field_p() noexcept -> uint_type { return uint_type(FieldCharacteristicP); } // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+    static auto to_field  (const uint_type& a) -> uint_type { return a; }
+    static auto from_field(const uint_type& a) -> uint_type { return a; }
+
+    static auto one() -> uint_type { return uint_type(static_cast<unsigned>(UINT8_C(1))); }
+
+    static auto add(const uint_type& a, const uint_type& b) -> uint_type
+    {
+      constexpr auto p = field_p();
+
+      // The sum may wrap around, in which case it also exceeds p.
+      const auto s = uint_type(a + b);
+
+      return (((s < a) || (s >= p)) ? uint_type(s - p) : s);
+    }
+
+    static auto subtract(const uint_type& a, const uint_type& b) -> uint_type
+    {
+      constexpr auto p = field_p();
+
+      return ((a >= b) ? uint_type(a - b) : uint_type((a - b) + p));
+    }
+
+    static auto multiply(const uint_type& a, const uint_type& b) -> uint_type
+    {
+      constexpr auto p = double_uint_type(FieldCharacteristicP); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      return uint_type((double_uint_type(a) * double_uint_type(b)) % p);
+    }
+
+    static auto square(const uint_type& a) -> uint_type { return multiply(a, a); }
+  };
+
+  // The special forms of primes that have a dedicated reduction.
+
+  enum class ecc_field_prime_form
+  {
+    generic,
+    secp256k1, // p = 2^256 - 2^32 - 977
+    nist_p256  // p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+  };
+
+  // The form of the field characteristic is detected at compile time.
+  // A curve can also declare the form of its prime with a specialization
+  // of this template.
+
+  template<typename UintType,
+           const char* FieldCharacteristicP>
+  struct ecc_field_prime_form_traits
+  {
+  private:
+    using uint_type = UintType;
+
+    static constexpr auto detect() -> ecc_field_prime_form
+    {
+      return
+        (std::numeric_limits<uint_type>::digits != static_cast<int>(INT16_C(256)))
+          ? ecc_field_prime_form::generic
+          : (uint_type(FieldCharacteristicP) == uint_type("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F")) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+            ? ecc_field_prime_form::secp256k1
+            : (uint_type(FieldCharacteristicP) == uint_type("0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF")) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+              ? ecc_field_prime_form::nist_p256
+              : ecc_field_prime_form::generic;
+    }
+
+  public:
+    static constexpr ecc_field_prime_form value = detect();
+  };
+
+  // The special-prime field reduces the products modulo the primes of
+  // secp256k1 and NIST P-256 with a few additions of the 32-bit words
+  // of the product, without division and without branches that depend
+  // on the values. Other primes fall back to the generic field.
+
+  // See also Sect. 2.2.6 in D. Hankerson, A. Menezes, S. Vanstone,
+  // "Guide to Elliptic Curve Cryptography", Springer, 2004.
+
+  template<typename UintType,
+           const char* FieldCharacteristicP>
+  struct ecc_field_special_prime : public ecc_field_generic<UintType, FieldCharacteristicP>
+  {
+  private:
+    using base_class_type = ecc_field_generic<UintType, FieldCharacteristicP>;
+
+  public:
+    using uint_type = UintType;
+
+    static constexpr auto prime_form() noexcept -> ecc_field_prime_form
+    {
+      return ecc_field_prime_form_traits<uint_type, FieldCharacteristicP>::value;
+    }
+
+    static auto multiply(const uint_type& a, const uint_type& b) -> uint_type
+    {
+      return multiply_of_form(a, b, std::integral_constant<ecc_field_prime_form, prime_form()> { });
+    }
+
+    static auto square(const uint_type& a) -> uint_type { return multiply(a, a); }
+
+  private:
+    using limb_type = typename uint_type::limb_type;
+
+    static constexpr auto word_count = static_cast<std::size_t>(UINT8_C(8));
+
+    using word_array_type         = std::array<std::uint32_t, word_count>;
+    using double_word_array_type  = std::array<std::uint32_t, static_cast<std::size_t>(word_count * 2U)>;
+
+    static constexpr auto limb_digits  = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
+    static constexpr auto chunk_digits = ((limb_digits < 32U) ? limb_digits : 32U);
+
+    static auto multiply_of_form(const uint_type& a,
+                                 const uint_type& b,
+                                 std::integral_constant<ecc_field_prime_form, ecc_field_prime_form::generic>) -> uint_type
+    {
+      return base_class_type::multiply(a, b);
+    }
+
+    static auto multiply_of_form(const uint_type& a,
+                                 const uint_type& b,
+                                 std::integral_constant<ecc_field_prime_form, ecc_field_prime_form::secp256k1>) -> uint_type
+    {
+      return from_words(reduce_secp256k1(multiply_words(to_words(a), to_words(b))));
+    }
+
+    static auto multiply_of_form(const uint_type& a,
+                                 const uint_type& b,
+                                 std::integral_constant<ecc_field_prime_form, ecc_field_prime_form::nist_p256>) -> uint_type
+    {
+      return from_words(reduce_nist_p256(multiply_words(to_words(a), to_words(b))));
+    }
+
+    static auto to_words(const uint_type& a) -> word_array_type
+    {
+      word_array_type words { };
+
+      auto bit_position = static_cast<unsigned>(UINT8_C(0));
+
+      for(const auto& limb : a.crepresentation())
+      {
+        for(auto shift = static_cast<unsigned>(UINT8_C(0)); shift < limb_digits; shift += chunk_digits)
+        {
+          const auto chunk = static_cast<std::uint32_t>(limb >> shift);
+
+          words[static_cast<std::size_t>(bit_position / 32U)] |= static_cast<std::uint32_t>(chunk << static_cast<unsigned>(bit_position % 32U));
+
+          bit_position += chunk_digits;
+        }
+      }
+
+      return words;
+    }
+
+    static auto from_words(const word_array_type& words) -> uint_type
+    {
+      uint_type result { };
+
+      auto bit_position = static_cast<unsigned>(UINT8_C(0));
+
+      for(auto& limb : result.representation())
+      {
+        for(auto shift = static_cast<unsigned>(UINT8_C(0)); shift < limb_digits; shift += chunk_digits)
+        {
+          const auto chunk = static_cast<std::uint32_t>(words[static_cast<std::size_t>(bit_position / 32U)] >> static_cast<unsigned>(bit_position % 32U));
+
+          limb = static_cast<limb_type>(limb | static_cast<limb_type>(static_cast<limb_type>(chunk) << shift));
+
+          bit_position += chunk_digits;
+        }
+      }
+
+      return result;
+    }
+
+    static auto multiply_words(const word_array_type& a, const word_array_type& b) -> double_word_array_type
+    {
+      double_word_array_type t { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+      {
+        auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+        for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < word_count; ++j)
+        {
+          carry += static_cast<std::uint64_t>(static_cast<std::uint64_t>(a[i]) * b[j]) + t[i + j];
+
+          t[i + j] = static_cast<std::uint32_t>(carry);
+
+          carry >>= 32U;
+        }
+
+        t[i + word_count] = static_cast<std::uint32_t>(carry);
+      }
+
+      return t;
+    }
+
+    // Subtract p from r if r >= p, selected with a mask instead of a branch.
+    static auto subtract_p_if_not_less(word_array_type& r, const std::uint32_t r_carry, const word_array_type& p) -> void
+    {
+      word_array_type d { };
+
+      auto borrow = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+      {
+        const auto diff = static_cast<std::uint64_t>(static_cast<std::uint64_t>(r[i]) - p[i] - borrow);
+
+        d[i] = static_cast<std::uint32_t>(diff);
+
+        borrow = static_cast<std::uint64_t>(diff >> 63U);
+      }
+
+      // Keep r if r - p has borrowed, which is if r < p. If r has carried
+      // out above 2^256, then r > p.
+      const auto keep_r = static_cast<std::uint32_t>(static_cast<std::uint32_t>(borrow) & static_cast<std::uint32_t>(r_carry ^ 1U));
+
+      const auto mask = static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(0)) - keep_r);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+      {
+        r[i] = static_cast<std::uint32_t>((r[i] & mask) | (d[i] & static_cast<std::uint32_t>(~mask)));
+      }
+    }
+
+    static auto reduce_secp256k1(const double_word_array_type& t) -> word_array_type
+    {
+      // Since 2^256 = 2^32 + 977 (mod p), the upper half h of the product
+      // is folded into the lower half l with l + (h * 977) + (h * 2^32).
+
+      constexpr word_array_type p
+      {
+        UINT32_C(0xFFFFFC2F), UINT32_C(0xFFFFFFFE), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF),
+        UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF)
+      };
+
+      constexpr auto c0 = static_cast<std::uint64_t>(UINT16_C(977));
+
+      word_array_type r { };
+
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+      {
+        carry += static_cast<std::uint64_t>(t[i]) + static_cast<std::uint64_t>(t[i + word_count] * c0);
+
+        if(i != static_cast<std::size_t>(UINT8_C(0)))
+        {
+          carry += t[(i + word_count) - 1U];
+        }
+
+        r[i] = static_cast<std::uint32_t>(carry);
+
+        carry >>= 32U;
+      }
+
+      // Fold the overflow above 2^256, which is less than 2^34, once more.
+      const auto h = static_cast<std::uint64_t>(carry + t[(word_count * 2U) - 1U]);
+
+      carry  = static_cast<std::uint64_t>(r[0U]) + static_cast<std::uint64_t>(static_cast<std::uint32_t>(h) * c0);
+      r[0U]  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+
+      carry += static_cast<std::uint64_t>(r[1U]) + static_cast<std::uint64_t>((h >> 32U) * c0) + static_cast<std::uint32_t>(h);
+      r[1U]  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+
+      carry += static_cast<std::uint64_t>(r[2U]) + static_cast<std::uint64_t>(h >> 32U);
+      r[2U]  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(3)); i < word_count; ++i)
+      {
+        carry += r[i];
+        r[i]   = static_cast<std::uint32_t>(carry);
+        carry >>= 32U;
+      }
+
+      // The result is less than 2^256 + 2^67. An overflow above 2^256
+      // is folded once more, after which r < 2^256 < 2p.
+      const auto r_carry = static_cast<std::uint32_t>(carry);
+
+      carry  = static_cast<std::uint64_t>(r[0U]) + static_cast<std::uint64_t>(r_carry * c0);
+      r[0U]  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+
+      carry += static_cast<std::uint64_t>(r[1U]) + r_carry;
+      r[1U]  = static_cast<std::uint32_t>(carry);
+      carry >>= 32U;
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(2)); i < word_count; ++i)
+      {
+        carry += r[i];
+        r[i]   = static_cast<std::uint32_t>(carry);
+        carry >>= 32U;
+      }
+
+      subtract_p_if_not_less(r, static_cast<std::uint32_t>(carry), p);
+
+      return r;
+    }
+
+    static auto reduce_nist_p256(const double_word_array_type& t) -> word_array_type
+    {
+      // The NIST fast reduction for p = 2^256 - 2^224 + 2^192 + 2^96 - 1:
+      // r = s1 + 2 s2 + 2 s3 + s4 + s5 - s6 - s7 - s8 - s9 (mod p),
+      // where the terms s1...s9 consist of the 32-bit words of the product.
+
+      constexpr word_array_type p
+      {
+        UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0x00000000),
+        UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000001), UINT32_C(0xFFFFFFFF)
+      };
+
+      const auto c = [&t](const std::size_t index) { return static_cast<std::int64_t>(t[index]); };
+
+      std::array<std::int64_t, word_count> acc
+      {
+        c(0U) + c(8U) + c(9U) - c(11U) - c(12U) - c(13U) - c(14U),
+        c(1U) + c(9U) + c(10U) - c(12U) - c(13U) - c(14U) - c(15U),
+        c(2U) + c(10U) + c(11U) - c(13U) - c(14U) - c(15U),
+        c(3U) + (2 * c(11U)) + (2 * c(12U)) + c(13U) - c(15U) - c(8U) - c(9U),
+        c(4U) + (2 * c(12U)) + (2 * c(13U)) + c(14U) - c(9U) - c(10U),
+        c(5U) + (2 * c(13U)) + (2 * c(14U)) + c(15U) - c(10U) - c(11U),
+        c(6U) + (3 * c(14U)) + (2 * c(15U)) + c(13U) - c(8U) - c(9U),
+        c(7U) + (3 * c(15U)) + c(8U) - c(10U) - c(11U) - c(12U) - c(13U)
+      };
+
+      word_array_type r { };
+
+      auto carry = propagate(acc, r);
+
+      // Fold the signed overflow k above 2^256 with
+      // 2^256 = 2^224 - 2^192 - 2^96 + 1 (mod p). After two folds
+      // the result is in [0, 2^256).
+      for(auto fold = static_cast<unsigned>(UINT8_C(0)); fold < static_cast<unsigned>(UINT8_C(2)); ++fold)
+      {
+        for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+        {
+          acc[i] = static_cast<std::int64_t>(r[i]);
+        }
+
+        acc[0U] += carry;
+        acc[3U] -= carry;
+        acc[6U] -= carry;
+        acc[7U] += carry;
+
+        carry = propagate(acc, r);
+      }
+
+      subtract_p_if_not_less(r, static_cast<std::uint32_t>(UINT8_C(0)), p);
+
+      return r;
+    }
+
+    // Propagate the signed carries of the accumulated words
+    // and return the signed carry above the top word.
+    static auto propagate(const std::array<std::int64_t, word_count>& acc, word_array_type& r) -> std::int64_t
+    {
+      auto carry = static_cast<std::int64_t>(INT8_C(0));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < word_count; ++i)
+      {
+        const auto sum = static_cast<std::int64_t>(acc[i] + carry);
+
+        r[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(sum));
+
+        // The division is exact, and it is well-defined for negative sums.
+        carry = static_cast<std::int64_t>((sum - static_cast<std::int64_t>(r[i])) / INT64_C(0x100000000));
+      }
+
+      return carry;
+    }
+  };
+
+  // The Montgomery field holds the elements in Montgomery form
+  // (a * R) % p and multiplies them without division, see
+  // montgomery_field in uintwide_t. Its constants are calculated
+  // at compile time.
+
+  template<typename UintType,
+           const char* FieldCharacteristicP>
+  struct ecc_field_montgomery
+  {
+    using uint_type = UintType;
+
+    using montgomery_field_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_field<uint_type::my_width2, typename uint_type::limb_type, void>;
+
+    static auto field() -> const montgomery_field_type&
+    {
+      static constexpr montgomery_field_type my_field { uint_type(FieldCharacteristicP) }; // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+      return my_field;
+    }
+
+    static auto to_field  (const uint_type& a) -> uint_type { return field().to_montgomery(a); }
+    static auto from_field(const uint_type& a) -> uint_type { return field().from_montgomery(a); }
+
+    static auto one() -> uint_type { return field().one(); }
+
+    static auto add     (const uint_type& a, const uint_type& b) -> uint_type { return field().add(a, b); }
+    static auto subtract(const uint_type& a, const uint_type& b) -> uint_type { return field().subtract(a, b); }
+    static auto multiply(const uint_type& a, const uint_type& b) -> uint_type { return field().multiply(a, b); }
+    static auto square  (const uint_type& a)                     -> uint_type { return field().square(a); }
+  };
+} // namespace generic_ecc
+
+#endif // ECC_FIELD_2026_10_17_H
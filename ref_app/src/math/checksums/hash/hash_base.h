@@ -8,17 +8,28 @@
 #ifndef HASH_BASE_2013_09_05_H_
   #define HASH_BASE_2013_09_05_H_
 
+  #include <algorithm>
+  #include <array>
   #include <limits>
 
   #include <math/checksums/hash/hash_detail.h>
 
   namespace math { namespace checksums { namespace hash {
 
-  template<typename CountType,
+  // The hash base is a CRTP base class, which calls the functions
+  // initialize() and perform_algorithm(block) of the derived class
+  // without virtual dispatch. The derived class extends initialize()
+  // with its initial context and implements perform_algorithm(block),
+  // which transforms one message block, given by a pointer to its first
+  // byte. Whole blocks are transformed directly from the caller's memory.
+  // Only the head and tail fragments of the input are buffered.
+
+  template<typename DerivedType,
+           typename CountType,
            const std::uint16_t ResultBitCount,
            const std::uint16_t MessageBufferSize,
            const std::uint16_t MessageLengthTotalBitCount>
-  class hash_base
+  class hash_base_crtp
   {
   public:
     using count_type = CountType;
@@ -36,9 +47,7 @@
       "Error: The count type must be an unsigned integer with radix 2, that is 16 bits or wider, and having a multiple of 8 bits"
     );
 
-    virtual ~hash_base() = default;
-
-    virtual auto initialize() -> void
+    auto initialize() -> void
     {
       message_index        = static_cast<std::uint_least16_t>(UINT8_C(0));
       message_length_total = static_cast<count_type>(UINT8_C(0));
@@ -48,27 +57,60 @@
 
     auto process(const std::uint8_t* message, const count_type count) -> void
     {
-      auto process_index      = count_type { };
-      auto process_chunk_size = count_type { };
+      auto remaining = count;
 
-      while(process_index < count)
+      // Complete the head fragment in the message buffer.
+      if(message_index != static_cast<std::uint_least16_t>(UINT8_C(0)))
       {
+        const auto process_chunk_size =
+          (std::min)(remaining,
+                     static_cast<count_type>(message_buffer_static_size() - message_index));
+
+        std::copy(message,
+                  message + static_cast<std::size_t>(process_chunk_size),
+                  message_buffer.begin() + static_cast<std::size_t>(message_index));
+
         message_index        = static_cast<std::uint_least16_t>(message_index        + process_chunk_size);
         message_length_total = static_cast<count_type>         (message_length_total + process_chunk_size);
-        process_index        = static_cast<count_type>         (process_index        + process_chunk_size);
+        remaining            = static_cast<count_type>         (remaining            - process_chunk_size);
+
+        message += static_cast<std::size_t>(process_chunk_size);
 
         if(message_index == message_buffer_static_size())
         {
           my_perform_algorithm();
         }
+      }
 
-        process_chunk_size = (std::min)(static_cast<count_type>(count - process_index),
-                                        static_cast<count_type>(message_buffer_static_size() - message_index));
+      // Transform the whole blocks directly from the message.
+      const auto block_count = static_cast<std::size_t>(remaining / message_buffer_static_size());
 
-        std::copy(message + static_cast<std::size_t>(process_index),
-                  message + static_cast<std::size_t>(process_index + process_chunk_size),
-                  message_buffer.begin() + static_cast<std::size_t>(message_index));
+      my_perform_algorithm_on_blocks(message, block_count);
+
+      message += static_cast<std::size_t>(block_count * message_buffer_static_size());
+
+      remaining = static_cast<count_type>(remaining % message_buffer_static_size());
+
+      // Buffer the tail fragment.
+      std::copy(message,
+                message + static_cast<std::size_t>(remaining),
+                message_buffer.begin() + static_cast<std::size_t>(message_index));
+
+      message_index        = static_cast<std::uint_least16_t>(message_index        + remaining);
+      message_length_total = static_cast<count_type>         (message_length_total + remaining);
+    }
 
+    // Process a sequence of whole message blocks. If the stream
+    // so far is not block-aligned, this is the same as process().
+    auto process_blocks(const std::uint8_t* blocks, const std::size_t block_count) -> void
+    {
+      if(message_index != static_cast<std::uint_least16_t>(UINT8_C(0)))
+      {
+        process(blocks, static_cast<count_type>(block_count * message_buffer_static_size()));
+      }
+      else
+      {
+        my_perform_algorithm_on_blocks(blocks, block_count);
       }
     }
 
@@ -143,9 +185,10 @@
 
     auto hash(const std::uint8_t* message, const count_type count) -> void
     {
-      this->initialize();
-      this->process(message, count);
-      this->finalize();
+      derived().initialize();
+
+      process(message, count);
+      finalize();
     }
 
   protected:
@@ -163,13 +206,15 @@
     message_block_type  message_buffer       { };
     context_type        transform_context    { };
 
-    hash_base() = default;
+    hash_base_crtp() = default;
 
-    hash_base(const hash_base&) = default;
-    hash_base(hash_base&&) noexcept = default;
+    hash_base_crtp(const hash_base_crtp&) = default;
+    hash_base_crtp(hash_base_crtp&&) noexcept = default;
 
-    auto operator=(const hash_base& other) -> hash_base& = default;
-    auto operator=(hash_base&& other) noexcept -> hash_base& = default;
+    ~hash_base_crtp() = default;
+
+    auto operator=(const hash_base_crtp& other) -> hash_base_crtp& = default;
+    auto operator=(hash_base_crtp&& other) noexcept -> hash_base_crtp& = default;
 
   private:
     static constexpr auto message_length_total_width() noexcept -> std::uint16_t
@@ -181,16 +226,70 @@
         );
     }
 
-    virtual auto perform_algorithm() -> void = 0;
+    auto derived() -> DerivedType& { return static_cast<DerivedType&>(*this); }
 
     auto my_perform_algorithm() -> void
     {
-      this->perform_algorithm();
+      derived().perform_algorithm(message_buffer.data());
 
       message_index = static_cast<std::uint_least16_t>(UINT8_C(0));
 
       message_buffer.fill(static_cast<std::uint8_t>(UINT8_C(0)));
     }
+
+    auto my_perform_algorithm_on_blocks(const std::uint8_t* blocks, const std::size_t block_count) -> void
+    {
+      for(auto block = static_cast<std::size_t>(UINT8_C(0)); block < block_count; ++block)
+      {
+        derived().perform_algorithm(blocks + static_cast<std::size_t>(block * message_buffer_static_size()));
+      }
+
+      message_length_total =
+        static_cast<count_type>
+        (
+          message_length_total + static_cast<count_type>(block_count * message_buffer_static_size())
+        );
+    }
+  };
+
+  // The hash base with virtual functions initialize() and perform_algorithm(block),
+  // for hash algorithms that are selected at run time.
+
+  template<typename CountType,
+           const std::uint16_t ResultBitCount,
+           const std::uint16_t MessageBufferSize,
+           const std::uint16_t MessageLengthTotalBitCount>
+  class hash_base : public hash_base_crtp<hash_base<CountType, ResultBitCount, MessageBufferSize, MessageLengthTotalBitCount>,
+                                          CountType,
+                                          ResultBitCount,
+                                          MessageBufferSize,
+                                          MessageLengthTotalBitCount>
+  {
+  private:
+    using base_class_type = hash_base_crtp<hash_base<CountType, ResultBitCount, MessageBufferSize, MessageLengthTotalBitCount>,
+                                           CountType,
+                                           ResultBitCount,
+                                           MessageBufferSize,
+                                           MessageLengthTotalBitCount>;
+
+    friend base_class_type;
+
+  public:
+    virtual ~hash_base() = default;
+
+    virtual auto initialize() -> void { base_class_type::initialize(); }
+
+  protected:
+    hash_base() = default;
+
+    hash_base(const hash_base&) = default;
+    hash_base(hash_base&&) noexcept = default;
+
+    auto operator=(const hash_base& other) -> hash_base& = default;
+    auto operator=(hash_base&& other) noexcept -> hash_base& = default;
+
+  private:
+    virtual auto perform_algorithm(const std::uint8_t* block) -> void = 0;
   };
 
   } } } // namespace math::checksums::hash
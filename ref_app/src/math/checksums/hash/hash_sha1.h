@@ -19,16 +19,18 @@
   namespace math { namespace checksums { namespace hash {
 
   template<typename CountType>
-  class hash_sha1 : public hash_base<CountType,
-                                     static_cast<std::uint16_t>(UINT8_C(160)),
-                                     static_cast<std::uint16_t>(UINT8_C(64)),
-                                     static_cast<std::uint16_t>(UINT8_C(64))>
+  class hash_sha1 : public hash_base_crtp<hash_sha1<CountType>,
+                                          CountType,
+                                          static_cast<std::uint16_t>(UINT8_C(160)),
+                                          static_cast<std::uint16_t>(UINT8_C(64)),
+                                          static_cast<std::uint16_t>(UINT8_C(64))>
   {
   private:
-    using base_class_type = hash_base<CountType,
-                                      static_cast<std::uint16_t>(UINT8_C(160)),
-                                      static_cast<std::uint16_t>(UINT8_C(64)),
-                                      static_cast<std::uint16_t>(UINT8_C(64))>;
+    using base_class_type = hash_base_crtp<hash_sha1<CountType>,
+                                           CountType,
+                                           static_cast<std::uint16_t>(UINT8_C(160)),
+                                           static_cast<std::uint16_t>(UINT8_C(64)),
+                                           static_cast<std::uint16_t>(UINT8_C(64))>;
 
     static_assert(base_class_type::message_buffer_static_size() == static_cast<std::uint16_t>(UINT8_C(64)),
                   "Error: The message  buffer size must exactly equal 64");
@@ -39,12 +41,12 @@
     hash_sha1(const hash_sha1&) = default;
     hash_sha1(hash_sha1&&) noexcept = default;
 
-    ~hash_sha1() override = default;
+    ~hash_sha1() = default;
 
     auto operator=(const hash_sha1&) -> hash_sha1& = default;
     auto operator=(hash_sha1&&) noexcept -> hash_sha1& = default;
 
-    auto initialize() -> void override
+    auto initialize() -> void
     {
       base_class_type::initialize();
 
@@ -56,11 +58,13 @@
     }
 
   private:
-    auto perform_algorithm() -> void override;
+    friend base_class_type;
+
+    auto perform_algorithm(const std::uint8_t* block) -> void;
   };
 
   template <typename my_count_type>
-  auto hash_sha1<my_count_type>::perform_algorithm() -> void
+  auto hash_sha1<my_count_type>::perform_algorithm(const std::uint8_t* block) -> void
   {
     // Apply the hash transformation algorithm to a full data block.
 
@@ -80,8 +84,8 @@
 
     detail::convert_uint8_input_to_uint32_output_reverse
     (
-      base_class_type::message_buffer.data(),
-      base_class_type::message_buffer.data() + static_cast<std::size_t>(base_class_type::message_buffer_static_size()),
+      block,
+      block + static_cast<std::size_t>(base_class_type::message_buffer_static_size()),
       transform_block.data()
     );
 
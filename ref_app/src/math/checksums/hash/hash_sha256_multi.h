@@ -0,0 +1,379 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef HASH_SHA256_MULTI_2026_10_17_H
+  #define HASH_SHA256_MULTI_2026_10_17_H
+
+  #include <algorithm>
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstring>
+
+  #include <math/checksums/hash/hash_sha256.h>
+
+  #if (defined(__GNUC__) && (defined(__x86_64__) || defined(__ARM_NEON)))
+  #define MATH_CHECKSUMS_HASH_SHA256_HAS_VECTOR_LANES
+  #endif
+
+  #if (defined(__GNUC__) && defined(__x86_64__))
+  #define MATH_CHECKSUMS_HASH_SHA256_HAS_AVX2_LANES
+  #endif
+
+  namespace math { namespace checksums { namespace hash {
+
+  // A multi-buffer SHA-256, which hashes LaneCount (4 or 8) independent
+  // messages at once. The state of lane i is held in word j at the index
+  // (j * LaneCount) + i, so that each word of all lanes can be processed
+  // in one vector register. The messages may have different lengths.
+  // Lanes that are finished are masked, in other words their state is
+  // kept while the remaining lanes process their final blocks.
+
+  // The lanes are transformed with the GNU vector extensions, which map
+  // to SSE2 on x86-64 and to NEON on ARM (4 lanes). On x86-64, 8 lanes use
+  // AVX2 when the CPU supports it, which is checked at run time. Otherwise,
+  // and with other compilers, the lanes are transformed one after the other
+  // with the scalar transformation of hash_sha256. All paths produce the
+  // same digests as hash_sha256.
+
+  namespace detail {
+
+  inline auto sha256_load_be32(const std::uint8_t* p) -> std::uint32_t
+  {
+    return
+      static_cast<std::uint32_t>
+      (
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(p[0U]) << 24U) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        | static_cast<std::uint32_t>(static_cast<std::uint32_t>(p[1U]) << 16U) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        | static_cast<std::uint32_t>(static_cast<std::uint32_t>(p[2U]) <<  8U) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        | static_cast<std::uint32_t>(p[3U])                                    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      );
+  }
+
+  // Transform one block in each lane in scalar code.
+  template<const std::size_t LaneCount>
+  struct sha256_lanes_scalar
+  {
+    static auto transform(std::uint32_t* state, const std::size_t stride, const std::uint8_t* const* blocks) -> void
+    {
+      for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+      {
+        std::array<std::uint32_t, 8U> context { };
+
+        for(std::size_t word = 0U; word < context.size(); ++word) { context[word] = state[(word * stride) + lane]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        hash_sha256<std::uint32_t>::transform(context.data(), blocks[lane]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        for(std::size_t word = 0U; word < context.size(); ++word) { state[(word * stride) + lane] = context[word]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+  };
+
+  #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_VECTOR_LANES)
+
+  typedef std::uint32_t sha256_vector4_type __attribute__((vector_size(16)));
+  typedef std::uint32_t sha256_vector8_type __attribute__((vector_size(32)));
+
+  // The lane transformation is written once for all vector widths.
+  // It is always inlined into the callers below, which are compiled
+  // for the respective instruction set.
+  template<typename vector_type,
+           const std::size_t LaneCount>
+  inline __attribute__((always_inline)) auto sha256_lanes_transform(std::uint32_t* state, const std::size_t stride, const std::uint8_t* const* blocks) -> void
+  {
+    static_assert(sizeof(vector_type) == (LaneCount * sizeof(std::uint32_t)),
+                  "Error: The vector type must have one 32-bit element per lane");
+
+    vector_type s[8U]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    vector_type w[16U]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    for(std::size_t word = 0U; word < 8U; ++word)
+    {
+      std::memcpy(&s[word], state + (word * stride), sizeof(vector_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    for(std::size_t word = 0U; word < 16U; ++word)
+    {
+      for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+      {
+        w[word][lane] = sha256_load_be32(blocks[lane] + (word * 4U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    vector_type a = s[0U];
+    vector_type b = s[1U];
+    vector_type c = s[2U];
+    vector_type d = s[3U];
+    vector_type e = s[4U];
+    vector_type f = s[5U];
+    vector_type g = s[6U];
+    vector_type h = s[7U];
+
+    for(std::size_t round = 0U; round < 64U; ++round)
+    {
+      vector_type& wt = w[round & 15U];
+
+      if(round >= 16U)
+      {
+        const vector_type w15 = w[(round - 15U) & 15U];
+        const vector_type w2  = w[(round -  2U) & 15U];
+
+        // SSIG1 and SSIG0
+        wt +=   ((w2  >> 17U) ^ (w2  << 15U) ^ (w2  >> 19U) ^ (w2  << 13U) ^ (w2  >> 10U))
+              +   w[(round - 7U) & 15U]
+              + ((w15 >>  7U) ^ (w15 << 25U) ^ (w15 >> 18U) ^ (w15 << 14U) ^ (w15 >>  3U));
+      }
+
+      // BSIG1, CH, BSIG0 and MAJ
+      const vector_type t1 =   h
+                             + ((e >> 6U) ^ (e << 26U) ^ (e >> 11U) ^ (e << 21U) ^ (e >> 25U) ^ (e << 7U))
+                             + ((e & f) ^ (~e & g))
+                             + sha256_transform_constants[round]
+                             + wt;
+
+      const vector_type t2 =   ((a >> 2U) ^ (a << 30U) ^ (a >> 13U) ^ (a << 19U) ^ (a >> 22U) ^ (a << 10U))
+                             + ((a & b) ^ (a & c) ^ (b & c));
+
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+
+    s[0U] += a;
+    s[1U] += b;
+    s[2U] += c;
+    s[3U] += d;
+    s[4U] += e;
+    s[5U] += f;
+    s[6U] += g;
+    s[7U] += h;
+
+    for(std::size_t word = 0U; word < 8U; ++word)
+    {
+      std::memcpy(state + (word * stride), &s[word], sizeof(vector_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Transform four lanes with SSE2 on x86-64 or with NEON on ARM.
+  struct sha256_lanes_vector4
+  {
+    static auto transform(std::uint32_t* state, const std::size_t stride, const std::uint8_t* const* blocks) -> void
+    {
+      sha256_lanes_transform<sha256_vector4_type, 4U>(state, stride, blocks);
+    }
+  };
+
+  #endif // MATH_CHECKSUMS_HASH_SHA256_HAS_VECTOR_LANES
+
+  #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_AVX2_LANES)
+
+  // Transform eight lanes with AVX2. This may only be called
+  // on a CPU that supports AVX2, see uses_avx2().
+  struct sha256_lanes_avx2
+  {
+    __attribute__((target("avx2")))
+    static auto transform(std::uint32_t* state, const std::size_t stride, const std::uint8_t* const* blocks) -> void
+    {
+      sha256_lanes_transform<sha256_vector8_type, 8U>(state, stride, blocks);
+    }
+
+    static auto uses_avx2() -> bool
+    {
+      static const bool is_supported = check_is_supported();
+
+      return is_supported;
+    }
+
+  private:
+    static auto check_is_supported() -> bool
+    {
+      __builtin_cpu_init();
+
+      return __builtin_cpu_supports("avx2");
+    }
+  };
+
+  #endif // MATH_CHECKSUMS_HASH_SHA256_HAS_AVX2_LANES
+
+  } // namespace detail
+
+  template<const std::size_t LaneCount>
+  class hash_sha256_multi
+  {
+  public:
+    static_assert((LaneCount == 4U) || (LaneCount == 8U),
+                  "Error: The number of lanes must be 4 or 8");
+
+    using result_type = typename hash_sha256<std::uint32_t>::result_type;
+
+    static constexpr auto lane_count = LaneCount;
+
+    // Hash the lane_count messages, each given by a pointer and a length in bytes.
+    auto hash(const std::uint8_t* const* messages, const std::size_t* counts) -> void
+    {
+      constexpr auto block_size = static_cast<std::size_t>(UINT8_C(64));
+
+      // The tail of each message (the partial block, the padding and the bit
+      // count) takes one or two blocks. All whole blocks are read in place.
+      std::array<std::array<std::uint8_t, 2U * block_size>, LaneCount> tails { };
+
+      std::array<std::size_t, LaneCount> whole_block_counts { };
+      std::array<std::size_t, LaneCount> block_counts       { };
+
+      for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+      {
+        const auto count = counts[lane]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        whole_block_counts[lane] = count / block_size;
+
+        const auto tail_count = static_cast<std::size_t>(count % block_size);
+
+        const auto tail_size = (((tail_count + 9U) <= block_size) ? block_size : (2U * block_size));
+
+        block_counts[lane] = whole_block_counts[lane] + (tail_size / block_size);
+
+        auto& tail = tails[lane];
+
+        std::copy(messages[lane] + (count - tail_count), messages[lane] + count, tail.begin()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        tail[tail_count] = static_cast<std::uint8_t>(UINT8_C(0x80));
+
+        // Encode the total number of bits in the last eight bytes.
+        auto bit_count = static_cast<std::uint64_t>(static_cast<std::uint64_t>(count) * 8U);
+
+        for(std::size_t index = 1U; index <= 8U; ++index)
+        {
+          tail[tail_size - index] = static_cast<std::uint8_t>(bit_count);
+
+          bit_count >>= 8U;
+        }
+      }
+
+      for(std::size_t word = 0U; word < 8U; ++word)
+      {
+        std::fill(transform_context.begin() + static_cast<std::ptrdiff_t>(word * LaneCount),
+                  transform_context.begin() + static_cast<std::ptrdiff_t>((word + 1U) * LaneCount),
+                  detail::sha256_initial_context[word]);
+      }
+
+      const auto block_count_max = *std::max_element(block_counts.cbegin(), block_counts.cend());
+
+      for(std::size_t block = 0U; block < block_count_max; ++block)
+      {
+        std::array<const std::uint8_t*, LaneCount> blocks { };
+
+        auto all_lanes_are_active = true;
+
+        for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+        {
+          if(block < whole_block_counts[lane])
+          {
+            blocks[lane] = messages[lane] + (block * block_size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+          else if(block < block_counts[lane])
+          {
+            blocks[lane] = tails[lane].data() + ((block - whole_block_counts[lane]) * block_size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+          else
+          {
+            // This lane is finished. It transforms its tail once more,
+            // and the result is discarded below.
+            blocks[lane] = tails[lane].data();
+
+            all_lanes_are_active = false;
+          }
+        }
+
+        if(all_lanes_are_active)
+        {
+          transform_lanes(blocks.data());
+        }
+        else
+        {
+          const auto context_before = transform_context;
+
+          transform_lanes(blocks.data());
+
+          for(std::size_t lane = 0U; lane < LaneCount; ++lane)
+          {
+            if(block >= block_counts[lane])
+            {
+              for(std::size_t word = 0U; word < 8U; ++word)
+              {
+                transform_context[(word * LaneCount) + lane] = context_before[(word * LaneCount) + lane];
+              }
+            }
+          }
+        }
+      }
+    }
+
+    auto get_result(const std::size_t lane, typename result_type::pointer result) const -> void
+    {
+      for(std::size_t word = 0U; word < 8U; ++word)
+      {
+        const auto value = transform_context[(word * LaneCount) + lane];
+
+        result[(word * 4U) + 0U] = static_cast<std::uint8_t>(value >> 24U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result[(word * 4U) + 1U] = static_cast<std::uint8_t>(value >> 16U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result[(word * 4U) + 2U] = static_cast<std::uint8_t>(value >>  8U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result[(word * 4U) + 3U] = static_cast<std::uint8_t>(value);        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    // Get the name of the lane transformation that is used on this CPU.
+    static auto engine_name() -> const char*
+    {
+      #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_AVX2_LANES)
+      if((LaneCount == 8U) && detail::sha256_lanes_avx2::uses_avx2()) { return "avx2"; }
+      #endif
+
+      #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_VECTOR_LANES)
+      #if defined(__x86_64__)
+      return "sse2";
+      #else
+      return "neon";
+      #endif
+      #else
+      return "scalar";
+      #endif
+    }
+
+  private:
+    std::array<std::uint32_t, 8U * LaneCount> transform_context { };
+
+    auto transform_lanes(const std::uint8_t* const* blocks) -> void
+    {
+      #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_AVX2_LANES)
+      if((LaneCount == 8U) && detail::sha256_lanes_avx2::uses_avx2())
+      {
+        detail::sha256_lanes_avx2::transform(transform_context.data(), LaneCount, blocks);
+
+        return;
+      }
+      #endif
+
+      // Transform the lanes in groups of four.
+      for(std::size_t group = 0U; group < LaneCount; group += 4U)
+      {
+        #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_VECTOR_LANES)
+        detail::sha256_lanes_vector4::transform(transform_context.data() + group, LaneCount, blocks + group); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        #else
+        detail::sha256_lanes_scalar<4U>::transform(transform_context.data() + group, LaneCount, blocks + group); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        #endif
+      }
+    }
+  };
+
+  } } } // namespace math::checksums::hash
+
+#endif // HASH_SHA256_MULTI_2026_10_17_H
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef HASH_SHA256_SHANI_2026_10_17_H
+  #define HASH_SHA256_SHANI_2026_10_17_H
+
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <math/checksums/hash/hash_detail.h>
+
+  #if (defined(__GNUC__) && defined(__x86_64__))
+  #define MATH_CHECKSUMS_HASH_SHA256_HAS_SHANI
+  #include <immintrin.h>
+  #endif
+
+  namespace math { namespace checksums { namespace hash { namespace detail {
+
+  // The SHA-256 block transformation with the SHA extensions (SHA-NI) on x86-64.
+  // Each sha256rnds2 instruction performs two rounds on the state, which is
+  // held in the order ABEF and CDGH. The message schedule is computed four
+  // words at a time with sha256msg1 and sha256msg2.
+
+  // The transformation is compiled with a function-specific target, so that
+  // no compiler flags are needed. It may only be called on a CPU that supports
+  // SHA-NI and SSE4.1, see uses_shani(), which does this check at run time.
+
+  #if defined(MATH_CHECKSUMS_HASH_SHA256_HAS_SHANI)
+
+  struct sha256_shani
+  {
+    static auto uses_shani() -> bool
+    {
+      static const bool is_supported = check_is_supported();
+
+      return is_supported;
+    }
+
+    __attribute__((target("sha,sse4.1")))
+    static auto compress(std::uint32_t* state, const std::uint8_t* block) -> void
+    {
+      const __m128i swap = _mm_set_epi64x(static_cast<long long>(UINT64_C(0x0C0D0E0F08090A0B)),
+                                          static_cast<long long>(UINT64_C(0x0405060700010203)));
+
+      // Rearrange the state from ABCD EFGH to ABEF CDGH.
+      const __m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)),      0xB1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      const __m128i hgfe = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4U)), 0x1B); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      __m128i state0 = _mm_alignr_epi8(dcba, hgfe, 8);
+      __m128i state1 = _mm_blend_epi16(hgfe, dcba, 0xF0);
+
+      const __m128i abef_save = state0;
+      const __m128i cdgh_save = state1;
+
+      __m128i msg0 = load(block,       swap);
+      __m128i msg1 = load(block + 16U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      __m128i msg2 = load(block + 32U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      __m128i msg3 = load(block + 48U, swap); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      rounds(state0, state1, msg0, 0U);
+      rounds(state0, state1, msg1, 1U);
+      rounds(state0, state1, msg2, 2U);
+      rounds(state0, state1, msg3, 3U);
+
+      // Each further group of four rounds first extends the message schedule.
+      for(unsigned group = 4U; group < 16U; group += 4U)
+      {
+        msg0 = schedule(msg0, msg1, msg2, msg3); rounds(state0, state1, msg0, group + 0U);
+        msg1 = schedule(msg1, msg2, msg3, msg0); rounds(state0, state1, msg1, group + 1U);
+        msg2 = schedule(msg2, msg3, msg0, msg1); rounds(state0, state1, msg2, group + 2U);
+        msg3 = schedule(msg3, msg0, msg1, msg2); rounds(state0, state1, msg3, group + 3U);
+      }
+
+      state0 = _mm_add_epi32(state0, abef_save);
+      state1 = _mm_add_epi32(state1, cdgh_save);
+
+      // Rearrange the state from ABEF CDGH back to ABCD EFGH.
+      const __m128i feba = _mm_shuffle_epi32(state0, 0x1B);
+      const __m128i dchg = _mm_shuffle_epi32(state1, 0xB1);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(state),      _mm_blend_epi16(feba, dchg, 0xF0)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4U), _mm_alignr_epi8(dchg, feba, 8));    // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+  private:
+    static auto check_is_supported() -> bool
+    {
+      __builtin_cpu_init();
+
+      return (__builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1"));
+    }
+
+    __attribute__((target("sha,sse4.1")))
+    static auto load(const std::uint8_t* p, const __m128i swap) -> __m128i
+    {
+      return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), swap); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    // Get the next four words of the message schedule from the previous sixteen.
+    __attribute__((target("sha,sse4.1")))
+    static auto schedule(const __m128i w0, const __m128i w1, const __m128i w2, const __m128i w3) -> __m128i
+    {
+      return _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(w0, w1), _mm_alignr_epi8(w3, w2, 4)), w3);
+    }
+
+    // Perform four rounds with the four message words of the given group.
+    __attribute__((target("sha,sse4.1")))
+    static auto rounds(__m128i& state0, __m128i& state1, const __m128i msg, const unsigned group) -> void
+    {
+      const __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sha256_transform_constants.data() + (group * 4U))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const __m128i wk = _mm_add_epi32(msg, k);
+
+      state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0E));
+    }
+  };
+
+  #endif // MATH_CHECKSUMS_HASH_SHA256_HAS_SHANI
+
+  } } } } // namespace math::checksums::hash::detail
+
+#endif // HASH_SHA256_SHANI_2026_10_17_H
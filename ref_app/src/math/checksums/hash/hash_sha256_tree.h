@@ -0,0 +1,359 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef HASH_SHA256_TREE_2026_10_17_H
+  #define HASH_SHA256_TREE_2026_10_17_H
+
+  #include <algorithm>
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <iomanip>
+  #include <istream>
+  #include <ostream>
+  #include <string>
+  #include <thread>
+  #include <utility>
+  #include <vector>
+
+  #include <math/checksums/hash/hash_sha256.h>
+  #include <util/utility/util_thread_executor.h>
+
+  namespace math { namespace checksums { namespace hash {
+
+  // A tree hash (Merkle tree) over hash_sha256 for large images on a host.
+  // The image is split into leaves of leaf_size bytes (the last leaf may be
+  // shorter). The leaves are hashed in parallel threads and reduced pairwise
+  // to the root. An odd node at the end of a level is promoted unchanged.
+  // Leaves and inner nodes are hashed with distinct prefix bytes (0x00 and
+  // 0x01), so that a leaf can not be confused with an inner node.
+
+  // The digests of all nodes are kept, so that after a modification of the
+  // image only the modified leaves and their paths to the root are hashed
+  // again, see update(). The leaf digests can be saved to a stream and
+  // loaded later, see save() and load().
+
+  class hash_sha256_tree
+  {
+  public:
+    using hash_type   = hash_sha256<std::uint64_t>;
+    using result_type = typename hash_type::result_type;
+
+    static constexpr auto default_leaf_size = static_cast<std::size_t>(UINT32_C(0x10000)); // 64 KiB
+
+    explicit hash_sha256_tree(const std::size_t leaf_size    = default_leaf_size,
+                              const std::size_t thread_count = static_cast<std::size_t>(std::thread::hardware_concurrency()))
+      : my_leaf_size   ((std::max)(leaf_size,    static_cast<std::size_t>(UINT8_C(1)))),
+        my_thread_count((std::max)(thread_count, static_cast<std::size_t>(UINT8_C(1)))) { }
+
+    // Hash the entire image.
+    auto hash(const std::uint8_t* data, const std::size_t count) -> void
+    {
+      my_image_size = count;
+
+      my_levels.assign(static_cast<std::size_t>(UINT8_C(1)), std::vector<result_type>(leaf_count_of(count)));
+
+      hash_leaves(data, static_cast<std::size_t>(UINT8_C(0)), my_levels.front().size());
+
+      build_inner_levels();
+    }
+
+    // Hash again only the leaves that overlap the modified byte range
+    // [offset, offset + length) of the image, which has already been
+    // modified, and their paths to the root. If the size of the image
+    // has changed, the leaves from the modified range to the end of the
+    // image are hashed again and the inner levels are rebuilt.
+    auto update(const std::uint8_t* data, const std::size_t count, const std::size_t offset, const std::size_t length) -> void
+    {
+      if(my_levels.empty())
+      {
+        hash(data, count);
+
+        return;
+      }
+
+      const auto leaf_first = (std::min)(static_cast<std::size_t>(offset / my_leaf_size), my_levels.front().size());
+
+      if(count != my_image_size)
+      {
+        // The leaf that was the last one may have been shorter. If the
+        // image has shrunk, the leaf that holds its new end is shorter
+        // now, even when the modified range lies beyond the new end.
+        const auto leaf_count_resized = leaf_count_of(count);
+
+        const auto leaf_first_resized =
+          (std::min)
+          (
+            (std::min)(leaf_first, static_cast<std::size_t>(my_levels.front().size() - static_cast<std::size_t>(UINT8_C(1)))),
+            static_cast<std::size_t>(leaf_count_resized - static_cast<std::size_t>(UINT8_C(1)))
+          );
+
+        my_image_size = count;
+
+        my_levels.resize(static_cast<std::size_t>(UINT8_C(1)));
+
+        my_levels.front().resize(leaf_count_resized);
+
+        hash_leaves(data, leaf_first_resized, leaf_count_resized);
+
+        build_inner_levels();
+
+        return;
+      }
+
+      if(length == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        return;
+      }
+
+      const auto leaf_last = (std::min)(static_cast<std::size_t>(((offset + length) - static_cast<std::size_t>(UINT8_C(1))) / my_leaf_size) + static_cast<std::size_t>(UINT8_C(1)),
+                                        my_levels.front().size());
+
+      hash_leaves(data, leaf_first, leaf_last);
+
+      // Hash again the parents of the modified nodes, level by level.
+      auto node_first = leaf_first;
+      auto node_last  = leaf_last;
+
+      for(std::size_t level = static_cast<std::size_t>(UINT8_C(1)); level < my_levels.size(); ++level)
+      {
+        node_first = static_cast<std::size_t>(node_first / 2U);
+        node_last  = static_cast<std::size_t>((node_last + 1U) / 2U);
+
+        for(auto node = node_first; node < node_last; ++node)
+        {
+          hash_node(level, node);
+        }
+      }
+    }
+
+    auto get_result(typename result_type::pointer result) const -> void
+    {
+      const auto root = (my_levels.empty() ? hash_leaf(nullptr, static_cast<std::size_t>(UINT8_C(0))) : my_levels.back().front());
+
+      std::copy(root.cbegin(), root.cend(), result);
+    }
+
+    auto leaf_size () const noexcept -> std::size_t { return my_leaf_size; }
+    auto image_size() const noexcept -> std::size_t { return my_image_size; }
+    auto leaf_count() const noexcept -> std::size_t { return (my_levels.empty() ? static_cast<std::size_t>(UINT8_C(0)) : my_levels.front().size()); }
+
+    // Save the leaf digests in a text format: a header line with the
+    // leaf size, the image size and the number of leaves, followed by
+    // one hexadecimal digest per leaf.
+    auto save(std::ostream& os) const -> bool
+    {
+      os << "hash_sha256_tree 1 " << my_leaf_size << ' ' << my_image_size << ' ' << leaf_count() << '\n';
+
+      for(auto leaf = static_cast<std::size_t>(UINT8_C(0)); leaf < leaf_count(); ++leaf)
+      {
+        for(const auto& byte : my_levels.front()[leaf])
+        {
+          os << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned>(byte);
+        }
+
+        os << std::dec << '\n';
+      }
+
+      return static_cast<bool>(os);
+    }
+
+    // Load the leaf digests that have been saved with save() and rebuild
+    // the inner levels. The leaf size must match the one of this tree.
+    auto load(std::istream& is) -> bool
+    {
+      std::string format { };
+      int         version { };
+      std::size_t leaf_size_of_stream { };
+      std::size_t image_size_of_stream { };
+      std::size_t leaf_count_of_stream { };
+
+      is >> format >> version >> leaf_size_of_stream >> image_size_of_stream >> leaf_count_of_stream;
+
+      const auto header_is_ok =
+        (    static_cast<bool>(is)
+         && (format == "hash_sha256_tree")
+         && (version == 1)
+         && (leaf_size_of_stream == my_leaf_size)
+         && (leaf_count_of_stream == leaf_count_of(image_size_of_stream)));
+
+      if(!header_is_ok)
+      {
+        return false;
+      }
+
+      std::vector<result_type> leaves(leaf_count_of_stream);
+
+      for(auto& leaf : leaves)
+      {
+        std::string text { };
+
+        is >> text;
+
+        if((!is) || (text.size() != static_cast<std::size_t>(leaf.size() * 2U)))
+        {
+          return false;
+        }
+
+        for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < leaf.size(); ++index)
+        {
+          std::uint8_t nibble_hi { };
+          std::uint8_t nibble_lo { };
+
+          if(   (!hex_nibble(text[static_cast<std::size_t>(index * 2U)],      nibble_hi))
+             || (!hex_nibble(text[static_cast<std::size_t>(index * 2U) + 1U], nibble_lo)))
+          {
+            return false;
+          }
+
+          leaf[index] = static_cast<std::uint8_t>(static_cast<unsigned>(nibble_hi << 4U) | nibble_lo);
+        }
+      }
+
+      my_image_size = image_size_of_stream;
+
+      my_levels.assign(static_cast<std::size_t>(UINT8_C(1)), std::move(leaves));
+
+      build_inner_levels();
+
+      return true;
+    }
+
+  private:
+    const std::size_t my_leaf_size;
+    const std::size_t my_thread_count;
+
+    std::size_t my_image_size { };
+
+    // The digests of the leaves (level 0) up to the root (last level).
+    std::vector<std::vector<result_type>> my_levels { };
+
+    auto leaf_count_of(const std::size_t count) const -> std::size_t
+    {
+      // Even an empty image has one (empty) leaf.
+      return (std::max)(static_cast<std::size_t>((count + (my_leaf_size - 1U)) / my_leaf_size), static_cast<std::size_t>(UINT8_C(1)));
+    }
+
+    // Get the value of a hexadecimal digit. Return false for any
+    // other character, so that a corrupt stream is not loaded.
+    static auto hex_nibble(const char c, std::uint8_t& nibble) -> bool
+    {
+      const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
+      const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
+      const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+
+      if     (char_is_a_to_f_lo) { nibble = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
+      else if(char_is_a_to_f_hi) { nibble = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
+      else if(char_is_0_to_9)    { nibble = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+
+      return (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+    }
+
+    static auto hash_leaf(const std::uint8_t* data, const std::size_t count) -> result_type
+    {
+      constexpr std::uint8_t prefix { UINT8_C(0x00) };
+
+      hash_type hash_object { };
+
+      hash_object.initialize();
+      hash_object.process(&prefix, static_cast<std::uint64_t>(UINT8_C(1)));
+      hash_object.process(data, static_cast<std::uint64_t>(count));
+      hash_object.finalize();
+
+      result_type result { };
+
+      hash_object.get_result(result.data());
+
+      return result;
+    }
+
+    auto hash_node(const std::size_t level, const std::size_t node) -> void
+    {
+      const auto& children = my_levels[level - 1U];
+
+      const auto child = static_cast<std::size_t>(node * 2U);
+
+      if((child + 1U) < children.size())
+      {
+        constexpr std::uint8_t prefix { UINT8_C(0x01) };
+
+        hash_type hash_object { };
+
+        hash_object.initialize();
+        hash_object.process(&prefix, static_cast<std::uint64_t>(UINT8_C(1)));
+        hash_object.process(children[child].data(),      static_cast<std::uint64_t>(std::tuple_size<result_type>::value));
+        hash_object.process(children[child + 1U].data(), static_cast<std::uint64_t>(std::tuple_size<result_type>::value));
+        hash_object.finalize();
+
+        hash_object.get_result(my_levels[level][node].data());
+      }
+      else
+      {
+        // Promote the odd node at the end of the level.
+        my_levels[level][node] = children[child];
+      }
+    }
+
+    // Hash the leaves [leaf_first, leaf_last) in parallel threads.
+    auto hash_leaves(const std::uint8_t* data, const std::size_t leaf_first, const std::size_t leaf_last) -> void
+    {
+      const auto leaf_count_to_hash = static_cast<std::size_t>(leaf_last - leaf_first);
+
+      const auto thread_count = (std::min)(my_thread_count, leaf_count_to_hash);
+
+      const auto hash_range =
+        [this, data](const std::size_t first, const std::size_t last)
+        {
+          for(auto leaf = first; leaf < last; ++leaf)
+          {
+            const auto offset = static_cast<std::size_t>(leaf * my_leaf_size);
+
+            my_levels.front()[leaf] = hash_leaf(data + offset, (std::min)(my_leaf_size, static_cast<std::size_t>(my_image_size - offset)));
+          }
+        };
+
+      if(thread_count <= static_cast<std::size_t>(UINT8_C(1)))
+      {
+        hash_range(leaf_first, leaf_last);
+
+        return;
+      }
+
+      util::thread_executor { }
+      (
+        thread_count,
+        [&hash_range, leaf_first, leaf_count_to_hash, thread_count](const std::size_t thread)
+        {
+          hash_range(leaf_first + ((leaf_count_to_hash *  thread)       / thread_count),
+                     leaf_first + ((leaf_count_to_hash * (thread + 1U)) / thread_count));
+        }
+      );
+    }
+
+    auto build_inner_levels() -> void
+    {
+      my_levels.resize(static_cast<std::size_t>(UINT8_C(1)));
+
+      while(my_levels.back().size() > static_cast<std::size_t>(UINT8_C(1)))
+      {
+        const auto node_count = static_cast<std::size_t>((my_levels.back().size() + 1U) / 2U);
+
+        my_levels.emplace_back(node_count);
+
+        const auto level = static_cast<std::size_t>(my_levels.size() - 1U);
+
+        for(auto node = static_cast<std::size_t>(UINT8_C(0)); node < node_count; ++node)
+        {
+          hash_node(level, node);
+        }
+      }
+    }
+  };
+
+  } } } // namespace math::checksums::hash
+
+#endif // HASH_SHA256_TREE_2026_10_17_H
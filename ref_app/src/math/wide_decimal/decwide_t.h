@@ -24,6 +24,7 @@
   //#define WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION
   //#define WIDE_DECIMAL_NAMESPACE=something_unique // (best if done on the command line)
 
+  #include <math/wide_decimal/decwide_t_detail_constants.h>
   #include <math/wide_decimal/decwide_t_detail_ops.h>
 
   #include <util/utility/util_baselexical_cast.h>
@@ -511,7 +512,7 @@
   public:
     using limb_type           = LimbType;
     using exponent_type       = ExponentType;
-    using fft_float_type      = FftFloatType;
+    using fft_float_type      = typename detail::decwide_t_multiply_traits<FftFloatType>::fft_float_type;
     using internal_float_type = InternalFloatType;
 
     // Check the limb type.
@@ -540,7 +541,9 @@
     static constexpr std::int32_t  decwide_t_elem_mask_half = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_half;
     static constexpr std::int32_t  decwide_t_elem_mask_min1 = static_cast<std::int32_t>(decwide_t_elem_mask - static_cast<std::int32_t>(INT8_C(1)));
     static constexpr std::int32_t  decwide_t_elems_for_kara = static_cast<std::int32_t>(INT32_C( 112) + INT32_C(1));
+    static constexpr std::int32_t  decwide_t_elems_for_kpar = static_cast<std::int32_t>(INT32_C( 512));
     static constexpr std::int32_t  decwide_t_elems_for_fft  = static_cast<std::int32_t>(INT32_C(1792) + INT32_C(1));
+    static constexpr std::int32_t  decwide_t_elems_for_ntt  = detail::decwide_t_multiply_traits<FftFloatType>::elems_for_ntt;
 
     static constexpr exponent_type decwide_t_max_exp10      =  static_cast<exponent_type>(UINTMAX_C(1) << static_cast<unsigned>(std::numeric_limits<exponent_type>::digits - (std::is_same<exponent_type, std::int64_t>::value ? 4 : (std::is_same<exponent_type, std::int32_t>::value ? 3 : (std::is_same<exponent_type, std::int16_t>::value ? 2 : 1)))));
     static constexpr exponent_type decwide_t_min_exp10      = -static_cast<exponent_type>(decwide_t_max_exp10);
@@ -602,35 +605,6 @@
     };
 
   private:
-    #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
-    // LCOV_EXCL_START
-    // Static data initializer
-    struct initializer
-    {
-      initializer() noexcept
-      {
-        static_cast<void>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_value_pi());
-        static_cast<void>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_value_ln_two());
-      }
-
-      initializer(const initializer&) = delete;
-      initializer(initializer&&) = delete;
-
-      auto operator=(const initializer&) noexcept -> initializer& = delete;
-      auto operator=(initializer&&) noexcept -> initializer& = delete;
-
-      ~initializer() noexcept = default;
-
-      auto do_nothing() const noexcept -> void
-      {
-        // Do nothing on purpose.
-      }
-    };
-
-    static const initializer my_initializer;
-    // LCOV_EXCL_STOP
-    #endif
-
     #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
     static auto wr_string(const decwide_t&         x,
                                 std::string&       str, // NOLINT(google-runtime-references)
@@ -1670,14 +1644,20 @@
     }
 
     #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+    // The cached constants are created lazily on their first use,
+    // which is thread-safe for function-local statics on the host.
+    // Up to the precision of the constant tables, they are taken from
+    // read-only memory. Above this, they are calculated just once.
     static auto my_value_pi() -> const decwide_t&
     {
-      my_initializer.do_nothing();
+      using table_type = detail::decwide_t_constant_table_pi<>;
 
       static const decwide_t
         val
         (
-          calc_pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()
+          detail::constant_table_fits<limb_type, table_type>(decwide_t_elem_number)
+            ? from_constant_table<table_type>()
+            : calc_pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()
         );
 
       return val;
@@ -1685,12 +1665,14 @@
 
     static auto my_value_ln_two() -> const decwide_t&
     {
-      my_initializer.do_nothing();
+      using table_type = detail::decwide_t_constant_table_ln_two<>;
 
       static const decwide_t
         val
         (
-          calc_ln_two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()
+          detail::constant_table_fits<limb_type, table_type>(decwide_t_elem_number)
+            ? from_constant_table<table_type>()
+            : calc_ln_two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()
         );
 
       return val;
@@ -1932,14 +1914,57 @@
         vi.precision(new_prec_as_digits10);
          x.precision(new_prec_as_digits10);
 
-        // Next iteration of vi
-        vi += vi * (((*this * vi) * static_cast<std::int32_t>(INT8_C(-2))) + one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        // The products (*this * vi) and (*this)^2 are independent of each other.
+        // If the calling thread has an executor, evaluate them concurrently.
+        // This is done below the FFT, which is itself split into partitions.
+        const auto sub_terms_parallel =
+          (   (detail::executor_partition_count() > static_cast<std::size_t>(UINT8_C(1)))
+           && (my_prec_elem >= decwide_t_elems_for_kara)
+           && (my_prec_elem <  decwide_t_elems_for_fft));
+
+        if(sub_terms_parallel)
+        {
+          decwide_t this_times_vi(*this);
+          decwide_t this_squared (*this);
 
-        // Next iteration of *this
-        static_cast<void>
-        (
-          operator+=(vi * (-((*this) * (*this)) + x))
-        );
+          detail::executor_run
+          (
+            static_cast<std::size_t>(UINT8_C(2)),
+            [this, &vi, &this_times_vi, &this_squared](const std::size_t partition)
+            {
+              if(partition == static_cast<std::size_t>(UINT8_C(0)))
+              {
+                static_cast<void>(this_times_vi *= vi);
+              }
+              else
+              {
+                static_cast<void>(this_squared *= *this);
+              }
+            }
+          );
+
+          // Next iteration of vi
+          vi += vi * ((this_times_vi * static_cast<std::int32_t>(INT8_C(-2))) + one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+
+          // Next iteration of *this
+          static_cast<void>
+          (
+            operator+=(vi * (-this_squared + x))
+          );
+        }
+        else
+        #endif
+        {
+          // Next iteration of vi
+          vi += vi * (((*this * vi) * static_cast<std::int32_t>(INT8_C(-2))) + one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+
+          // Next iteration of *this
+          static_cast<void>
+          (
+            operator+=(vi * (-((*this) * (*this)) + x))
+          );
+        }
       }
 
       my_prec_elem = original_prec_elem;
@@ -2602,6 +2627,45 @@
       return a;
     }
 
+    template<typename ConstantTableType>
+    static auto from_constant_table() -> decwide_t
+    {
+      // Initialization from the limbs of a constant table in program
+      // memory, see decwide_t_detail_constants.h. Limbs beyond the table
+      // are zero.
+      auto a = decwide_t { };
+
+      const auto has_integer_part = (ConstantTableType::integer_part != static_cast<std::uint32_t>(UINT8_C(0)));
+
+      auto it = a.my_data.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      if(has_integer_part)
+      {
+        *it++ = static_cast<limb_type>(ConstantTableType::integer_part);
+      }
+
+      const auto limb_count =
+        (std::min)
+        (
+          static_cast<std::size_t>(a.my_data.end() - it),
+          static_cast<std::size_t>(static_cast<std::size_t>(detail::constant_table_fraction_size() * static_cast<std::size_t>(detail::constant_table_entry_digits10())) / static_cast<std::size_t>(decwide_t_elem_digits10))
+        );
+
+      for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < limb_count; ++index)
+      {
+        *it++ = detail::constant_table_fraction_limb<limb_type, ConstantTableType>(index);
+      }
+
+      std::fill(it, a.my_data.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      a.my_exp       = (has_integer_part ? static_cast<exponent_type>(INT8_C(0)) : static_cast<exponent_type>(-decwide_t_elem_digits10));
+      a.my_neg       = false;
+      a.my_fpclass   = fpclass_type::decwide_t_finite;
+      a.my_prec_elem = decwide_t_elem_number;
+
+      return a;
+    }
+
     static constexpr auto decwide_t_digits10_for_epsilon() -> std::int32_t
     {
       return
@@ -2623,11 +2687,79 @@
 
   private:
     #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    using fft_mul_storage_type = util::dynamic_array<fft_float_type>;
+
+    struct fft_mul_workspace_type
+    {
+      fft_mul_storage_type af_pool        { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      fft_mul_storage_type bf_pool        { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      fft_mul_storage_type twiddle_pool   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::uint32_t        twiddle_points { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    static auto fft_mul_workspace(const std::uint32_t n_fft) -> fft_mul_workspace_type&
+    {
+      thread_local fft_mul_workspace_type my_workspace { };
+
+      if(my_workspace.twiddle_points < n_fft)
+      {
+        my_workspace.af_pool        = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
+        my_workspace.bf_pool        = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
+        my_workspace.twiddle_pool   = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft * 2U));
+        my_workspace.twiddle_points = n_fft;
+
+        detail::fft::fft_twiddles_make(n_fft, my_workspace.twiddle_pool.data());
+      }
+
+      return my_workspace;
+    }
+
+    using ntt_mul_storage_type = util::dynamic_array<std::uint64_t>;
+
+    struct ntt_mul_workspace_type
+    {
+      ntt_mul_storage_type data_pool      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      ntt_mul_storage_type twiddle_pool   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::uint32_t        twiddle_points { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    static auto ntt_mul_workspace(const std::uint32_t n_ntt) -> ntt_mul_workspace_type&
+    {
+      thread_local ntt_mul_workspace_type my_workspace { };
+
+      if(my_workspace.twiddle_points < n_ntt)
+      {
+        my_workspace.data_pool      = ntt_mul_storage_type(static_cast<typename ntt_mul_storage_type::size_type>(n_ntt * 4U));
+        my_workspace.twiddle_pool   = ntt_mul_storage_type(static_cast<typename ntt_mul_storage_type::size_type>(n_ntt * 6U));
+        my_workspace.twiddle_points = n_ntt;
+
+        static_cast<void>(detail::ntt::ntt_twiddles_make(n_ntt, my_workspace.twiddle_pool.data()));
+      }
+
+      return my_workspace;
+    }
     #else
     static std::array<limb_type,      static_cast<std::size_t>((decwide_t_elems_for_kara - 1) * 2)>                                                                                               my_school_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     static std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_fft - 1)) * 8UL))> my_kara_mul_pool;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
     static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_af_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_bf_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 8UL))>       my_fft_twiddle_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::uint32_t my_fft_twiddle_points; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    // The NTT pools are only sized when the NTT can be reached at all.
+    using ntt_mul_pool_type =
+      std::array<std::uint64_t,
+                 static_cast<std::size_t>
+                 (
+                     ((decwide_t_elem_number >= decwide_t_elems_for_ntt) ? detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(decwide_t_elem_number)) : static_cast<std::uint32_t>(UINT8_C(1)))
+                   * 4UL
+                 )>;
+
+    using ntt_twiddle_pool_type = std::array<std::uint64_t, static_cast<std::size_t>(std::tuple_size<ntt_mul_pool_type>::value * 3UL / 2UL)>;
+
+    static ntt_mul_pool_type     my_ntt_mul_pool;     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static ntt_twiddle_pool_type my_ntt_twiddle_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::uint32_t my_ntt_twiddle_points; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     static representation_type my_n_data_for_add_sub; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     #endif
 
@@ -2903,6 +3035,12 @@
           detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
 
         #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        // Evaluate the upper level of the Karatsuba multiplication in parallel,
+        // if the calling thread has an executor (see decwide_t_detail_executor.h).
+        const auto kara_parallel =
+          (   (detail::executor_partition_count() > static_cast<std::size_t>(UINT8_C(1)))
+           && (kara_elems_for_multiply >= static_cast<std::uint32_t>(decwide_t_elems_for_kpar)));
+
         using kara_mul_pool_type = util::dynamic_array<limb_type>;
 
         auto my_kara_mul_pool =
@@ -2911,7 +3049,7 @@
             static_cast<typename kara_mul_pool_type::size_type>
             (
                 static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
+              * static_cast<typename kara_mul_pool_type::size_type>(kara_parallel ? UINT8_C(12) : UINT8_C(8))
             )
           );
         #endif
@@ -2927,11 +3065,24 @@
         std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
-                                                u_local,
-                                                v_local,
-                                                kara_elems_for_multiply,
-                                                t);
+        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        if(kara_parallel)
+        {
+          detail::eval_multiply_kara_n_by_n_to_2n_parallel(result,
+                                                           u_local,
+                                                           v_local,
+                                                           kara_elems_for_multiply,
+                                                           t);
+        }
+        else
+        #endif
+        {
+          detail::eval_multiply_kara_n_by_n_to_2n(result,
+                                                  u_local,
+                                                  v_local,
+                                                  kara_elems_for_multiply,
+                                                  t);
+        }
 
         // Handle a potential carry.
         if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -3025,6 +3176,12 @@
           detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
 
         #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        // Evaluate the upper level of the Karatsuba multiplication in parallel,
+        // if the calling thread has an executor (see decwide_t_detail_executor.h).
+        const auto kara_parallel =
+          (   (detail::executor_partition_count() > static_cast<std::size_t>(UINT8_C(1)))
+           && (kara_elems_for_multiply >= static_cast<std::uint32_t>(decwide_t_elems_for_kpar)));
+
         using kara_mul_pool_type = util::dynamic_array<limb_type>;
 
         auto my_kara_mul_pool =
@@ -3033,7 +3190,7 @@
             static_cast<typename kara_mul_pool_type::size_type>
             (
                 static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
+              * static_cast<typename kara_mul_pool_type::size_type>(kara_parallel ? UINT8_C(12) : UINT8_C(8))
             )
           );
         #endif
@@ -3049,11 +3206,24 @@
         std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
         std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
-                                                u_local,
-                                                v_local,
-                                                kara_elems_for_multiply,
-                                                t);
+        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        if(kara_parallel)
+        {
+          detail::eval_multiply_kara_n_by_n_to_2n_parallel(result,
+                                                           u_local,
+                                                           v_local,
+                                                           kara_elems_for_multiply,
+                                                           t);
+        }
+        else
+        #endif
+        {
+          detail::eval_multiply_kara_n_by_n_to_2n(result,
+                                                  u_local,
+                                                  v_local,
+                                                  kara_elems_for_multiply,
+                                                  t);
+        }
 
         // Handle a potential carry.
         if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -3078,50 +3248,118 @@
       }
       else if(prec_elems_for_multiply >= decwide_t_elems_for_fft)
       {
-        // Use FFT-based multiplication.
+        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
-        // Determine the required FFT size n_fft,
-        // where n_fft must be a power of two.
+        if(prec_elems_for_multiply >= decwide_t_elems_for_ntt)
+        {
+          // Use exact NTT-based multiplication.
 
-        // We use half-limbs in the FFT in order to reduce
-        // the size of the data points in the FFTs.
-        // This helps preserve precision for large
-        // array lengths.
+          // The NTT size n_ntt (a power of two) must contain the
+          // (n * n -> 2n) multiplication result, where each point
+          // of the transforms holds 16 decimal digits.
+          const auto n_points_in =
+            static_cast<std::uint32_t>
+            (
+                static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) + static_cast<std::uint32_t>(detail::ntt_limbs_per_point<limb_type>() - 1U))
+              / detail::ntt_limbs_per_point<limb_type>()
+            );
 
-        // The size is doubled in order to contain the multiplication
-        // result. This is because we are performing (n * n -> 2n)
-        // multiplication. Furthermore, the FFT size is doubled again
-        // since half-limbs are used.
+          const auto n_ntt =
+            static_cast<std::uint32_t>
+            (
+              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(n_points_in * 2U) - 1U))
+            );
 
-        // Obtain the needed FFT size doubled (and doubled again),
-        // with the added condition of needing to be a power of 2.
-        const auto n_fft =
-          static_cast<std::uint32_t>
-          (
-              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems_for_multiply))
-            * static_cast<std::uint32_t>(UINT8_C(4))
-          );
+          #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+          // The NTT arrays and the twiddle tables are kept per thread
+          // and grow with the largest NTT size needed so far.
+          auto& my_ntt_mul_workspace = ntt_mul_workspace(n_ntt);
 
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using fft_mul_storage_type = util::dynamic_array<fft_float_type>;
+          auto& my_ntt_mul_pool = my_ntt_mul_workspace.data_pool;
 
-        auto my_af_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
-        auto my_bf_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
-        #endif
+          const auto my_ntt_twiddles =
+            detail::ntt::ntt_twiddles_view(my_ntt_mul_workspace.twiddle_points, my_ntt_mul_workspace.twiddle_pool.data());
+          #else
+          if(my_ntt_twiddle_points == static_cast<std::uint32_t>(UINT8_C(0)))
+          {
+            my_ntt_twiddle_points = static_cast<std::uint32_t>(my_ntt_mul_pool.size() / 4U);
 
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+            static_cast<void>(detail::ntt::ntt_twiddles_make(my_ntt_twiddle_points, my_ntt_twiddle_pool.data()));
+          }
+
+          const auto my_ntt_twiddles = detail::ntt::ntt_twiddles_view(my_ntt_twiddle_points, my_ntt_twiddle_pool.data());
+          #endif
+
+          detail::mul_loop_ntt(my_data.data(),
+                               const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               my_ntt_mul_pool.data(),
+                               my_ntt_twiddles,
+                               static_cast<std::int32_t>(prec_elems_for_multiply),
+                               n_ntt,
+                               static_cast<std::int32_t>(prec_elems_for_multiply));
+        }
+        else
+        {
+          // Use FFT-based multiplication.
+
+          // Determine the required FFT size n_fft,
+          // where n_fft must be a power of two.
+
+          // We use half-limbs in the FFT in order to reduce
+          // the size of the data points in the FFTs.
+          // This helps preserve precision for large
+          // array lengths.
+
+          // The size is doubled in order to contain the multiplication
+          // result. This is because we are performing (n * n -> 2n)
+          // multiplication. Furthermore, the FFT size is doubled again
+          // since half-limbs are used.
+
+          // Obtain the needed FFT size doubled (and doubled again),
+          // with the added condition of needing to be a power of 2.
+          const auto n_fft =
+            static_cast<std::uint32_t>
+            (
+                detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems_for_multiply))
+              * static_cast<std::uint32_t>(UINT8_C(4))
+            );
+
+          #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+          // The FFT arrays and the twiddle tables are kept per thread
+          // and grow with the largest FFT size needed so far.
+          auto& my_fft_mul_workspace = fft_mul_workspace(n_fft);
+
+          auto& my_af_fft_mul_pool   = my_fft_mul_workspace.af_pool;
+          auto& my_bf_fft_mul_pool   = my_fft_mul_workspace.bf_pool;
+
+          const auto my_fft_twiddles =
+            detail::fft::fft_twiddles_view(my_fft_mul_workspace.twiddle_points, my_fft_mul_workspace.twiddle_pool.data());
+          #else
+          if(my_fft_twiddle_points == static_cast<std::uint32_t>(UINT8_C(0)))
+          {
+            my_fft_twiddle_points = static_cast<std::uint32_t>(my_af_fft_mul_pool.size());
 
-        detail::mul_loop_fft(my_data.data(),
-                             const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             my_af_fft_mul_pool.data(),
-                             my_bf_fft_mul_pool.data(),
-                             static_cast<std::int32_t>(prec_elems_for_multiply),
-                             n_fft);
+            detail::fft::fft_twiddles_make(my_fft_twiddle_points, my_fft_twiddle_pool.data());
+          }
+
+          const auto my_fft_twiddles = detail::fft::fft_twiddles_view(my_fft_twiddle_points, my_fft_twiddle_pool.data());
+          #endif
+
+          detail::mul_loop_fft(my_data.data(),
+                               const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               my_af_fft_mul_pool.data(),
+                               my_bf_fft_mul_pool.data(),
+                               my_fft_twiddles,
+                               static_cast<std::int32_t>(prec_elems_for_multiply),
+                               n_fft,
+                               static_cast<std::int32_t>(prec_elems_for_multiply));
+        }
 
         if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
         {
-          // Adjust the exponent because of the internal scaling of the FFT multiplication.
+          // Adjust the exponent because of the internal scaling of the FFT or NTT multiplication.
           my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
         }
         else
@@ -4358,24 +4596,26 @@
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask;      // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask_half; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kpar; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_ntt;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_max_exp10; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_min_exp10; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_max_exp;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::exponent_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_min_exp;   // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
-  #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
-  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
-  const typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::initializer decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_initializer; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  #endif
-
   #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
   #else
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>((decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara - 1) * 2)>                                                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_school_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr     (static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft - 1)) * 8UL))> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kara_mul_pool;   // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_af_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_bf_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 8UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_fft_twiddle_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::uint32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_fft_twiddle_points; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::ntt_mul_pool_type     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_mul_pool;     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::ntt_twiddle_pool_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_twiddle_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::uint32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_ntt_twiddle_points; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::representation_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_n_data_for_add_sub;                                                                                                                                                                                                                                                                        // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
   #endif
 
@@ -5734,8 +5974,13 @@
     return local_wide_decimal_type(x).calculate_rootn_inv(p);
   }
 
+  // Compute log(x) with an AGM method, using the given values of pi and ln2.
+  // These are obtained once by the caller (see log and exp), such that
+  // they are not calculated again in each call when they are not cached.
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
-  auto log(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(misc-no-recursion)
+  auto log_agm(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x,
+               const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& value_pi,
+               const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& value_ln_two) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> // NOLINT(misc-no-recursion)
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
@@ -5743,7 +5988,7 @@
 
     if(x < one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
     {
-      result = -log(local_wide_decimal_type(x).calculate_inv());
+      result = -log_agm(local_wide_decimal_type(x).calculate_inv(), value_pi, value_ln_two);
     }
     else if(x > one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>())
     {
@@ -5878,9 +6123,9 @@
       // Note at this time that (ak = bk) = AGM(...)
       // Retrieve the value of pi, divide by (2 * a) and subtract (m * ln2).
 
-      result.calculate_inv() *= pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      result.calculate_inv() *= value_pi;
 
-      result -= (ln_two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>() * m);
+      result -= (value_ln_two * m);
     }
     else
     {
@@ -5890,6 +6135,14 @@
     return result;
   }
 
+  template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto log(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    return log_agm(x,
+                   pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(),
+                   ln_two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+  }
+
   template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto log(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(misc-no-recursion)
   {
@@ -6024,6 +6277,13 @@
       const local_wide_decimal_type  ln2 = ln_two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(); // LCOV_EXCL_LINE
       #endif
 
+      // Also get pi for the logarithms in the Newton iteration below.
+      #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+      const local_wide_decimal_type& value_pi = pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      #else
+      const local_wide_decimal_type  value_pi = pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(); // LCOV_EXCL_LINE
+      #endif
+
       const auto nf = static_cast<std::uint32_t>(xx / ln2);
 
       local_wide_decimal_type xh(xx - static_cast<local_wide_decimal_type>(nf * ln2));
@@ -6070,7 +6330,7 @@
 
         original_x.precision(new_prec_as_digits10);
 
-        iterate_term  = log(exp_result);
+        iterate_term  = log_agm(exp_result, value_pi, ln2);
         iterate_term.negate();
         iterate_term += original_x;
 
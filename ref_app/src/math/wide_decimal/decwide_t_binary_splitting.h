@@ -0,0 +1,870 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements the evaluation of series with rational terms
+// by binary splitting. The series of the Chudnovsky brothers for pi
+// and the series of e, log(2) and zeta(3) are provided.
+
+// The series is written as the sum of a(k) * p(0) ... p(k) / (q(0) ... q(k))
+// and the terms in [n1, n2) are combined into the integers
+//   P(n1, n2) = p(n1) ... p(n2 - 1),
+//   Q(n1, n2) = q(n1) ... q(n2 - 1),
+//   T(n1, n2) = Q(n1, n2) * sum of a(k) * p(n1) ... p(k) / (q(n1) ... q(k)),
+// with P(n1, n2) = P(n1, m) * P(m, n2), Q(n1, n2) = Q(n1, m) * Q(m, n2)
+// and T(n1, n2) = T(n1, m) * Q(m, n2) + P(n1, m) * T(m, n2).
+// Only the final ratio T/Q is calculated with decwide_t.
+
+#ifndef DECWIDE_T_BINARY_SPLITTING_2026_10_17_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_BINARY_SPLITTING_2026_10_17_H
+
+  #include <math/wide_decimal/decwide_t.h>
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+
+  #include <util/utility/util_dynamic_array.h>
+
+  #include <algorithm>
+  #include <array>
+  #include <cmath>
+  #include <cstddef>
+  #include <cstdint>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // A signed integer with the limbs of decwide_t, which are stored
+  // big-endian (most significant limb first) without leading zeros.
+  // Its products use the schoolbook, Karatsuba, FFT and NTT methods
+  // of decwide_t, but with the full (n * n -> 2n) result.
+  template<typename WideDecimalType>
+  class binary_splitting_integer final
+  {
+  public:
+    using limb_type           = typename WideDecimalType::limb_type;
+    using representation_type = util::dynamic_array<limb_type>;
+    using size_type           = typename representation_type::size_type;
+
+    binary_splitting_integer() = default;
+
+    explicit binary_splitting_integer(const std::uint64_t u)
+      : my_data(static_cast<size_type>(limb_count(u)))
+    {
+      auto x = u;
+
+      for(auto i = my_data.size(); i-- > static_cast<size_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        my_data[i] = static_cast<limb_type>(x % elem_mask());
+
+        x /= elem_mask();
+      }
+    }
+
+    // Restore an integer from its (checkpointed) limbs.
+    binary_splitting_integer(const limb_type* limbs, const size_type count, const bool is_neg)
+      : my_data(limbs, limbs + count), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        my_neg (is_neg)
+    {
+      normalize();
+    }
+
+    binary_splitting_integer(const binary_splitting_integer&) = default;
+    binary_splitting_integer(binary_splitting_integer&&) noexcept = default;
+
+    ~binary_splitting_integer() = default;
+
+    auto operator=(const binary_splitting_integer& other) -> binary_splitting_integer&
+    {
+      if(this != &other)
+      {
+        // The copy assignment of dynamic_array does not resize.
+        my_data = representation_type(other.my_data);
+        my_neg  = other.my_neg;
+      }
+
+      return *this;
+    }
+
+    auto operator=(binary_splitting_integer&&) noexcept -> binary_splitting_integer& = default;
+
+    WIDE_DECIMAL_NODISCARD auto crepresentation() const noexcept -> const representation_type& { return my_data; }
+
+    WIDE_DECIMAL_NODISCARD auto is_neg() const noexcept -> bool { return my_neg; }
+    WIDE_DECIMAL_NODISCARD auto iszero() const noexcept -> bool { return (my_data.size() == static_cast<size_type>(UINT8_C(0))); }
+
+    auto negate() -> void { my_neg = ((!iszero()) && (!my_neg)); }
+
+    // Multiply by a small factor in place.
+    auto mul_small(const std::uint32_t n) -> void
+    {
+      if(n == static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        *this = binary_splitting_integer();
+
+        return;
+      }
+
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto i = my_data.size(); i-- > static_cast<size_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_data[i]) * n) + carry);
+
+        carry      = static_cast<std::uint64_t>(t / elem_mask());
+        my_data[i] = static_cast<limb_type>(t - static_cast<std::uint64_t>(carry * elem_mask()));
+      }
+
+      if(carry != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        const binary_splitting_integer upper(carry);
+
+        representation_type r(static_cast<size_type>(upper.my_data.size() + my_data.size()));
+
+        std::copy(upper.my_data.cbegin(), upper.my_data.cend(), r.begin());
+        std::copy(my_data.cbegin(), my_data.cend(), r.begin() + static_cast<std::ptrdiff_t>(upper.my_data.size()));
+
+        my_data = static_cast<representation_type&&>(r);
+      }
+    }
+
+    friend auto operator+(const binary_splitting_integer& a, const binary_splitting_integer& b) -> binary_splitting_integer
+    {
+      if(a.iszero()) { return b; }
+      if(b.iszero()) { return a; }
+
+      if(a.my_neg == b.my_neg)
+      {
+        binary_splitting_integer result = add_magnitudes(a, b);
+
+        result.my_neg = a.my_neg;
+
+        return result;
+      }
+
+      const auto cmp = compare_magnitudes(a, b);
+
+      if(cmp == static_cast<std::int_fast8_t>(INT8_C(0)))
+      {
+        return binary_splitting_integer();
+      }
+
+      const auto& larger  = ((cmp > static_cast<std::int_fast8_t>(INT8_C(0))) ? a : b);
+      const auto& smaller = ((cmp > static_cast<std::int_fast8_t>(INT8_C(0))) ? b : a);
+
+      binary_splitting_integer result = subtract_magnitudes(larger, smaller);
+
+      result.my_neg = larger.my_neg;
+
+      return result;
+    }
+
+    friend auto operator*(const binary_splitting_integer& a, const binary_splitting_integer& b) -> binary_splitting_integer
+    {
+      if(a.iszero() || b.iszero())
+      {
+        return binary_splitting_integer();
+      }
+
+      const auto na = a.my_data.size();
+      const auto nb = b.my_data.size();
+
+      binary_splitting_integer result;
+
+      result.my_data = representation_type(static_cast<size_type>(na + nb));
+      result.my_neg  = (a.my_neg != b.my_neg);
+
+      const auto n = static_cast<std::uint32_t>((std::max)(na, nb));
+
+      // Unbalanced and small products use the schoolbook method.
+      // The others are padded to equal length with leading zeros.
+      if(   ((std::min)(na, nb) <= static_cast<size_type>(UINT8_C(32)))
+         || (n < static_cast<std::uint32_t>(WideDecimalType::decwide_t_elems_for_kara)))
+      {
+        multiply_schoolbook(result.my_data.data(), a.my_data, b.my_data);
+      }
+      else if(n < static_cast<std::uint32_t>(WideDecimalType::decwide_t_elems_for_fft))
+      {
+        const auto nk = static_cast<std::uint32_t>(detail::a029750::a029750_as_runtime_value(n));
+
+        const representation_type u = padded(a.my_data, nk);
+        const representation_type v = padded(b.my_data, nk);
+
+        representation_type r(static_cast<size_type>(nk * 2U));
+        representation_type t(static_cast<size_type>(nk * 4U));
+
+        detail::eval_multiply_kara_n_by_n_to_2n(r.data(), u.data(), v.data(), nk, t.data());
+
+        std::copy(r.cend() - static_cast<std::ptrdiff_t>(na + nb), r.cend(), result.my_data.begin());
+      }
+      else
+      {
+        const representation_type u = padded(a.my_data, n);
+        const representation_type v = padded(b.my_data, n);
+
+        using const_limb_pointer_type = const limb_type*;
+
+        representation_type r(static_cast<size_type>(n * 2U));
+
+        if(n < static_cast<std::uint32_t>(WideDecimalType::decwide_t_elems_for_ntt))
+        {
+          const auto n_fft =
+            static_cast<std::uint32_t>
+            (
+              detail::a000079::a000079_as_constexpr(n) * static_cast<std::uint32_t>(UINT8_C(4))
+            );
+
+          auto& my_fft_mul_workspace = fft_mul_workspace(n_fft);
+
+          const auto my_fft_twiddles =
+            detail::fft::fft_twiddles_view(my_fft_mul_workspace.twiddle_points, my_fft_mul_workspace.twiddle_pool.data());
+
+          detail::mul_loop_fft(r.data(),
+                               static_cast<const_limb_pointer_type>(u.data()),
+                               static_cast<const_limb_pointer_type>(v.data()),
+                               my_fft_mul_workspace.af_pool.data(),
+                               my_fft_mul_workspace.bf_pool.data(),
+                               my_fft_twiddles,
+                               static_cast<std::int32_t>(n),
+                               n_fft,
+                               static_cast<std::int32_t>(n * 2U));
+        }
+        else
+        {
+          const auto n_points_in =
+            static_cast<std::uint32_t>
+            (
+                static_cast<std::uint32_t>(n + static_cast<std::uint32_t>(detail::ntt_limbs_per_point<limb_type>() - 1U))
+              / detail::ntt_limbs_per_point<limb_type>()
+            );
+
+          const auto n_ntt =
+            static_cast<std::uint32_t>
+            (
+              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(n_points_in * 2U) - 1U))
+            );
+
+          auto& my_ntt_mul_workspace = ntt_mul_workspace(n_ntt);
+
+          const auto my_ntt_twiddles =
+            detail::ntt::ntt_twiddles_view(my_ntt_mul_workspace.twiddle_points, my_ntt_mul_workspace.twiddle_pool.data());
+
+          detail::mul_loop_ntt(r.data(),
+                               static_cast<const_limb_pointer_type>(u.data()),
+                               static_cast<const_limb_pointer_type>(v.data()),
+                               my_ntt_mul_workspace.data_pool.data(),
+                               my_ntt_twiddles,
+                               static_cast<std::int32_t>(n),
+                               n_ntt,
+                               static_cast<std::int32_t>(n * 2U));
+        }
+
+        std::copy(r.cend() - static_cast<std::ptrdiff_t>(na + nb), r.cend(), result.my_data.begin());
+      }
+
+      result.normalize();
+
+      return result;
+    }
+
+  private:
+    representation_type my_data { };
+    bool                my_neg  { false };
+
+    using fft_float_type       = typename WideDecimalType::fft_float_type;
+    using fft_mul_storage_type = util::dynamic_array<fft_float_type>;
+    using ntt_mul_storage_type = util::dynamic_array<std::uint64_t>;
+
+    struct fft_mul_workspace_type
+    {
+      fft_mul_storage_type af_pool        { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      fft_mul_storage_type bf_pool        { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      fft_mul_storage_type twiddle_pool   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::uint32_t        twiddle_points { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    struct ntt_mul_workspace_type
+    {
+      ntt_mul_storage_type data_pool      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      ntt_mul_storage_type twiddle_pool   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::uint32_t        twiddle_points { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    static constexpr auto elem_mask() -> std::uint64_t
+    {
+      return static_cast<std::uint64_t>(WideDecimalType::decwide_t_elem_mask);
+    }
+
+    static constexpr auto limb_count(const std::uint64_t u) -> std::uint32_t // NOLINT(misc-no-recursion)
+    {
+      return ((u == static_cast<std::uint64_t>(UINT8_C(0))) ? static_cast<std::uint32_t>(UINT8_C(0)) : static_cast<std::uint32_t>(limb_count(u / elem_mask()) + 1U));
+    }
+
+    static auto fft_mul_workspace(const std::uint32_t n_fft) -> fft_mul_workspace_type&
+    {
+      thread_local fft_mul_workspace_type my_workspace { };
+
+      if(my_workspace.twiddle_points < n_fft)
+      {
+        my_workspace.af_pool        = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
+        my_workspace.bf_pool        = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
+        my_workspace.twiddle_pool   = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft * 2U));
+        my_workspace.twiddle_points = n_fft;
+
+        detail::fft::fft_twiddles_make(n_fft, my_workspace.twiddle_pool.data());
+      }
+
+      return my_workspace;
+    }
+
+    static auto ntt_mul_workspace(const std::uint32_t n_ntt) -> ntt_mul_workspace_type&
+    {
+      thread_local ntt_mul_workspace_type my_workspace { };
+
+      if(my_workspace.twiddle_points < n_ntt)
+      {
+        my_workspace.data_pool      = ntt_mul_storage_type(static_cast<typename ntt_mul_storage_type::size_type>(n_ntt * 4U));
+        my_workspace.twiddle_pool   = ntt_mul_storage_type(static_cast<typename ntt_mul_storage_type::size_type>(n_ntt * 6U));
+        my_workspace.twiddle_points = n_ntt;
+
+        static_cast<void>(detail::ntt::ntt_twiddles_make(n_ntt, my_workspace.twiddle_pool.data()));
+      }
+
+      return my_workspace;
+    }
+
+    // Remove the leading zero limbs.
+    auto normalize() -> void
+    {
+      const auto it_first =
+        std::find_if(my_data.cbegin(),
+                     my_data.cend(),
+                     [](const limb_type& limb) { return (limb != static_cast<limb_type>(UINT8_C(0))); });
+
+      if(it_first != my_data.cbegin())
+      {
+        my_data = representation_type(it_first, my_data.cend());
+      }
+
+      if(iszero())
+      {
+        my_neg = false;
+      }
+    }
+
+    static auto padded(const representation_type& x, const std::uint32_t n) -> representation_type
+    {
+      representation_type result(static_cast<size_type>(n));
+
+      std::copy(x.cbegin(), x.cend(), result.end() - static_cast<std::ptrdiff_t>(x.size()));
+
+      return result;
+    }
+
+    // The result r has (a.size() + b.size()) limbs, which are zero on input.
+    static auto multiply_schoolbook(limb_type* r, const representation_type& a, const representation_type& b) -> void
+    {
+      const auto na = a.size();
+      const auto nb = b.size();
+
+      for(auto i = na; i-- > static_cast<size_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+        for(auto j = nb; j-- > static_cast<size_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto k = static_cast<size_type>(static_cast<size_type>(i + j) + 1U);
+
+          const auto t =
+            static_cast<std::uint64_t>
+            (
+                static_cast<std::uint64_t>(static_cast<std::uint64_t>(a[i]) * b[j])
+              + static_cast<std::uint64_t>(static_cast<std::uint64_t>(r[k]) + carry) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            );
+
+          carry = static_cast<std::uint64_t>(t / elem_mask());
+          r[k]  = static_cast<limb_type>(t - static_cast<std::uint64_t>(carry * elem_mask())); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        r[i] = static_cast<limb_type>(carry); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    static auto compare_magnitudes(const binary_splitting_integer& a, const binary_splitting_integer& b) -> std::int_fast8_t
+    {
+      if(a.my_data.size() != b.my_data.size())
+      {
+        return ((a.my_data.size() > b.my_data.size()) ? static_cast<std::int_fast8_t>(INT8_C(1)) : static_cast<std::int_fast8_t>(INT8_C(-1)));
+      }
+
+      const auto mismatch_pair = std::mismatch(a.my_data.cbegin(), a.my_data.cend(), b.my_data.cbegin());
+
+      if(mismatch_pair.first == a.my_data.cend())
+      {
+        return static_cast<std::int_fast8_t>(INT8_C(0));
+      }
+
+      return ((*mismatch_pair.first > *mismatch_pair.second) ? static_cast<std::int_fast8_t>(INT8_C(1)) : static_cast<std::int_fast8_t>(INT8_C(-1)));
+    }
+
+    static auto add_magnitudes(const binary_splitting_integer& a, const binary_splitting_integer& b) -> binary_splitting_integer
+    {
+      const auto na = a.my_data.size();
+      const auto nb = b.my_data.size();
+      const auto n  = static_cast<size_type>((std::max)(na, nb) + 1U);
+
+      binary_splitting_integer result;
+
+      result.my_data = representation_type(n);
+
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto k = static_cast<size_type>(UINT8_C(0)); k < n; ++k)
+      {
+        const auto ak = ((k < na) ? static_cast<std::uint64_t>(a.my_data[static_cast<size_type>(na - 1U) - k]) : static_cast<std::uint64_t>(UINT8_C(0)));
+        const auto bk = ((k < nb) ? static_cast<std::uint64_t>(b.my_data[static_cast<size_type>(nb - 1U) - k]) : static_cast<std::uint64_t>(UINT8_C(0)));
+
+        const auto t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(ak + bk) + carry);
+
+        carry = ((t >= elem_mask()) ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(UINT8_C(0)));
+
+        result.my_data[static_cast<size_type>(n - 1U) - k] = static_cast<limb_type>(t - static_cast<std::uint64_t>(carry * elem_mask()));
+      }
+
+      result.normalize();
+
+      return result;
+    }
+
+    // The magnitude of a must be larger than the magnitude of b.
+    static auto subtract_magnitudes(const binary_splitting_integer& a, const binary_splitting_integer& b) -> binary_splitting_integer
+    {
+      const auto na = a.my_data.size();
+      const auto nb = b.my_data.size();
+
+      binary_splitting_integer result;
+
+      result.my_data = representation_type(na);
+
+      auto borrow = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto k = static_cast<size_type>(UINT8_C(0)); k < na; ++k)
+      {
+        const auto ak = static_cast<std::uint64_t>(a.my_data[static_cast<size_type>(na - 1U) - k]);
+        const auto bk = static_cast<std::uint64_t>(static_cast<std::uint64_t>((k < nb) ? static_cast<std::uint64_t>(b.my_data[static_cast<size_type>(nb - 1U) - k]) : static_cast<std::uint64_t>(UINT8_C(0))) + borrow);
+
+        borrow = ((ak < bk) ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(UINT8_C(0)));
+
+        result.my_data[static_cast<size_type>(na - 1U) - k] = static_cast<limb_type>(static_cast<std::uint64_t>(ak + static_cast<std::uint64_t>(borrow * elem_mask())) - bk);
+      }
+
+      result.normalize();
+
+      return result;
+    }
+  };
+
+  // Combine the terms [n1, m) in (p, q, t) with the terms [m, n2) in (p2, q2, t2).
+  template<typename IntegerType>
+  auto binary_splitting_combine(IntegerType& p, IntegerType& q, IntegerType& t, const IntegerType& p2, const IntegerType& q2, const IntegerType& t2) -> void
+  {
+    t = (t * q2) + (p * t2);
+    q = q * q2;
+    p = p * p2;
+  }
+
+  template<typename SeriesType, typename IntegerType>
+  auto binary_splitting_split(const std::uint32_t n1, const std::uint32_t n2, IntegerType& p, IntegerType& q, IntegerType& t) -> void // NOLINT(misc-no-recursion)
+  {
+    if(static_cast<std::uint32_t>(n2 - n1) == static_cast<std::uint32_t>(UINT8_C(1)))
+    {
+      IntegerType a;
+
+      SeriesType::term(n1, p, q, a);
+
+      t = a * p;
+    }
+    else
+    {
+      const auto m = static_cast<std::uint32_t>(n1 + static_cast<std::uint32_t>(static_cast<std::uint32_t>(n2 - n1) / 2U));
+
+      IntegerType p2;
+      IntegerType q2;
+      IntegerType t2;
+
+      binary_splitting_split<SeriesType>(n1, m,  p,  q,  t);
+      binary_splitting_split<SeriesType>(m,  n2, p2, q2, t2);
+
+      binary_splitting_combine(p, q, t, p2, q2, t2);
+    }
+  }
+
+  // Calculate the ratio num/den of two integers, which can be
+  // much longer than decwide_t. Only their leading limbs are used.
+  template<typename WideDecimalType, typename IntegerType>
+  auto binary_splitting_ratio(const IntegerType& num, const IntegerType& den) -> WideDecimalType
+  {
+    if(num.iszero())
+    {
+      return WideDecimalType(static_cast<unsigned>(UINT8_C(0)));
+    }
+
+    // Each integer becomes its leading limbs scaled by elem_mask^-(n - 1).
+    const auto mantissa =
+      [](const IntegerType& x) -> WideDecimalType
+      {
+        WideDecimalType result(static_cast<unsigned>(UINT8_C(1)));
+
+        const auto count = (std::min)(static_cast<std::size_t>(x.crepresentation().size()),
+                                      static_cast<std::size_t>(result.crepresentation().size()));
+
+        std::copy(x.crepresentation().cbegin(),
+                  x.crepresentation().cbegin() + static_cast<std::ptrdiff_t>(count),
+                  result.representation().begin());
+
+        return result;
+      };
+
+    WideDecimalType result = mantissa(num) / mantissa(den);
+
+    // Scale the ratio back by the difference of the limb counts.
+    const auto scale_up = (num.crepresentation().size() >= den.crepresentation().size());
+
+    const auto scale_limbs =
+      static_cast<std::size_t>
+      (
+        scale_up ? static_cast<std::size_t>(num.crepresentation().size() - den.crepresentation().size())
+                 : static_cast<std::size_t>(den.crepresentation().size() - num.crepresentation().size())
+      );
+
+    constexpr auto elem_mask_half = static_cast<unsigned>(WideDecimalType::decwide_t_elem_mask_half);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < scale_limbs; ++i)
+    {
+      if(scale_up)
+      {
+        result *= elem_mask_half;
+        result *= elem_mask_half;
+      }
+      else
+      {
+        result /= elem_mask_half;
+        result /= elem_mask_half;
+      }
+    }
+
+    return ((num.is_neg() != den.is_neg()) ? -result : result);
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail
+  #else
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal {
+  #else
+  namespace math { namespace wide_decimal { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The state of a binary splitting, which holds the terms [0, terms).
+  // It can be saved (with the limbs and signs of p, q and t) and
+  // restored later in order to resume the series with more terms.
+  template<typename WideDecimalType>
+  struct decwide_t_binary_splitting_state
+  {
+    using integer_type = detail::binary_splitting_integer<WideDecimalType>;
+
+    std::uint32_t terms { static_cast<std::uint32_t>(UINT8_C(0)) };                 // NOLINT(misc-non-private-member-variables-in-classes)
+    integer_type  p     { static_cast<std::uint64_t>(UINT8_C(1)) };                 // NOLINT(misc-non-private-member-variables-in-classes)
+    integer_type  q     { static_cast<std::uint64_t>(UINT8_C(1)) };                 // NOLINT(misc-non-private-member-variables-in-classes)
+    integer_type  t     { };                                                        // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // pi = 426880 * sqrt(10005) * Q / T with 14 digits per term.
+  struct binary_splitting_series_pi_chudnovsky
+  {
+    static auto terms(const std::int32_t digits10) -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(digits10) / 14U) + 2U);
+    }
+
+    template<typename IntegerType>
+    static auto term(const std::uint32_t k, IntegerType& p, IntegerType& q, IntegerType& a) -> void
+    {
+      if(k == static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        p = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+        q = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+      }
+      else
+      {
+        // p(k) = -(6k - 5)(2k - 1)(6k - 1) and q(k) = k^3 * 640320^3 / 24.
+        p = IntegerType(static_cast<std::uint64_t>(static_cast<std::uint64_t>(k) * 6U) - 5U);
+        p.mul_small(static_cast<std::uint32_t>(static_cast<std::uint32_t>(k * 2U) - 1U));
+        p.mul_small(static_cast<std::uint32_t>(static_cast<std::uint32_t>(k * 6U) - 1U));
+        p.negate();
+
+        q = IntegerType(static_cast<std::uint64_t>(UINT64_C(10939058860032000)));
+        q.mul_small(k);
+        q.mul_small(k);
+        q.mul_small(k);
+      }
+
+      a = IntegerType(static_cast<std::uint64_t>(UINT32_C(13591409) + static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT32_C(545140134)) * k)));
+    }
+
+    template<typename WideDecimalType>
+    static auto value(const decwide_t_binary_splitting_state<WideDecimalType>& state) -> WideDecimalType
+    {
+      return   (sqrt(WideDecimalType(static_cast<unsigned>(UINT16_C(10005)))) * static_cast<unsigned>(UINT32_C(426880)))
+             * detail::binary_splitting_ratio<WideDecimalType>(state.q, state.t);
+    }
+  };
+
+  // e = T / Q with the terms 1 / k!.
+  struct binary_splitting_series_e
+  {
+    static auto terms(const std::int32_t digits10) -> std::uint32_t
+    {
+      // Find the first k with log10(k!) > digits10.
+      auto k = static_cast<std::uint32_t>(UINT8_C(1));
+
+      for(auto log10_factorial = static_cast<double>(0.0L); log10_factorial <= static_cast<double>(digits10); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++k;
+
+        log10_factorial += std::log10(static_cast<double>(k));
+      }
+
+      return static_cast<std::uint32_t>(k + 2U);
+    }
+
+    template<typename IntegerType>
+    static auto term(const std::uint32_t k, IntegerType& p, IntegerType& q, IntegerType& a) -> void
+    {
+      p = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+      q = IntegerType((k == static_cast<std::uint32_t>(UINT8_C(0))) ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(k));
+      a = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+    }
+
+    template<typename WideDecimalType>
+    static auto value(const decwide_t_binary_splitting_state<WideDecimalType>& state) -> WideDecimalType
+    {
+      return detail::binary_splitting_ratio<WideDecimalType>(state.t, state.q);
+    }
+  };
+
+  // log(2) = (3/4) * sum of (-1)^k (k!)^2 / (2^k (2k + 1)!) = 3T / (4Q).
+  struct binary_splitting_series_ln_two
+  {
+    static auto terms(const std::int32_t digits10) -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(digits10) * 10U) / 9U) + 2U);
+    }
+
+    template<typename IntegerType>
+    static auto term(const std::uint32_t k, IntegerType& p, IntegerType& q, IntegerType& a) -> void
+    {
+      if(k == static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        p = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+        q = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+      }
+      else
+      {
+        p = IntegerType(static_cast<std::uint64_t>(k));
+        p.negate();
+
+        q = IntegerType(static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(k) * 8U) + 4U));
+      }
+
+      a = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+    }
+
+    template<typename WideDecimalType>
+    static auto value(const decwide_t_binary_splitting_state<WideDecimalType>& state) -> WideDecimalType
+    {
+      return (detail::binary_splitting_ratio<WideDecimalType>(state.t, state.q) * static_cast<unsigned>(UINT8_C(3))) / static_cast<unsigned>(UINT8_C(4));
+    }
+  };
+
+  // zeta(3) = (1/64) * sum of (-1)^k (k!)^10 (205k^2 + 250k + 77) / ((2k + 1)!)^5
+  // (the series of Amdeberhan and Zeilberger) with 3 digits per term.
+  struct binary_splitting_series_zeta_three
+  {
+    static auto terms(const std::int32_t digits10) -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(digits10) / 3U) + 2U);
+    }
+
+    template<typename IntegerType>
+    static auto term(const std::uint32_t k, IntegerType& p, IntegerType& q, IntegerType& a) -> void
+    {
+      if(k == static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        p = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+        q = IntegerType(static_cast<std::uint64_t>(UINT8_C(1)));
+      }
+      else
+      {
+        // p(k) = -k^5 and q(k) = 32 (2k + 1)^5.
+        p = IntegerType(static_cast<std::uint64_t>(k));
+        q = IntegerType(static_cast<std::uint64_t>(UINT8_C(32)));
+
+        for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(5)); ++i)
+        {
+          if(i > static_cast<unsigned>(UINT8_C(0))) { p.mul_small(k); }
+
+          q.mul_small(static_cast<std::uint32_t>(static_cast<std::uint32_t>(k * 2U) + 1U));
+        }
+
+        p.negate();
+      }
+
+      const auto k64 = static_cast<std::uint64_t>(k);
+
+      a = IntegerType(static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(k64 * k64) * 205U) + static_cast<std::uint64_t>(k64 * 250U)) + 77U));
+    }
+
+    template<typename WideDecimalType>
+    static auto value(const decwide_t_binary_splitting_state<WideDecimalType>& state) -> WideDecimalType
+    {
+      return detail::binary_splitting_ratio<WideDecimalType>(state.t, state.q) / static_cast<unsigned>(UINT8_C(64));
+    }
+  };
+
+  // The number of terms, with which the series is converged to the
+  // precision of WideDecimalType (including its guard digits).
+  template<typename SeriesType, typename WideDecimalType>
+  auto binary_splitting_terms() -> std::uint32_t
+  {
+    return SeriesType::terms(WideDecimalType::decwide_t_max_digits10);
+  }
+
+  // Advance the state of the series up to the given number of terms.
+  // The new terms are split into partitions, which are evaluated in
+  // parallel if the calling thread has an executor (see decwide_t_executor_scope).
+  // The large products of the final combinations are split as well.
+  template<typename SeriesType, typename WideDecimalType>
+  auto binary_splitting_advance(decwide_t_binary_splitting_state<WideDecimalType>& state, const std::uint32_t terms) -> void
+  {
+    if(terms <= state.terms)
+    {
+      return;
+    }
+
+    using state_type = decwide_t_binary_splitting_state<WideDecimalType>;
+
+    constexpr auto partition_count_max     = static_cast<std::size_t>(UINT8_C(64));
+    constexpr auto terms_per_partition_min = static_cast<std::uint32_t>(UINT8_C(64));
+
+    const auto n1    = state.terms;
+    const auto count = static_cast<std::uint32_t>(terms - n1);
+
+    const auto partition_count =
+      (std::max)
+      (
+        static_cast<std::size_t>(UINT8_C(1)),
+        (std::min)((std::min)(detail::executor_partition_count(), partition_count_max),
+                   static_cast<std::size_t>(count / terms_per_partition_min))
+      );
+
+    std::array<state_type, partition_count_max> chunks { };
+
+    const auto bound =
+      [n1, count, partition_count](const std::size_t partition) -> std::uint32_t
+      {
+        return static_cast<std::uint32_t>(n1 + static_cast<std::uint32_t>((static_cast<std::uint64_t>(count) * partition) / partition_count));
+      };
+
+    detail::executor_run
+    (
+      partition_count,
+      [&chunks, &bound](const std::size_t partition)
+      {
+        auto& chunk = chunks[partition];
+
+        detail::binary_splitting_split<SeriesType>(bound(partition), bound(partition + 1U), chunk.p, chunk.q, chunk.t);
+      }
+    );
+
+    // Combine the partitions pairwise and append them to the state.
+    for(auto width = static_cast<std::size_t>(UINT8_C(1)); width < partition_count; width *= 2U)
+    {
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); (i + width) < partition_count; i += static_cast<std::size_t>(width * 2U))
+      {
+        auto&       lo = chunks[i];
+        const auto& hi = chunks[i + width];
+
+        detail::binary_splitting_combine(lo.p, lo.q, lo.t, hi.p, hi.q, hi.t);
+      }
+    }
+
+    detail::binary_splitting_combine(state.p, state.q, state.t, chunks.front().p, chunks.front().q, chunks.front().t);
+
+    state.terms = terms;
+  }
+
+  template<typename SeriesType, typename WideDecimalType>
+  auto binary_splitting_value(const decwide_t_binary_splitting_state<WideDecimalType>& state) -> WideDecimalType
+  {
+    return SeriesType::template value<WideDecimalType>(state);
+  }
+
+  template<typename SeriesType, typename WideDecimalType>
+  auto calc_binary_splitting() -> WideDecimalType
+  {
+    decwide_t_binary_splitting_state<WideDecimalType> state { };
+
+    binary_splitting_advance<SeriesType>(state, binary_splitting_terms<SeriesType, WideDecimalType>());
+
+    return binary_splitting_value<SeriesType>(state);
+  }
+
+  template<typename WideDecimalType>
+  auto calc_pi_chudnovsky() -> WideDecimalType
+  {
+    return calc_binary_splitting<binary_splitting_series_pi_chudnovsky, WideDecimalType>();
+  }
+
+  template<typename WideDecimalType>
+  auto calc_e_binary_splitting() -> WideDecimalType
+  {
+    return calc_binary_splitting<binary_splitting_series_e, WideDecimalType>();
+  }
+
+  template<typename WideDecimalType>
+  auto calc_ln_two_binary_splitting() -> WideDecimalType
+  {
+    return calc_binary_splitting<binary_splitting_series_ln_two, WideDecimalType>();
+  }
+
+  template<typename WideDecimalType>
+  auto calc_zeta_three_binary_splitting() -> WideDecimalType
+  {
+    return calc_binary_splitting<binary_splitting_series_zeta_three, WideDecimalType>();
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal
+  #else
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+  #endif // !WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+
+#endif // DECWIDE_T_BINARY_SPLITTING_2026_10_17_H
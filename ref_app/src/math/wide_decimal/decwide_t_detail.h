@@ -77,6 +77,24 @@
            typename FftFloatType      = double>
   class decwide_t;
 
+  // The multiplication policy can be given as the template parameter
+  // FftFloatType of decwide_t in place of a floating-point type. It sets
+  // the floating-point type of the FFT multiplication and the number of
+  // limbs from which on multiplications use the exact three-prime NTT
+  // instead of the FFT. The default number of limbs for the NTT lies
+  // where the rounding errors of the FFT (with double) begin to grow
+  // toward its limit of precision.
+  template<typename FftFloatType           = double,
+           const std::int32_t ElemsForNtt = static_cast<std::int32_t>(INT32_C(1048576))>
+  struct decwide_t_multiply_policy
+  {
+    using fft_float_type = FftFloatType;
+
+    static constexpr std::int32_t elems_for_ntt = ElemsForNtt;
+  };
+
+  template<typename FftFloatType, const std::int32_t ElemsForNtt> constexpr std::int32_t decwide_t_multiply_policy<FftFloatType, ElemsForNtt>::elems_for_ntt; // NOLINT(readability-redundant-declaration)
+
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_decimal
   #else
@@ -90,6 +108,28 @@
   namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)
   #endif
 
+  // The multiplication traits take FftFloatType of decwide_t either
+  // as a floating-point type (with the default NTT limbs) or as
+  // a multiplication policy.
+  template<typename FftFloatType>
+  struct decwide_t_multiply_traits
+  {
+    using fft_float_type = FftFloatType;
+
+    static constexpr std::int32_t elems_for_ntt = decwide_t_multiply_policy<FftFloatType>::elems_for_ntt;
+  };
+
+  template<typename FftFloatType, const std::int32_t ElemsForNtt>
+  struct decwide_t_multiply_traits<decwide_t_multiply_policy<FftFloatType, ElemsForNtt>>
+  {
+    using fft_float_type = FftFloatType;
+
+    static constexpr std::int32_t elems_for_ntt = ElemsForNtt;
+  };
+
+  template<typename FftFloatType> constexpr std::int32_t decwide_t_multiply_traits<FftFloatType>::elems_for_ntt; // NOLINT(readability-redundant-declaration)
+  template<typename FftFloatType, const std::int32_t ElemsForNtt> constexpr std::int32_t decwide_t_multiply_traits<decwide_t_multiply_policy<FftFloatType, ElemsForNtt>>::elems_for_ntt; // NOLINT(readability-redundant-declaration)
+
   template<typename FloatingPointType>
   class native_float_parts final
   {
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements tables of the constants pi and log(2) with
+// 1056 decimal digits after the decimal point, such that the cached
+// constants of decwide_t up to about 1000 decimal digits can be taken
+// from read-only memory instead of being calculated. The limbs of each
+// limb type are extracted from the tables when a constant is cached.
+// The tables are placed with MY_PROGMEM and read with the iterator
+// of mcal::memory::progmem::array. So on targets with a separate
+// program memory (such as the AVR), they stay in the flash memory
+// and do not take up any RAM.
+
+#ifndef DECWIDE_T_DETAIL_CONSTANTS_2026_10_17_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_CONSTANTS_2026_10_17_H
+
+  #include <math/wide_decimal/decwide_t_detail.h>
+  #include <mcal_memory/mcal_memory_progmem_array.h>
+
+  #include <cstddef>
+  #include <cstdint>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The digits after the decimal point are stored in groups of 8.
+  constexpr auto constant_table_entry_digits10() -> std::int32_t { return static_cast<std::int32_t>(INT8_C(8)); }
+
+  constexpr auto constant_table_fraction_size() -> std::size_t { return static_cast<std::size_t>(UINT8_C(132)); }
+
+  using constant_table_fraction_type = ::mcal::memory::progmem::array<std::uint32_t, static_cast<mcal_progmem_uintptr_t>(constant_table_fraction_size())>;
+
+  // The fractions are function-local statics of (non-template) inline
+  // functions, since GCC does not place the static data of a template
+  // instance in the section of MY_PROGMEM.
+  inline auto constant_table_fraction_pi() -> const constant_table_fraction_type&
+  {
+    // N[Pi, 1057]
+    static const constant_table_fraction_type my_fraction MY_PROGMEM =
+    {{
+      UINT32_C(14159265), UINT32_C(35897932), UINT32_C(38462643), UINT32_C(38327950), UINT32_C(28841971), UINT32_C(69399375),
+      UINT32_C(10582097), UINT32_C(49445923), UINT32_C( 7816406), UINT32_C(28620899), UINT32_C(86280348), UINT32_C(25342117),
+      UINT32_C( 6798214), UINT32_C(80865132), UINT32_C(82306647), UINT32_C( 9384460), UINT32_C(95505822), UINT32_C(31725359),
+      UINT32_C(40812848), UINT32_C(11174502), UINT32_C(84102701), UINT32_C(93852110), UINT32_C(55596446), UINT32_C(22948954),
+      UINT32_C(93038196), UINT32_C(44288109), UINT32_C(75665933), UINT32_C(44612847), UINT32_C(56482337), UINT32_C(86783165),
+      UINT32_C(27120190), UINT32_C(91456485), UINT32_C(66923460), UINT32_C(34861045), UINT32_C(43266482), UINT32_C(13393607),
+      UINT32_C(26024914), UINT32_C(12737245), UINT32_C(87006606), UINT32_C(31558817), UINT32_C(48815209), UINT32_C(20962829),
+      UINT32_C(25409171), UINT32_C(53643678), UINT32_C(92590360), UINT32_C( 1133053), UINT32_C( 5488204), UINT32_C(66521384),
+      UINT32_C(14695194), UINT32_C(15116094), UINT32_C(33057270), UINT32_C(36575959), UINT32_C(19530921), UINT32_C(86117381),
+      UINT32_C(93261179), UINT32_C(31051185), UINT32_C(48074462), UINT32_C(37996274), UINT32_C(95673518), UINT32_C(85752724),
+      UINT32_C(89122793), UINT32_C(81830119), UINT32_C(49129833), UINT32_C(67336244), UINT32_C( 6566430), UINT32_C(86021394),
+      UINT32_C(94639522), UINT32_C(47371907), UINT32_C( 2179860), UINT32_C(94370277), UINT32_C( 5392171), UINT32_C(76293176),
+      UINT32_C(75238467), UINT32_C(48184676), UINT32_C(69405132), UINT32_C(   56812), UINT32_C(71452635), UINT32_C(60827785),
+      UINT32_C(77134275), UINT32_C(77896091), UINT32_C(73637178), UINT32_C(72146844), UINT32_C( 9012249), UINT32_C(53430146),
+      UINT32_C(54958537), UINT32_C(10507922), UINT32_C(79689258), UINT32_C(92354201), UINT32_C(99561121), UINT32_C(29021960),
+      UINT32_C(86403441), UINT32_C(81598136), UINT32_C(29774771), UINT32_C(30996051), UINT32_C(87072113), UINT32_C(49999998),
+      UINT32_C(37297804), UINT32_C(99510597), UINT32_C(31732816), UINT32_C( 9631859), UINT32_C(50244594), UINT32_C(55346908),
+      UINT32_C(30264252), UINT32_C(23082533), UINT32_C(44685035), UINT32_C(26193118), UINT32_C(81710100), UINT32_C( 3137838),
+      UINT32_C(75288658), UINT32_C(75332083), UINT32_C(81420617), UINT32_C(17766914), UINT32_C(73035982), UINT32_C(53490428),
+      UINT32_C(75546873), UINT32_C(11595628), UINT32_C(63882353), UINT32_C(78759375), UINT32_C(19577818), UINT32_C(57780532),
+      UINT32_C(17122680), UINT32_C(66130019), UINT32_C(27876611), UINT32_C(19590921), UINT32_C(64201989), UINT32_C(38095257),
+      UINT32_C(20106548), UINT32_C(58632788), UINT32_C(65936153), UINT32_C(38182796), UINT32_C(82303019), UINT32_C(52035301)
+    }};
+
+    return my_fraction;
+  }
+
+  inline auto constant_table_fraction_ln_two() -> const constant_table_fraction_type&
+  {
+    // N[Log[2], 1056]
+    static const constant_table_fraction_type my_fraction MY_PROGMEM =
+    {{
+      UINT32_C(69314718), UINT32_C( 5599453), UINT32_C( 9417232), UINT32_C(12145817), UINT32_C(65680755), UINT32_C(  134360),
+      UINT32_C(25525412), UINT32_C( 6800094), UINT32_C(93393621), UINT32_C(96969471), UINT32_C(56058633), UINT32_C(26996418),
+      UINT32_C(68754200), UINT32_C(14810205), UINT32_C(70685733), UINT32_C(68552023), UINT32_C(57581305), UINT32_C(57032670),
+      UINT32_C(75163507), UINT32_C(59619307), UINT32_C(27570828), UINT32_C(37143519), UINT32_C( 3070386), UINT32_C(23891673),
+      UINT32_C(47112335), UINT32_C( 1153644), UINT32_C(97955239), UINT32_C(12047517), UINT32_C(26815749), UINT32_C(32065155),
+      UINT32_C(52473413), UINT32_C(95258829), UINT32_C(50453007), UINT32_C( 9532636), UINT32_C(66426541), UINT32_C( 4239157),
+      UINT32_C(81495204), UINT32_C(37404303), UINT32_C(85500801), UINT32_C(94417064), UINT32_C(16715186), UINT32_C(44712839),
+      UINT32_C(96817178), UINT32_C(45469570), UINT32_C(26271631), UINT32_C( 6454615), UINT32_C( 2572074), UINT32_C( 2481637),
+      UINT32_C(77338963), UINT32_C(85506952), UINT32_C(60668341), UINT32_C(13727387), UINT32_C(37229289), UINT32_C(56493547),
+      UINT32_C( 2576265), UINT32_C(20988596), UINT32_C(93201965), UINT32_C( 5855476), UINT32_C(47033067), UINT32_C(93654432),
+      UINT32_C(54763274), UINT32_C(49512504), UINT32_C( 6069438), UINT32_C(14710468), UINT32_C(99465062), UINT32_C(20167720),
+      UINT32_C(42452452), UINT32_C(96126879), UINT32_C(46546193), UINT32_C(16517468), UINT32_C(13926725), UINT32_C( 4103802),
+      UINT32_C(54625965), UINT32_C(68691441), UINT32_C(92871608), UINT32_C(29380317), UINT32_C(27143677), UINT32_C(82654877),
+      UINT32_C(56648508), UINT32_C(56740776), UINT32_C(48451464), UINT32_C(43994046), UINT32_C(14226031), UINT32_C(93096735),
+      UINT32_C(40257444), UINT32_C(60703080), UINT32_C(96085047), UINT32_C(48663852), UINT32_C(31381816), UINT32_C(76751438),
+      UINT32_C(66747664), UINT32_C(78908814), UINT32_C(37141985), UINT32_C(49423151), UINT32_C(99735488), UINT32_C( 3751658),
+      UINT32_C(61275352), UINT32_C(91661000), UINT32_C(71053558), UINT32_C(24987941), UINT32_C(47295092), UINT32_C(93113897),
+      UINT32_C(15599820), UINT32_C(56543928), UINT32_C(71700072), UINT32_C(18085761), UINT32_C( 2523688), UINT32_C(92132449),
+      UINT32_C(71389320), UINT32_C(37843935), UINT32_C(30887748), UINT32_C(25970171), UINT32_C(55910708), UINT32_C(82368362),
+      UINT32_C(75898425), UINT32_C(89185353), UINT32_C( 2436342), UINT32_C(14367061), UINT32_C(18923678), UINT32_C(91923723),
+      UINT32_C(14672321), UINT32_C(72053401), UINT32_C(64925687), UINT32_C(27477823), UINT32_C(44535347), UINT32_C(64811494),
+      UINT32_C(18642386), UINT32_C(77677440), UINT32_C(60695626), UINT32_C(57379600), UINT32_C(86707625), UINT32_C(71991847)
+    }};
+
+    return my_fraction;
+  }
+
+  // The table of pi.
+  template<typename UnusedType = void>
+  struct decwide_t_constant_table_pi
+  {
+    static constexpr std::uint32_t integer_part = static_cast<std::uint32_t>(UINT8_C(3));
+
+    static auto fraction() -> const constant_table_fraction_type& { return constant_table_fraction_pi(); }
+  };
+
+  // The table of log(2).
+  template<typename UnusedType = void>
+  struct decwide_t_constant_table_ln_two
+  {
+    static constexpr std::uint32_t integer_part = static_cast<std::uint32_t>(UINT8_C(0));
+
+    static auto fraction() -> const constant_table_fraction_type& { return constant_table_fraction_ln_two(); }
+  };
+
+  template<typename UnusedType> constexpr std::uint32_t decwide_t_constant_table_pi<UnusedType>::integer_part;     // NOLINT(readability-redundant-declaration)
+  template<typename UnusedType> constexpr std::uint32_t decwide_t_constant_table_ln_two<UnusedType>::integer_part; // NOLINT(readability-redundant-declaration)
+
+  // Does the table hold all of the elem_number limbs of a decwide_t?
+  template<typename LimbType, typename ConstantTableType>
+  constexpr auto constant_table_fits(const std::int32_t elem_number) -> bool
+  {
+    return
+    (
+         static_cast<std::int32_t>
+         (
+             static_cast<std::int32_t>(elem_number - ((ConstantTableType::integer_part != static_cast<std::uint32_t>(UINT8_C(0))) ? 1 : 0))
+           * decwide_t_helper_base<LimbType>::elem_digits10
+         )
+      <= static_cast<std::int32_t>(static_cast<std::int32_t>(constant_table_fraction_size()) * constant_table_entry_digits10())
+    );
+  }
+
+  // The limb with the given index after the decimal point. The entry
+  // of the table is read from the program memory.
+  template<typename LimbType, typename ConstantTableType>
+  auto constant_table_fraction_limb(const std::size_t index) -> LimbType
+  {
+    constexpr auto limbs_per_entry =
+      static_cast<std::size_t>(constant_table_entry_digits10() / decwide_t_helper_base<LimbType>::elem_digits10);
+
+    const auto entry =
+      static_cast<std::uint32_t>
+      (
+        *(ConstantTableType::fraction().cbegin() + static_cast<typename constant_table_fraction_type::difference_type>(index / limbs_per_entry))
+      );
+
+    const auto shift_digits10 =
+      static_cast<std::uint32_t>
+      (
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(limbs_per_entry - 1U) - static_cast<std::uint32_t>(index % limbs_per_entry))
+        * static_cast<std::uint32_t>(decwide_t_helper_base<LimbType>::elem_digits10)
+      );
+
+    return
+      static_cast<LimbType>
+      (
+        static_cast<std::uint32_t>(entry / pow10_maker(shift_digits10)) % static_cast<std::uint32_t>(decwide_t_helper_base<LimbType>::elem_mask)
+      );
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail
+  #else
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_CONSTANTS_2026_10_17_H
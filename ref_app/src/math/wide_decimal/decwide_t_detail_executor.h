@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements the executor hook, with which the caller
+// of decwide_t supplies the threads for parallel multiplication.
+
+#ifndef DECWIDE_T_DETAIL_EXECUTOR_2026_10_17_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_EXECUTOR_2026_10_17_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #include <cstddef>
+  #include <cstdint>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The executor of the calling thread in type-erased form.
+  // A null executor runs the partitions one after another.
+  struct decwide_t_executor_hook
+  {
+    using task_function_type     = void(*)(void*, std::size_t);
+    using executor_function_type = void(*)(void*, std::size_t, task_function_type, void*);
+
+    executor_function_type executor        { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+    void*                  context         { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t            partition_count { static_cast<std::size_t>(UINT8_C(1)) }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  inline auto executor_hook() -> decwide_t_executor_hook&
+  {
+    thread_local decwide_t_executor_hook my_hook { };
+
+    return my_hook;
+  }
+  #endif
+
+  // The number of partitions, into which the calling thread
+  // may split a large multiplication (1 without an executor).
+  inline auto executor_partition_count() -> std::size_t
+  {
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    const auto& hook = executor_hook();
+
+    return ((hook.executor != nullptr) ? hook.partition_count : static_cast<std::size_t>(UINT8_C(1)));
+    #else
+    return static_cast<std::size_t>(UINT8_C(1));
+    #endif
+  }
+
+  // Call task(partition) for each partition in [0, partition_count),
+  // in parallel if the calling thread has an executor. The tasks
+  // themselves run without the executor, so they do not split again.
+  template<typename TaskType>
+  auto executor_run(const std::size_t partition_count, TaskType task) -> void
+  {
+    #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    auto& hook = executor_hook();
+
+    if((hook.executor != nullptr) && (partition_count > static_cast<std::size_t>(UINT8_C(1))))
+    {
+      // Clear the hook while the tasks run and restore it on leaving,
+      // also if the executor or a task on the calling thread throws.
+      struct hook_restore_guard
+      {
+        explicit hook_restore_guard(decwide_t_executor_hook& hook_to_restore)
+          : my_hook_to_restore(hook_to_restore),
+            my_saved_hook     (hook_to_restore) { hook_to_restore = decwide_t_executor_hook { }; }
+
+        hook_restore_guard() = delete;
+        hook_restore_guard(const hook_restore_guard&) = delete;
+        hook_restore_guard(hook_restore_guard&&) = delete;
+
+        ~hook_restore_guard() { my_hook_to_restore = my_saved_hook; }
+
+        auto operator=(const hook_restore_guard&) -> hook_restore_guard& = delete;
+        auto operator=(hook_restore_guard&&) -> hook_restore_guard& = delete;
+
+        decwide_t_executor_hook&      my_hook_to_restore; // NOLINT(misc-non-private-member-variables-in-classes,cppcoreguidelines-avoid-const-or-ref-data-members)
+        const decwide_t_executor_hook my_saved_hook;      // NOLINT(misc-non-private-member-variables-in-classes,cppcoreguidelines-avoid-const-or-ref-data-members)
+      };
+
+      const hook_restore_guard guard(hook);
+
+      guard.my_saved_hook.executor(guard.my_saved_hook.context,
+                                   partition_count,
+                                   [](void* task_context, std::size_t partition) { (*static_cast<TaskType*>(task_context))(partition); },
+                                   &task);
+
+      return;
+    }
+    #endif
+
+    for(auto partition = static_cast<std::size_t>(UINT8_C(0)); partition < partition_count; ++partition)
+    {
+      task(partition);
+    }
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail
+  #else
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal {
+  #else
+  namespace math { namespace wide_decimal { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // While a scope is alive, the large multiplications of decwide_t on
+  // the calling thread (and the concurrent sub-terms of its square root)
+  // are split into up to partition_count partitions. The executor is
+  // called with executor(partition_count, task), and it must call
+  // task(partition) for each partition, for instance in parallel
+  // threads, before it returns. See also util_thread_executor.h.
+  template<typename ExecutorType>
+  class decwide_t_executor_scope final
+  {
+  public:
+    decwide_t_executor_scope(ExecutorType& executor, const std::size_t partition_count)
+      : my_previous_hook(detail::executor_hook())
+    {
+      auto& hook = detail::executor_hook();
+
+      hook.executor        = &execute;
+      hook.context         = &executor;
+      hook.partition_count = ((partition_count != static_cast<std::size_t>(UINT8_C(0))) ? partition_count : static_cast<std::size_t>(UINT8_C(1)));
+    }
+
+    decwide_t_executor_scope() = delete;
+    decwide_t_executor_scope(const decwide_t_executor_scope&) = delete;
+    decwide_t_executor_scope(decwide_t_executor_scope&&) = delete;
+
+    ~decwide_t_executor_scope() { detail::executor_hook() = my_previous_hook; }
+
+    auto operator=(const decwide_t_executor_scope&) -> decwide_t_executor_scope& = delete;
+    auto operator=(decwide_t_executor_scope&&) -> decwide_t_executor_scope& = delete;
+
+  private:
+    const detail::decwide_t_executor_hook my_previous_hook;
+
+    static auto execute(void* context, std::size_t partition_count, detail::decwide_t_executor_hook::task_function_type task, void* task_context) -> void
+    {
+      (*static_cast<ExecutorType*>(context))
+      (
+        partition_count,
+        [task, task_context](const std::size_t partition)
+        {
+          task(task_context, partition);
+        }
+      );
+    }
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal
+  #else
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  #endif // !WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_EXECUTOR_2026_10_17_H
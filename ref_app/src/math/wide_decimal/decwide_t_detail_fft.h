@@ -9,14 +9,44 @@
 // "Algorithm 910: A Portable C++ Multiple-Precision System for Special-Function Calculations",
 // in ACM TOMS, {VOL 37, ISSUE 4, (February 2011)} (C) ACM, 2011. http://doi.acm.org/10.1145/1916461.1916469
 
-// This file implements a somewhat naive FFT used
-// for large-digit FFT multiplication in decwide_t.
+// This file implements the FFT used for large-digit FFT
+// multiplication in decwide_t. It is an iterative radix-4 FFT
+// with precomputed twiddle tables, split real/imaginary arrays
+// and cache-blocked (depth-first) evaluation of large transforms.
 
 #ifndef DECWIDE_T_DETAIL_FFT_2013_01_08_H // NOLINT(llvm-header-guard)
   #define DECWIDE_T_DETAIL_FFT_2013_01_08_H
 
+  #include <math/wide_decimal/decwide_t_detail_executor.h>
+
+  #include <algorithm>
   #include <array>
+  #include <cmath>
+  #include <cstddef>
   #include <cstdint>
+  #include <cstring>
+
+  // The block size (in complex points) below which the transforms
+  // run breadth-first, level by level. Larger transforms are split
+  // depth-first into quarters until each quarter fits into this block,
+  // such that the inner levels run on cache-resident data.
+  #if !defined(WIDE_DECIMAL_FFT_BLOCK_POINTS)
+  #define WIDE_DECIMAL_FFT_BLOCK_POINTS 4096 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if (defined(__GNUC__) && (defined(__x86_64__) || defined(__aarch64__)) && !defined(WIDE_DECIMAL_DISABLE_FFT_VECTOR_LANES))
+  #define WIDE_DECIMAL_FFT_HAS_VECTOR_LANES
+  #endif
+
+  #if (defined(WIDE_DECIMAL_FFT_HAS_VECTOR_LANES) && defined(__x86_64__))
+  #define WIDE_DECIMAL_FFT_HAS_AVX2_LANES
+  #endif
+
+  #if defined(__GNUC__)
+  #define WIDE_DECIMAL_FFT_ALWAYS_INLINE __attribute__((always_inline)) // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define WIDE_DECIMAL_FFT_ALWAYS_INLINE
+  #endif
 
   WIDE_DECIMAL_NAMESPACE_BEGIN
 
@@ -64,292 +94,743 @@
   constexpr auto template_fast_div_by_two<long double>(long double a) -> long double { return static_cast<long double>(a / 2); }
   // LCOV_EXCL_STOP
 
+  constexpr auto fft_block_points() -> std::uint32_t { return static_cast<std::uint32_t>(WIDE_DECIMAL_FFT_BLOCK_POINTS); }
+
+  static_assert(fft_block_points() >= static_cast<std::uint32_t>(UINT8_C(4)),
+                "Error: The FFT block size must be at least four complex points");
+
+  // A real-valued sequence of num_points points is transformed as
+  // a complex sequence of num_points / 2 points. The real parts
+  // (the even points) and the imaginary parts (the odd points) are held
+  // in separate arrays of num_points / 2 elements each, such that all
+  // of the butterfly loops run over contiguous memory and vectorize.
+
+  // The twiddle factors are precomputed once for the largest transform
+  // of num_points points in a pool of 2 * num_points elements.
+  // The table of the butterfly levels holds exp(-i pi t / h) at index
+  // (h + t) for t < h, with h = 1, 2, 4, ... The table of the real-valued
+  // post-processing holds exp(-2 i pi k / num_points) at the bit-reversed
+  // position of k. Both tables remain valid for all smaller transforms.
+
   template<typename float_type>
-  constexpr auto template_sin_order_1(std::uint32_t num_points) -> float_type // NOLINT(readability-function-cognitive-complexity)
+  struct fft_twiddles
   {
-    // Mathematica command: Table[N[Sin[Pi / (2^n)], 41], {n, 1, 31, 1}]
-    return
-      (num_points == static_cast<std::uint32_t>(UINT32_C(2)       )) ? static_cast<float_type>(1.0F)                                            : // Pi / 2    : as uint64_t --> UINT64_C(0x3FF0000000000000) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(4)       )) ? static_cast<float_type>(7.0710678118654752440084436210484903928484E-01L) : // Pi / 4    : as uint64_t --> UINT64_C(0x3FE6A09E667F3BCD) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(8)       )) ? static_cast<float_type>(3.8268343236508977172845998403039886676134E-01L) : // Pi / 8    : as uint64_t --> UINT64_C(0x3FD87DE2A6AEA963) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(16)      )) ? static_cast<float_type>(1.9509032201612826784828486847702224092769E-01L) : // Pi / 16   : as uint64_t --> UINT64_C(0x3FC8F8B83C69A60B) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(32)      )) ? static_cast<float_type>(9.8017140329560601994195563888641845861137E-02L) : // Pi / 32   : as uint64_t --> UINT64_C(0x3FB917A6BC29B42C) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(64)      )) ? static_cast<float_type>(4.9067674327418014254954976942682658314745E-02L) : // Pi / 64   : as uint64_t --> UINT64_C(0x3FA91F65F10DD814) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(128)     )) ? static_cast<float_type>(2.4541228522912288031734529459282925065466E-02L) : // Pi / 128  : as uint64_t --> UINT64_C(0x3F992155F7A3667E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) <<  8U)) ? static_cast<float_type>(1.2271538285719926079408261951003212140372E-02L) : // Pi / 2^8  : as uint64_t --> UINT64_C(0x3F8921D1FCDEC784) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) <<  9U)) ? static_cast<float_type>(6.1358846491544753596402345903725809170579E-03L) : // Pi / 2^9  : as uint64_t --> UINT64_C(0x3F7921F0FE670071) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 10U)) ? static_cast<float_type>(3.0679567629659762701453654909198425189446E-03L) : // Pi / 2^10 : as uint64_t --> UINT64_C(0x3F6921F8BECCA4BA) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 11U)) ? static_cast<float_type>(1.5339801862847656123036971502640790799549E-03L) : // Pi / 2^11 : as uint64_t --> UINT64_C(0x3F5921FAAEE6472E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 12U)) ? static_cast<float_type>(7.6699031874270452693856835794857664314092E-04L) : // Pi / 2^12 : as uint64_t --> UINT64_C(0x3F4921FB2AECB360) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 13U)) ? static_cast<float_type>(3.8349518757139558907246168118138126339503E-04L) : // Pi / 2^13 : as uint64_t --> UINT64_C(0x3F3921FB49EE4EA6) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 14U)) ? static_cast<float_type>(1.9174759731070330743990956198900093346887E-04L) : // Pi / 2^14 : as uint64_t --> UINT64_C(0x3F2921FB51AEB57C) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 15U)) ? static_cast<float_type>(9.5873799095977345870517210976476351187066E-05L) : // Pi / 2^15 : as uint64_t --> UINT64_C(0x3F1921FB539ECF31) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 16U)) ? static_cast<float_type>(4.7936899603066884549003990494658872746867E-05L) : // Pi / 2^16 : as uint64_t --> UINT64_C(0x3F0921FB541AD59E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      // LCOV_EXCL_START
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 17U)) ? static_cast<float_type>(2.3968449808418218729186577165021820094761E-05L) : // Pi / 2^17 : as uint64_t --> UINT64_C(0x3EF921FB5439D73A) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 18U)) ? static_cast<float_type>(1.1984224905069706421521561596988984804732E-05L) : // Pi / 2^18 : as uint64_t --> UINT64_C(0x3EE921FB544197A1) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 19U)) ? static_cast<float_type>(5.9921124526424278428797118088908617299872E-06L) : // Pi / 2^19 : as uint64_t --> UINT64_C(0x3ED921FB544387BA) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 20U)) ? static_cast<float_type>(2.9960562263346607504548128083570598118252E-06L) : // Pi / 2^20 : as uint64_t --> UINT64_C(0x3EC921FB544403C1) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 21U)) ? static_cast<float_type>(1.4980281131690112288542788461553611206918E-06L) : // Pi / 2^21 : as uint64_t --> UINT64_C(0x3EB921FB544422C2) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 22U)) ? static_cast<float_type>(7.4901405658471572113049856673065563715596E-07L) : // Pi / 2^22 : as uint64_t --> UINT64_C(0x3EA921FB54442A83) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 23U)) ? static_cast<float_type>(3.7450702829238412390316917908463317739740E-07L) : // Pi / 2^23 : as uint64_t --> UINT64_C(0x3E9921FB54442C73) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 24U)) ? static_cast<float_type>(1.8725351414619534486882457659356361712045E-07L) : // Pi / 2^24 : as uint64_t --> UINT64_C(0x3E8921FB54442CEF) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 25U)) ? static_cast<float_type>(9.3626757073098082799067286680885620193237E-08L) : // Pi / 2^25 : as uint64_t --> UINT64_C(0x3E7921FB54442D0E) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 26U)) ? static_cast<float_type>(4.6813378536549092695115518138540096959504E-08L) : // Pi / 2^26 : as uint64_t --> UINT64_C(0x3E6921FB54442D16) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 27U)) ? static_cast<float_type>(2.3406689268274552759505493419034844037886E-08L) : // Pi / 2^27 : as uint64_t --> UINT64_C(0x3E5921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 28U)) ? static_cast<float_type>(1.1703344634137277181246213503238103798093E-08L) : // Pi / 2^28 : as uint64_t --> UINT64_C(0x3E4921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 29U)) ? static_cast<float_type>(5.8516723170686386908097901008341396943900E-09L) : // Pi / 2^29 : as uint64_t --> UINT64_C(0x3E3921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 30U)) ? static_cast<float_type>(2.9258361585343193579282304690689559020176E-09L) : // Pi / 2^30 : as uint64_t --> UINT64_C(0x3E2921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      (num_points == static_cast<std::uint32_t>(UINT32_C(1) << 31U)) ? static_cast<float_type>(1.4629180792671596805295321618659637103743E-09L) : // Pi / 2^31 : as uint64_t --> UINT64_C(0x3E1921FB54442D18) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      // LCOV_EXCL_STOP
-                                                                       static_cast<float_type>(0.0F)                                              // Pi        : as uint64_t --> UINT64_C(0x0000000000000000) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-      ;
-  }
+    const float_type* level_re; // NOLINT(misc-non-private-member-variables-in-classes)
+    const float_type* level_im; // NOLINT(misc-non-private-member-variables-in-classes)
+    const float_type* post_re;  // NOLINT(misc-non-private-member-variables-in-classes)
+    const float_type* post_im;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
 
   template<typename float_type>
-  constexpr auto template_sin_order_2(std::uint32_t num_points) -> float_type
+  auto fft_twiddles_view(std::uint32_t num_points, const float_type* pool) -> fft_twiddles<float_type>
   {
-    return template_sin_order_1<float_type>(static_cast<std::uint32_t>(num_points / 2U));
+    const auto m = static_cast<std::uint32_t>(num_points / 2U);
+
+    return
+    {
+      pool,
+      pool + m,             // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      pool + (m * 2U),      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      pool + (m * 3U)       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    };
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_real_init(std::uint32_t num_points) -> typename std::enable_if<IsForwardFft, float_type>::type
+  template<typename float_type>
+  auto fft_twiddles_make(std::uint32_t num_points, float_type* pool) -> void
   {
-    return template_sin_order_1<float_type>(num_points);
+    using std::cos;
+    using std::sin;
+
+    constexpr auto my_pi = static_cast<long double>(3.1415926535897932384626433832795028841972L); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    const auto m = static_cast<std::uint32_t>(num_points / 2U);
+
+    float_type* level_re = pool;
+    float_type* level_im = pool + m;         // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* post_re  = pool + (m * 2U);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* post_im  = pool + (m * 3U);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    level_re[0U] = template_one<float_type>(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    level_im[0U] = static_cast<float_type>(0); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto h = static_cast<std::uint32_t>(UINT8_C(1)); h < m; h <<= 1U)
+    {
+      for(auto t = static_cast<std::uint32_t>(UINT8_C(0)); t < h; ++t)
+      {
+        const auto angle = static_cast<long double>((-my_pi * static_cast<long double>(t)) / static_cast<long double>(h));
+
+        level_re[h + t] = static_cast<float_type>(cos(angle)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        level_im[h + t] = static_cast<float_type>(sin(angle)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    auto bits = static_cast<unsigned>(UINT8_C(0));
+
+    while((static_cast<std::uint32_t>(UINT32_C(1)) << bits) < m) { ++bits; } // NOLINT(altera-id-dependent-backward-branch)
+
+    for(auto p = static_cast<std::uint32_t>(UINT8_C(0)); p < m; ++p)
+    {
+      auto k = static_cast<std::uint32_t>(UINT8_C(0));
+
+      for(auto bit = static_cast<unsigned>(UINT8_C(0)); bit < bits; ++bit)
+      {
+        k = static_cast<std::uint32_t>(static_cast<std::uint32_t>(k << 1U) | static_cast<std::uint32_t>((p >> bit) & 1U));
+      }
+
+      const auto angle = static_cast<long double>((static_cast<long double>(-2) * my_pi * static_cast<long double>(k)) / static_cast<long double>(num_points));
+
+      post_re[p] = static_cast<float_type>(cos(angle)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      post_im[p] = static_cast<float_type>(sin(angle)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_real_init(std::uint32_t num_points) -> typename std::enable_if<(!IsForwardFft), float_type>::type
+  // One radix-4 decimation-in-frequency pass over a span of 4 * q
+  // complex points. This is equivalent to two radix-2 levels.
+  // The butterflies are written once for value_type, which is either
+  // float_type itself or a vector of float_type (see below). Only
+  // the butterflies t_first <= t < t_last of the pass are evaluated,
+  // and both must be multiples of the number of lanes in value_type.
+  template<typename value_type,
+           typename float_type>
+  inline WIDE_DECIMAL_FFT_ALWAYS_INLINE auto fft_dif_radix4_lanes(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
   {
-    return static_cast<float_type>(-template_sin_order_1<float_type>(num_points));
+    constexpr auto lanes = static_cast<std::uint32_t>(sizeof(value_type) / sizeof(float_type));
+
+    float_type* re1 = re  + q; float_type* im1 = im  + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* re2 = re1 + q; float_type* im2 = im1 + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* re3 = re2 + q; float_type* im3 = im2 + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const float_type* w1_re = tw.level_re + (q * 2U); const float_type* w1_im = tw.level_im + (q * 2U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const float_type* w2_re = tw.level_re +  q;       const float_type* w2_im = tw.level_im +  q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto t = t_first; t < t_last; t += lanes)
+    {
+      value_type x0r; value_type x0i; value_type x1r; value_type x1i;
+      value_type x2r; value_type x2i; value_type x3r; value_type x3i;
+      value_type w1r; value_type w1i; value_type w2r; value_type w2i;
+
+      std::memcpy(&x0r, re  + t, sizeof(value_type)); std::memcpy(&x0i, im  + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x1r, re1 + t, sizeof(value_type)); std::memcpy(&x1i, im1 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x2r, re2 + t, sizeof(value_type)); std::memcpy(&x2i, im2 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x3r, re3 + t, sizeof(value_type)); std::memcpy(&x3i, im3 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      std::memcpy(&w1r, w1_re + t, sizeof(value_type)); std::memcpy(&w1i, w1_im + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&w2r, w2_re + t, sizeof(value_type)); std::memcpy(&w2i, w2_im + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const value_type a0r = x0r + x2r; const value_type a0i = x0i + x2i;
+      const value_type a1r = x0r - x2r; const value_type a1i = x0i - x2i;
+      const value_type b0r = x1r + x3r; const value_type b0i = x1i + x3i;
+      const value_type b1r = x1r - x3r; const value_type b1i = x1i - x3i;
+
+      const value_type w3r = (w1r * w2r) - (w1i * w2i);
+      const value_type w3i = (w1r * w2i) + (w1i * w2r);
+
+      // x[t] = a0 + b0, x[t + q] = (a0 - b0) * w^2t
+      const value_type y0r = a0r + b0r; const value_type y0i = a0i + b0i;
+
+      const value_type cr = a0r - b0r; const value_type ci = a0i - b0i;
+
+      const value_type y1r = (cr * w2r) - (ci * w2i);
+      const value_type y1i = (cr * w2i) + (ci * w2r);
+
+      // x[t + 2q] = (a1 - i b1) * w^t, x[t + 3q] = (a1 + i b1) * w^3t
+      const value_type dr = a1r + b1i; const value_type di = a1i - b1r;
+      const value_type er = a1r - b1i; const value_type ei = a1i + b1r;
+
+      const value_type y2r = (dr * w1r) - (di * w1i);
+      const value_type y2i = (dr * w1i) + (di * w1r);
+      const value_type y3r = (er * w3r) - (ei * w3i);
+      const value_type y3i = (er * w3i) + (ei * w3r);
+
+      std::memcpy(re  + t, &y0r, sizeof(value_type)); std::memcpy(im  + t, &y0i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re1 + t, &y1r, sizeof(value_type)); std::memcpy(im1 + t, &y1i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re2 + t, &y2r, sizeof(value_type)); std::memcpy(im2 + t, &y2i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re3 + t, &y3r, sizeof(value_type)); std::memcpy(im3 + t, &y3i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_imag(std::uint32_t num_points) -> typename std::enable_if<IsForwardFft, float_type>::type
+  // One radix-4 decimation-in-time pass over a span of 4 * q complex
+  // points with conjugate twiddles. This undoes fft_dif_radix4_lanes
+  // (up to the factor of 4).
+  template<typename value_type,
+           typename float_type>
+  inline WIDE_DECIMAL_FFT_ALWAYS_INLINE auto fft_dit_radix4_lanes(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
   {
-    return template_sin_order_2<float_type>(num_points);
+    constexpr auto lanes = static_cast<std::uint32_t>(sizeof(value_type) / sizeof(float_type));
+
+    float_type* re1 = re  + q; float_type* im1 = im  + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* re2 = re1 + q; float_type* im2 = im1 + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    float_type* re3 = re2 + q; float_type* im3 = im2 + q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const float_type* w1_re = tw.level_re + (q * 2U); const float_type* w1_im = tw.level_im + (q * 2U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const float_type* w2_re = tw.level_re +  q;       const float_type* w2_im = tw.level_im +  q; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto t = t_first; t < t_last; t += lanes)
+    {
+      value_type x0r; value_type x0i; value_type x1r; value_type x1i;
+      value_type x2r; value_type x2i; value_type x3r; value_type x3i;
+      value_type w1r; value_type w1i; value_type w2r; value_type w2i;
+
+      std::memcpy(&x0r, re  + t, sizeof(value_type)); std::memcpy(&x0i, im  + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x1r, re1 + t, sizeof(value_type)); std::memcpy(&x1i, im1 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x2r, re2 + t, sizeof(value_type)); std::memcpy(&x2i, im2 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&x3r, re3 + t, sizeof(value_type)); std::memcpy(&x3i, im3 + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      std::memcpy(&w1r, w1_re + t, sizeof(value_type)); std::memcpy(&w1i, w1_im + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&w2r, w2_re + t, sizeof(value_type)); std::memcpy(&w2i, w2_im + t, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const value_type w3r = (w1r * w2r) - (w1i * w2i);
+      const value_type w3i = (w1r * w2i) + (w1i * w2r);
+
+      // p1 = x[t + q] * conj(w^2t), p2 = x[t + 2q] * conj(w^t), p3 = x[t + 3q] * conj(w^3t)
+      const value_type p1r = (x1r * w2r) + (x1i * w2i);
+      const value_type p1i = (x1i * w2r) - (x1r * w2i);
+      const value_type p2r = (x2r * w1r) + (x2i * w1i);
+      const value_type p2i = (x2i * w1r) - (x2r * w1i);
+      const value_type p3r = (x3r * w3r) + (x3i * w3i);
+      const value_type p3i = (x3i * w3r) - (x3r * w3i);
+
+      const value_type a0r = x0r + p1r; const value_type a0i = x0i + p1i;
+      const value_type a1r = x0r - p1r; const value_type a1i = x0i - p1i;
+      const value_type b0r = p2r + p3r; const value_type b0i = p2i + p3i;
+      const value_type b1r = p2r - p3r; const value_type b1i = p2i - p3i;
+
+      const value_type y0r = a0r + b0r; const value_type y0i = a0i + b0i;
+      const value_type y2r = a0r - b0r; const value_type y2i = a0i - b0i;
+      const value_type y1r = a1r - b1i; const value_type y1i = a1i + b1r;
+      const value_type y3r = a1r + b1i; const value_type y3i = a1i - b1r;
+
+      std::memcpy(re  + t, &y0r, sizeof(value_type)); std::memcpy(im  + t, &y0i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re1 + t, &y1r, sizeof(value_type)); std::memcpy(im1 + t, &y1i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re2 + t, &y2r, sizeof(value_type)); std::memcpy(im2 + t, &y2i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(re3 + t, &y3r, sizeof(value_type)); std::memcpy(im3 + t, &y3i, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_imag(std::uint32_t num_points) -> typename std::enable_if<(!IsForwardFft), float_type>::type
+  template<typename float_type>
+  auto fft_dif_radix4_stripe(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
   {
-    return static_cast<float_type>(-template_sin_order_2<float_type>(num_points));
+    fft_dif_radix4_lanes<float_type>(q, t_first, t_last, re, im, tw);
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  constexpr auto const_unique_wp_real(std::uint32_t num_points) -> float_type
+  template<typename float_type>
+  auto fft_dit_radix4_stripe(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
   {
-    return
-      static_cast<float_type>
-      (
-        -2 * (  const_unique_wp_real_init<float_type, IsForwardFft>(num_points)
-              * const_unique_wp_real_init<float_type, IsForwardFft>(num_points))
-      );
+    fft_dit_radix4_lanes<float_type>(q, t_first, t_last, re, im, tw);
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto danielson_lanczos_apply_4_basecase(float_type* data) -> void;
+  #if defined(WIDE_DECIMAL_FFT_HAS_VECTOR_LANES)
+
+  // The butterflies of double-precision transforms run on vectors
+  // of doubles with the GNU vector extensions. Two lanes map to SSE2
+  // on x86-64 and to NEON on AArch64. On x86-64, four lanes use AVX2
+  // when the CPU supports it, which is checked at run time. Short
+  // spans at the innermost levels use the scalar butterflies.
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto danielson_lanczos_apply(std::uint32_t num_points, float_type* data) -> void // NOLINT(misc-no-recursion)
+  typedef double fft_vector2_type __attribute__((vector_size(16))); // NOLINT(modernize-use-using)
+
+  #if defined(WIDE_DECIMAL_FFT_HAS_AVX2_LANES)
+
+  typedef double fft_vector4_type __attribute__((vector_size(32))); // NOLINT(modernize-use-using)
+
+  // These may only be called on a CPU that supports AVX2, see uses_avx2().
+  struct fft_lanes_avx2
   {
-    if(num_points == static_cast<std::uint32_t>(UINT8_C(8)))
+    __attribute__((target("avx2")))
+    static auto dif_pass(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, double* re, double* im, const fft_twiddles<double>& tw) -> void
     {
-      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data);
-      danielson_lanczos_apply_4_basecase<float_type, IsForwardFft>(data + num_points); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      fft_dif_radix4_lanes<fft_vector4_type>(q, t_first, t_last, re, im, tw);
     }
-    else
+
+    __attribute__((target("avx2")))
+    static auto dit_pass(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, double* re, double* im, const fft_twiddles<double>& tw) -> void
     {
-      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data);
-      danielson_lanczos_apply<float_type, IsForwardFft>(num_points / 2U, data + num_points); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      fft_dit_radix4_lanes<fft_vector4_type>(q, t_first, t_last, re, im, tw);
     }
 
-    auto real_part = static_cast<float_type>(1);
-    auto imag_part = static_cast<float_type>(0);
-
-    for(auto i  = static_cast<std::uint32_t>(UINT8_C(0));
-             i  < num_points;
-             i += static_cast<std::uint32_t>(UINT8_C(2)))
+    static auto uses_avx2() -> bool
     {
-            auto tmp_real = static_cast<float_type>((real_part * data[i + (num_points + 0U)]) - (imag_part * data[i + (num_points + 1U)])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      const auto tmp_imag = static_cast<float_type>((real_part * data[i + (num_points + 1U)]) + (imag_part * data[i + (num_points + 0U)])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      static const bool is_supported = check_is_supported();
 
-      data[i + (num_points + 0U)] = data[i + 0U] - tmp_real; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      data[i + (num_points + 1U)] = data[i + 1U] - tmp_imag; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return is_supported;
+    }
 
-      data[i + 0U] += tmp_real; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      data[i + 1U] += tmp_imag; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  private:
+    static auto check_is_supported() -> bool
+    {
+      __builtin_cpu_init();
+
+      return __builtin_cpu_supports("avx2");
+    }
+  };
 
-      tmp_real = real_part;
+  #endif // WIDE_DECIMAL_FFT_HAS_AVX2_LANES
 
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, IsForwardFft>(num_points)) - (imag_part * const_unique_wp_imag<float_type, IsForwardFft>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, IsForwardFft>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, IsForwardFft>(num_points)));
+  inline auto fft_dif_radix4_stripe(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, double* re, double* im, const fft_twiddles<double>& tw) -> void
+  {
+    #if defined(WIDE_DECIMAL_FFT_HAS_AVX2_LANES)
+    if((q >= static_cast<std::uint32_t>(UINT8_C(4))) && fft_lanes_avx2::uses_avx2())
+    {
+      fft_lanes_avx2::dif_pass(q, t_first, t_last, re, im, tw);
+    }
+    else
+    #endif
+    if(q >= static_cast<std::uint32_t>(UINT8_C(2)))
+    {
+      fft_dif_radix4_lanes<fft_vector2_type>(q, t_first, t_last, re, im, tw);
+    }
+    else
+    {
+      fft_dif_radix4_lanes<double>(q, t_first, t_last, re, im, tw);
     }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto danielson_lanczos_apply_4_basecase(float_type* data) -> void
+  inline auto fft_dit_radix4_stripe(std::uint32_t q, std::uint32_t t_first, std::uint32_t t_last, double* re, double* im, const fft_twiddles<double>& tw) -> void
   {
-    const auto tmp_real_2_0 = data[2U];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    const auto tmp_imag_2_0 = data[3U];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    #if defined(WIDE_DECIMAL_FFT_HAS_AVX2_LANES)
+    if((q >= static_cast<std::uint32_t>(UINT8_C(4))) && fft_lanes_avx2::uses_avx2())
+    {
+      fft_lanes_avx2::dit_pass(q, t_first, t_last, re, im, tw);
+    }
+    else
+    #endif
+    if(q >= static_cast<std::uint32_t>(UINT8_C(2)))
+    {
+      fft_dit_radix4_lanes<fft_vector2_type>(q, t_first, t_last, re, im, tw);
+    }
+    else
+    {
+      fft_dit_radix4_lanes<double>(q, t_first, t_last, re, im, tw);
+    }
+  }
 
-    data[2U]  = data[0U] - tmp_real_2_0;           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[3U]  = data[1U] - tmp_imag_2_0;           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[0U] += tmp_real_2_0;                      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U] += tmp_imag_2_0;                      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  #endif // WIDE_DECIMAL_FFT_HAS_VECTOR_LANES
 
-    const auto tmp_real_2_4 = data[2U + 4U];       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    const auto tmp_imag_2_4 = data[3U + 4U];       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  template<typename float_type>
+  auto fft_dif_radix4_pass(std::uint32_t q, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
+  {
+    fft_dif_radix4_stripe(q, static_cast<std::uint32_t>(UINT8_C(0)), q, re, im, tw);
+  }
 
-    data[2U + 4U]  = data[0U + 4U] - tmp_real_2_4; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[3U + 4U]  = data[1U + 4U] - tmp_imag_2_4; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[0U + 4U] += tmp_real_2_4;                 // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U + 4U] += tmp_imag_2_4;                 // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  template<typename float_type>
+  auto fft_dit_radix4_pass(std::uint32_t q, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void
+  {
+    fft_dit_radix4_stripe(q, static_cast<std::uint32_t>(UINT8_C(0)), q, re, im, tw);
+  }
 
-    auto tmp_real = data[4U];                      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    auto tmp_imag = data[5U];                      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<typename float_type>
+  auto fft_radix2_pairs(std::uint32_t num_complex, float_type* re, float_type* im) -> void
+  {
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += 2U)
+    {
+      const float_type tr = re[j + 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const float_type ti = im[j + 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    data[4U] = data[0U] - tmp_real;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[5U] = data[1U] - tmp_imag;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      re[j + 1U] = re[j] - tr; im[j + 1U] = im[j] - ti; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      re[j]     += tr;         im[j]     += ti; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
 
-    data[0U] += tmp_real;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U] += tmp_imag;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // Forward complex FFT of num_complex points (a power of 2) with the
+  // output in bit-reversed order. No bit-reversal permutation is needed,
+  // since the spectra are only multiplied point-by-point and transformed
+  // back by fft_dit_inverse, which takes bit-reversed input.
+  template<typename float_type>
+  auto fft_dif_forward(std::uint32_t num_complex, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void // NOLINT(misc-no-recursion)
+  {
+    if(num_complex > fft_block_points())
+    {
+      const auto q = static_cast<std::uint32_t>(num_complex / 4U);
 
-    const auto real_part = static_cast<float_type>(const_unique_wp_real<float_type, IsForwardFft>(4U) + template_one<float_type>());
-    const auto imag_part = static_cast<float_type>(const_unique_wp_imag<float_type, IsForwardFft>(4U));
+      fft_dif_radix4_pass(q, re, im, tw);
 
-    tmp_real = (real_part * data[6U]) - (imag_part * data[7U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    tmp_imag = (real_part * data[7U]) + (imag_part * data[6U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += q)
+      {
+        fft_dif_forward(q, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+    else
+    {
+      auto span = num_complex;
 
-    data[6U] = data[2U] - tmp_real;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    data[7U] = data[3U] - tmp_imag;                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      for( ; span >= static_cast<std::uint32_t>(UINT8_C(4)); span /= 4U)
+      {
+        for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += span)
+        {
+          fft_dif_radix4_pass(static_cast<std::uint32_t>(span / 4U), re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
 
-    data[2U] += tmp_real;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[3U] += tmp_imag;                          // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if(span == static_cast<std::uint32_t>(UINT8_C(2)))
+      {
+        fft_radix2_pairs(num_complex, re, im);
+      }
+    }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto fft_lanczos_fft(std::uint32_t num_points, float_type* data) -> void
+  // Inverse (unscaled) complex FFT of num_complex points
+  // with the input in bit-reversed order.
+  template<typename float_type>
+  auto fft_dit_inverse(std::uint32_t num_complex, float_type* re, float_type* im, const fft_twiddles<float_type>& tw) -> void // NOLINT(misc-no-recursion)
   {
-    auto j = static_cast<std::uint32_t>(UINT8_C(1));
-
-    for(auto i  = static_cast<std::uint32_t>(UINT8_C(1));
-             i  < static_cast<std::uint32_t>(num_points << 1U);
-             i += static_cast<std::uint32_t>(UINT8_C(2)))
+    if(num_complex > fft_block_points())
     {
-      if(j > i)
+      const auto q = static_cast<std::uint32_t>(num_complex / 4U);
+
+      for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += q)
       {
-        std::swap(data[j - 1U], data[i - 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        std::swap(data[j],      data[i]);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        fft_dit_inverse(q, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
 
-      auto m = num_points;
+      fft_dit_radix4_pass(q, re, im, tw);
+    }
+    else
+    {
+      auto span = static_cast<std::uint32_t>(UINT8_C(1));
+
+      // An odd number of levels begins with a radix-2 level.
+      while((span * 4U) <= num_complex) { span *= 4U; } // NOLINT(altera-id-dependent-backward-branch)
 
-      while((m > static_cast<std::uint32_t>(UINT8_C(1))) && (j > m)) // NOLINT(altera-id-dependent-backward-branch)
+      if(span != num_complex)
       {
-        j  -= m;
-        m >>= 1U;
+        fft_radix2_pairs(num_complex, re, im);
+
+        span = static_cast<std::uint32_t>(UINT8_C(8));
+      }
+      else
+      {
+        span = static_cast<std::uint32_t>(UINT8_C(4));
       }
 
-      j += m;
+      for( ; span <= num_complex; span *= 4U)
+      {
+        for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += span)
+        {
+          fft_dit_radix4_pass(static_cast<std::uint32_t>(span / 4U), re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
     }
-
-    danielson_lanczos_apply<float_type, IsForwardFft>(num_points, data);
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data) -> typename std::enable_if<IsForwardFft, void>::type
+  // Multiply the real-valued spectra of a and b in place into a.
+  // Both are given as the bit-reversed complex spectra of their
+  // even/odd-packed points. The spectral points k and num_complex - k,
+  // which are needed together in order to unpack the real-valued
+  // spectra, lie in the same octave [2^j, 2^(j + 1)) of the bit-reversed
+  // order, mirrored. So a and b are unpacked, multiplied and re-packed
+  // for the inverse transform in a single pass. The result is scaled
+  // by 8 and b may be identical to a (for squaring).
+
+  // Convolve the points p, p + 1, ... with their partners q + lanes - 1,
+  // q + lanes - 2, ..., which are loaded and stored in reverse order.
+  template<typename value_type,
+           typename float_type>
+  inline WIDE_DECIMAL_FFT_ALWAYS_INLINE auto fft_convolve_lanes(std::uint32_t p,
+                                                                std::uint32_t q,
+                                                                      float_type* a_re,       float_type* a_im,
+                                                                const float_type* b_re, const float_type* b_im,
+                                                                const fft_twiddles<float_type>& tw) -> void
   {
-    fft_lanczos_fft<float_type, true>(num_points / 2U, data);
+    constexpr auto lanes = static_cast<std::uint32_t>(sizeof(value_type) / sizeof(float_type));
 
-    auto real_part = static_cast<float_type>(static_cast<float_type>(1) + const_unique_wp_real<float_type, true>(num_points));
-    auto imag_part = static_cast<float_type>(                             const_unique_wp_imag<float_type, true>(num_points));
+    const auto load_reversed =
+      [](value_type& value, const float_type* source)
+      {
+        std::array<float_type, static_cast<std::size_t>(lanes)> tmp { };
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(1));
-               i < static_cast<std::uint32_t>(num_points >> 2U);
-             ++i)
-    {
-      const auto i1 = static_cast<std::uint32_t>(i          + i);
-      const auto i3 = static_cast<std::uint32_t>(num_points - i1);
+        for(auto lane = static_cast<std::uint32_t>(UINT8_C(0)); lane < lanes; ++lane) { tmp[lane] = source[(lanes - 1U) - lane]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      const auto i2 = static_cast<std::uint32_t>(1U + i1);
-      const auto i4 = static_cast<std::uint32_t>(1U + i3);
+        std::memcpy(&value, tmp.data(), sizeof(value_type));
+      };
 
+    const auto store_reversed =
+      [](float_type* destination, const value_type& value)
       {
-        const auto h1r = template_fast_div_by_two(data[i1] + data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        const auto h1i = template_fast_div_by_two(data[i2] - data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::array<float_type, static_cast<std::size_t>(lanes)> tmp { };
 
-        const auto h2r = template_fast_div_by_two(data[i2] + data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        const auto h2i = template_fast_div_by_two(data[i1] - data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(tmp.data(), &value, sizeof(value_type));
 
-        data[i1] = (+h1r + (real_part * h2r)) + (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i2] = (+h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i3] = (+h1r - (real_part * h2r)) - (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        data[i4] = (-h1i - (real_part * h2i)) + (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      }
+        for(auto lane = static_cast<std::uint32_t>(UINT8_C(0)); lane < lanes; ++lane) { destination[(lanes - 1U) - lane] = tmp[lane]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      };
+
+    value_type apr; value_type api; value_type aqr; value_type aqi;
+    value_type bpr; value_type bpi; value_type bqr; value_type bqi;
+    value_type wr;  value_type wi;
+
+    std::memcpy(&apr, a_re + p, sizeof(value_type)); std::memcpy(&api, a_im + p, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&bpr, b_re + p, sizeof(value_type)); std::memcpy(&bpi, b_im + p, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&wr, tw.post_re + p, sizeof(value_type)); std::memcpy(&wi, tw.post_im + p, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    load_reversed(aqr, a_re + q); load_reversed(aqi, a_im + q); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    load_reversed(bqr, b_re + q); load_reversed(bqi, b_im + q); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Unpack the even part E and the odd part O (both times 2)
+    // and form X[k] = E + w^k O and X[k + n] = E - w^k O.
+    const value_type ear = apr + aqr; const value_type eai = api - aqi;
+    const value_type oar = api + aqi; const value_type oai = aqr - apr;
+    const value_type ebr = bpr + bqr; const value_type ebi = bpi - bqi;
+    const value_type obr = bpi + bqi; const value_type obi = bqr - bpr;
+
+    const value_type tar = (wr * oar) - (wi * oai); const value_type tai = (wr * oai) + (wi * oar);
+    const value_type tbr = (wr * obr) - (wi * obi); const value_type tbi = (wr * obi) + (wi * obr);
+
+    const value_type a0r = ear + tar; const value_type a0i = eai + tai;
+    const value_type a1r = ear - tar; const value_type a1i = eai - tai;
+    const value_type b0r = ebr + tbr; const value_type b0i = ebi + tbi;
+    const value_type b1r = ebr - tbr; const value_type b1i = ebi - tbi;
+
+    const value_type c0r = (a0r * b0r) - (a0i * b0i); const value_type c0i = (a0r * b0i) + (a0i * b0r);
+    const value_type c1r = (a1r * b1r) - (a1i * b1i); const value_type c1i = (a1r * b1i) + (a1i * b1r);
+
+    // Re-pack Z = E + i O with E = C0 + C1 and O = (C0 - C1) conj(w^k).
+    const value_type ecr = c0r + c1r; const value_type eci = c0i + c1i;
+    const value_type dr  = c0r - c1r; const value_type di  = c0i - c1i;
+    const value_type ocr = (dr * wr) + (di * wi); const value_type oci = (di * wr) - (dr * wi);
+
+    const value_type zqr = ecr + oci; const value_type zqi = ocr - eci;
+    const value_type zpr = ecr - oci; const value_type zpi = eci + ocr;
+
+    store_reversed(a_re + q, zqr); store_reversed(a_im + q, zqi); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    std::memcpy(a_re + p, &zpr, sizeof(value_type)); std::memcpy(a_im + p, &zpi, sizeof(value_type)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
 
-      const auto tmp_real = real_part;
+  // Convolve the pairs t_first <= t < t_last of one octave [octave, 2 * octave),
+  // where t runs up to octave / 2, and t_first and t_last must be multiples
+  // of the number of lanes in value_type.
+  template<typename value_type,
+           typename float_type>
+  inline WIDE_DECIMAL_FFT_ALWAYS_INLINE auto fft_convolve_octave_lanes(std::uint32_t octave,
+                                                                       std::uint32_t t_first,
+                                                                       std::uint32_t t_last,
+                                                                             float_type* a_re,       float_type* a_im,
+                                                                       const float_type* b_re, const float_type* b_im,
+                                                                       const fft_twiddles<float_type>& tw) -> void
+  {
+    constexpr auto lanes = static_cast<std::uint32_t>(sizeof(value_type) / sizeof(float_type));
 
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, true>(num_points)) - (imag_part * const_unique_wp_imag<float_type, true>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, true>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, true>(num_points)));
+    for(auto t = t_first; t < t_last; t += lanes)
+    {
+      fft_convolve_lanes<value_type>(static_cast<std::uint32_t>(octave + t),
+                                     static_cast<std::uint32_t>(((octave * 2U) - t) - lanes),
+                                     a_re, a_im, b_re, b_im, tw);
     }
+  }
 
-    const auto f0_tmp = data[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  template<typename float_type>
+  auto fft_convolve_octave(std::uint32_t octave,
+                           std::uint32_t t_first,
+                           std::uint32_t t_last,
+                                 float_type* a_re,       float_type* a_im,
+                           const float_type* b_re, const float_type* b_im,
+                           const fft_twiddles<float_type>& tw) -> void
+  {
+    fft_convolve_octave_lanes<float_type>(octave, t_first, t_last, a_re, a_im, b_re, b_im, tw);
+  }
 
-    data[0U] = f0_tmp + data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U] = f0_tmp - data[1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  #if defined(WIDE_DECIMAL_FFT_HAS_VECTOR_LANES)
+
+  #if defined(WIDE_DECIMAL_FFT_HAS_AVX2_LANES)
+  __attribute__((target("avx2")))
+  inline auto fft_convolve_octave_avx2(std::uint32_t octave,
+                                       std::uint32_t t_first,
+                                       std::uint32_t t_last,
+                                             double* a_re,       double* a_im,
+                                       const double* b_re, const double* b_im,
+                                       const fft_twiddles<double>& tw) -> void
+  {
+    fft_convolve_octave_lanes<fft_vector4_type>(octave, t_first, t_last, a_re, a_im, b_re, b_im, tw);
+  }
+  #endif
+
+  inline auto fft_convolve_octave(std::uint32_t octave,
+                                  std::uint32_t t_first,
+                                  std::uint32_t t_last,
+                                        double* a_re,       double* a_im,
+                                  const double* b_re, const double* b_im,
+                                  const fft_twiddles<double>& tw) -> void
+  {
+    #if defined(WIDE_DECIMAL_FFT_HAS_AVX2_LANES)
+    if((octave >= static_cast<std::uint32_t>(UINT8_C(8))) && fft_lanes_avx2::uses_avx2())
+    {
+      fft_convolve_octave_avx2(octave, t_first, t_last, a_re, a_im, b_re, b_im, tw);
+    }
+    else
+    #endif
+    if(octave >= static_cast<std::uint32_t>(UINT8_C(4)))
+    {
+      fft_convolve_octave_lanes<fft_vector2_type>(octave, t_first, t_last, a_re, a_im, b_re, b_im, tw);
+    }
+    else
+    {
+      fft_convolve_octave_lanes<double>(octave, t_first, t_last, a_re, a_im, b_re, b_im, tw);
+    }
   }
 
-  template<typename float_type,
-           const bool IsForwardFft>
-  auto rfft_lanczos_rfft(std::uint32_t num_points, float_type* data) -> typename std::enable_if<(!IsForwardFft), void>::type
+  #endif // WIDE_DECIMAL_FFT_HAS_VECTOR_LANES
+
+  template<typename float_type>
+  auto fft_convolve_bitrev(std::uint32_t num_complex,
+                                 float_type* a_re,       float_type* a_im,
+                           const float_type* b_re, const float_type* b_im,
+                           const fft_twiddles<float_type>& tw) -> void
   {
-    auto real_part = static_cast<float_type>(static_cast<float_type>(1) + const_unique_wp_real<float_type, false>(num_points));
-    auto imag_part = static_cast<float_type>(                             const_unique_wp_imag<float_type, false>(num_points));
+    // The points 0 and 1 (the spectral points 0 and num_complex / 2)
+    // are their own partners.
+    fft_convolve_lanes<float_type>(static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(UINT8_C(0)), a_re, a_im, b_re, b_im, tw);
+
+    if(num_complex > static_cast<std::uint32_t>(UINT8_C(1)))
+    {
+      fft_convolve_lanes<float_type>(static_cast<std::uint32_t>(UINT8_C(1)), static_cast<std::uint32_t>(UINT8_C(1)), a_re, a_im, b_re, b_im, tw);
+    }
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(1));
-               i < static_cast<std::uint32_t>(num_points >> 2U);
-             ++i)
+    for(auto octave = static_cast<std::uint32_t>(UINT8_C(2)); octave < num_complex; octave <<= 1U)
     {
-      const auto i1 = static_cast<std::uint32_t>(i          + i);
-      const auto i3 = static_cast<std::uint32_t>(num_points - i1);
+      fft_convolve_octave(octave, static_cast<std::uint32_t>(UINT8_C(0)), static_cast<std::uint32_t>(octave / 2U), a_re, a_im, b_re, b_im, tw);
+    }
+  }
 
-      const auto i2 = static_cast<std::uint32_t>(1U + i1);
-      const auto i4 = static_cast<std::uint32_t>(1U + i3);
+  // The parallel transforms and the parallel convolution below split
+  // their work into partition_count partitions, which run with the
+  // executor of the calling thread (see decwide_t_detail_executor.h).
+  // The passes above the cache blocks are split into stripes of
+  // butterflies until there are enough blocks for all partitions,
+  // and then the blocks are distributed among the partitions.
 
-      const auto h1r = template_fast_div_by_two(data[i1] + data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      const auto h1i = template_fast_div_by_two(data[i2] - data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // The bound of the stripe of a partition within count butterflies,
+  // which is aligned to the vector lanes.
+  inline auto fft_stripe_bound(std::uint32_t count, std::size_t partition, std::size_t partition_count) -> std::uint32_t
+  {
+    return
+      static_cast<std::uint32_t>
+      (
+        (partition >= partition_count)
+          ? count
+          : static_cast<std::uint32_t>(static_cast<std::uint32_t>((static_cast<std::size_t>(count / 8U) * partition) / partition_count) * 8U)
+      );
+  }
+
+  template<typename float_type>
+  auto fft_parallel_span(std::uint32_t num_complex, std::size_t partition_count) -> std::uint32_t
+  {
+    auto span = num_complex;
+
+    while((span > fft_block_points()) && (static_cast<std::size_t>(num_complex / span) < partition_count)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      span /= 4U;
+    }
 
-      const auto h2r = template_fast_div_by_two(data[i2] + data[i4]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      const auto h2i = template_fast_div_by_two(data[i1] - data[i3]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return span;
+  }
 
-      data[i1] = (+h1r - (real_part * h2r)) - (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      data[i2] = (+h1i + (real_part * h2i)) - (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      data[i3] = (+h1r + (real_part * h2r)) + (imag_part * h2i);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      data[i4] = (-h1i + (real_part * h2i)) - (imag_part * h2r);      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  template<typename float_type>
+  auto fft_dif_forward_parallel(std::uint32_t num_complex, float_type* re, float_type* im, const fft_twiddles<float_type>& tw, std::size_t partition_count) -> void
+  {
+    const auto span_blocks = fft_parallel_span<float_type>(num_complex, partition_count);
 
-      const auto tmp_real = real_part;
+    for(auto span = num_complex; span > span_blocks; span /= 4U)
+    {
+      const auto q = static_cast<std::uint32_t>(span / 4U);
 
-      real_part += ((tmp_real  * const_unique_wp_real<float_type, false>(num_points)) - (imag_part * const_unique_wp_imag<float_type, false>(num_points)));
-      imag_part += ((imag_part * const_unique_wp_real<float_type, false>(num_points)) + (tmp_real  * const_unique_wp_imag<float_type, false>(num_points)));
+      executor_run
+      (
+        partition_count,
+        [num_complex, span, q, re, im, &tw, partition_count](const std::size_t partition)
+        {
+          const auto t_first = fft_stripe_bound(q, partition,      partition_count);
+          const auto t_last  = fft_stripe_bound(q, partition + 1U, partition_count);
+
+          for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += span)
+          {
+            fft_dif_radix4_stripe(q, t_first, t_last, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+        }
+      );
     }
 
-    const auto f0_tmp = data[0U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    executor_run
+    (
+      partition_count,
+      [num_complex, span_blocks, re, im, &tw, partition_count](const std::size_t partition)
+      {
+        for(auto j = static_cast<std::size_t>(span_blocks * partition); j < num_complex; j += static_cast<std::size_t>(span_blocks * partition_count))
+        {
+          fft_dif_forward(span_blocks, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    );
+  }
+
+  template<typename float_type>
+  auto fft_dit_inverse_parallel(std::uint32_t num_complex, float_type* re, float_type* im, const fft_twiddles<float_type>& tw, std::size_t partition_count) -> void
+  {
+    const auto span_blocks = fft_parallel_span<float_type>(num_complex, partition_count);
+
+    executor_run
+    (
+      partition_count,
+      [num_complex, span_blocks, re, im, &tw, partition_count](const std::size_t partition)
+      {
+        for(auto j = static_cast<std::size_t>(span_blocks * partition); j < num_complex; j += static_cast<std::size_t>(span_blocks * partition_count))
+        {
+          fft_dit_inverse(span_blocks, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    );
 
-    data[0U] = template_fast_div_by_two(f0_tmp + data[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    data[1U] = template_fast_div_by_two(f0_tmp - data[1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for(auto span = static_cast<std::uint32_t>(span_blocks * 4U); span <= num_complex; span *= 4U)
+    {
+      const auto q = static_cast<std::uint32_t>(span / 4U);
 
-    fft_lanczos_fft<float_type, false>(num_points / 2U, data);
+      executor_run
+      (
+        partition_count,
+        [num_complex, span, q, re, im, &tw, partition_count](const std::size_t partition)
+        {
+          const auto t_first = fft_stripe_bound(q, partition,      partition_count);
+          const auto t_last  = fft_stripe_bound(q, partition + 1U, partition_count);
+
+          for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < num_complex; j += span)
+          {
+            fft_dit_radix4_stripe(q, t_first, t_last, re + j, im + j, tw); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+        }
+      );
+    }
+  }
+
+  // The octaves below the block size are convolved by the first
+  // partition, and the larger octaves are split into stripes.
+  template<typename float_type>
+  auto fft_convolve_bitrev_parallel(std::uint32_t num_complex,
+                                          float_type* a_re,       float_type* a_im,
+                                    const float_type* b_re, const float_type* b_im,
+                                    const fft_twiddles<float_type>& tw,
+                                    std::size_t partition_count) -> void
+  {
+    const auto octave_blocks = (std::min)(num_complex, (std::max)(fft_block_points(), static_cast<std::uint32_t>(UINT8_C(2))));
+
+    executor_run
+    (
+      partition_count,
+      [num_complex, octave_blocks, a_re, a_im, b_re, b_im, &tw, partition_count](const std::size_t partition)
+      {
+        if(partition == static_cast<std::size_t>(UINT8_C(0)))
+        {
+          fft_convolve_bitrev(octave_blocks, a_re, a_im, b_re, b_im, tw);
+        }
+
+        for(auto octave = octave_blocks; octave < num_complex; octave <<= 1U)
+        {
+          const auto count = static_cast<std::uint32_t>(octave / 2U);
+
+          fft_convolve_octave(octave,
+                              fft_stripe_bound(count, partition,      partition_count),
+                              fft_stripe_bound(count, partition + 1U, partition_count),
+                              a_re, a_im, b_re, b_im, tw);
+        }
+      }
+    );
   }
 
   #if(__cplusplus >= 201703L)
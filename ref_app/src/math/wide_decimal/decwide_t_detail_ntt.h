@@ -0,0 +1,603 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements the number-theoretic transform (NTT) used
+// for exact large-digit multiplication in decwide_t. Three NTTs
+// modulo 64-bit primes with Montgomery butterflies are combined
+// with the Chinese remainder theorem (CRT).
+
+#ifndef DECWIDE_T_DETAIL_NTT_2026_10_17_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_NTT_2026_10_17_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+
+  #if (defined(__GNUC__) && defined(__SIZEOF_INT128__))
+  #define WIDE_DECIMAL_NTT_HAS_UINT128
+  #endif
+
+  #if defined(__GNUC__)
+  #define WIDE_DECIMAL_NTT_ALWAYS_INLINE __attribute__((always_inline)) // NOLINT(cppcoreguidelines-macro-usage)
+  #else
+  #define WIDE_DECIMAL_NTT_ALWAYS_INLINE
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail::ntt {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { namespace ntt { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  #if defined(WIDE_DECIMAL_NTT_HAS_UINT128)
+  #if (defined(__GNUC__) && !defined(__clang__))
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wpedantic"
+  #endif
+  using ntt_uint128_type = unsigned __int128;
+  #if (defined(__GNUC__) && !defined(__clang__))
+  #pragma GCC diagnostic pop
+  #endif
+  #endif
+
+  // The transforms run breadth-first, two levels per pass, on blocks
+  // of up to this many points (64 kB). Larger transforms are split
+  // depth-first into quarters until each quarter fits into one block.
+  constexpr auto ntt_block_points() -> std::uint32_t { return static_cast<std::uint32_t>(UINT16_C(8192)); }
+
+  // Multiply 64 * 64 -> 128 bits, return the low half
+  // and store the high half of the product.
+  constexpr auto ntt_mul_wide(const std::uint64_t a, const std::uint64_t b, std::uint64_t& hi) -> std::uint64_t
+  {
+    #if defined(WIDE_DECIMAL_NTT_HAS_UINT128)
+    const auto product = static_cast<ntt_uint128_type>(static_cast<ntt_uint128_type>(a) * b);
+
+    hi = static_cast<std::uint64_t>(product >> static_cast<unsigned>(UINT8_C(64)));
+
+    return static_cast<std::uint64_t>(product);
+    #else
+    const auto a_lo = static_cast<std::uint64_t>(static_cast<std::uint32_t>(a));
+    const auto a_hi = static_cast<std::uint64_t>(a >> static_cast<unsigned>(UINT8_C(32)));
+    const auto b_lo = static_cast<std::uint64_t>(static_cast<std::uint32_t>(b));
+    const auto b_hi = static_cast<std::uint64_t>(b >> static_cast<unsigned>(UINT8_C(32)));
+
+    const auto p00 = static_cast<std::uint64_t>(a_lo * b_lo);
+    const auto p01 = static_cast<std::uint64_t>(a_lo * b_hi);
+    const auto p10 = static_cast<std::uint64_t>(a_hi * b_lo);
+    const auto p11 = static_cast<std::uint64_t>(a_hi * b_hi);
+
+    const auto mid =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(p00 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(static_cast<std::uint32_t>(p01))
+        + static_cast<std::uint64_t>(static_cast<std::uint32_t>(p10))
+      );
+
+    hi =
+      static_cast<std::uint64_t>
+      (
+          p11
+        + static_cast<std::uint64_t>(p01 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(p10 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(mid >> static_cast<unsigned>(UINT8_C(32)))
+      );
+
+    return
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(mid << static_cast<unsigned>(UINT8_C(32)))
+        | static_cast<std::uint64_t>(static_cast<std::uint32_t>(p00))
+      );
+    #endif
+  }
+
+  // Montgomery arithmetic modulo an odd prime below 2^62 with R = 2^64.
+  // The product of two residues below 4 * Prime is reduced to [0, Prime).
+  template<const std::uint64_t Prime,
+           const std::uint64_t PrimitiveRoot>
+  struct ntt_prime
+  {
+    static_assert((Prime % static_cast<std::uint64_t>(UINT8_C(2))) == static_cast<std::uint64_t>(UINT8_C(1)),
+                  "Error: The NTT prime must be odd");
+
+    static_assert(Prime < static_cast<std::uint64_t>(UINT64_C(0x4000000000000000)),
+                  "Error: The NTT prime must be less than 2^62");
+
+    static constexpr auto prime() -> std::uint64_t { return Prime; }
+
+    // The inverse of the prime modulo 2^64 (Newton iteration,
+    // each step doubles the number of correct bits).
+    static constexpr auto prime_inverse() -> std::uint64_t
+    {
+      auto x = Prime;
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(5)); ++i)
+      {
+        x = static_cast<std::uint64_t>(x * static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(2)) - static_cast<std::uint64_t>(Prime * x)));
+      }
+
+      return x;
+    }
+
+    // R^2 mod Prime, which converts residues into the Montgomery form.
+    static constexpr auto r_squared() -> std::uint64_t
+    {
+      auto r = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(0)) - Prime) % Prime);
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(64)); ++i)
+      {
+        r = ((r >= static_cast<std::uint64_t>(Prime - r)) ? static_cast<std::uint64_t>(r - static_cast<std::uint64_t>(Prime - r))
+                                                          : static_cast<std::uint64_t>(r + r));
+      }
+
+      return r;
+    }
+
+    // Return a * b / R mod Prime, for a * b < Prime * 2^64.
+    static constexpr auto mul(const std::uint64_t a, const std::uint64_t b) -> std::uint64_t
+    {
+      auto hi = static_cast<std::uint64_t>(UINT8_C(0));
+      auto mh = static_cast<std::uint64_t>(UINT8_C(0));
+
+      const auto lo = ntt_mul_wide(a, b, hi);
+
+      static_cast<void>(ntt_mul_wide(static_cast<std::uint64_t>(lo * prime_inverse()), Prime, mh));
+
+      return ((hi < mh) ? static_cast<std::uint64_t>(static_cast<std::uint64_t>(hi - mh) + Prime)
+                        : static_cast<std::uint64_t>(hi - mh));
+    }
+
+    static constexpr auto to_montgomery  (const std::uint64_t a) -> std::uint64_t { return mul(a, r_squared()); }
+    static constexpr auto from_montgomery(const std::uint64_t a) -> std::uint64_t { return mul(a, static_cast<std::uint64_t>(UINT8_C(1))); }
+
+    // Return b^p in the Montgomery form, for b in the Montgomery form.
+    static constexpr auto pow(const std::uint64_t b, std::uint64_t p) -> std::uint64_t
+    {
+      auto result = to_montgomery(static_cast<std::uint64_t>(UINT8_C(1)));
+      auto x      = b;
+
+      while(p != static_cast<std::uint64_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if((p & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0)))
+        {
+          result = mul(result, x);
+        }
+
+        x = mul(x, x);
+
+        p >>= static_cast<unsigned>(UINT8_C(1));
+      }
+
+      return result;
+    }
+
+    // Return the inverse of a mod Prime in the Montgomery form.
+    static constexpr auto inverse(const std::uint64_t a) -> std::uint64_t
+    {
+      return pow(to_montgomery(a % Prime), static_cast<std::uint64_t>(Prime - static_cast<std::uint64_t>(UINT8_C(2))));
+    }
+
+    static constexpr auto primitive_root() -> std::uint64_t { return PrimitiveRoot; }
+  };
+
+  using ntt_prime_0 = ntt_prime<static_cast<std::uint64_t>(UINT64_C(4179340454199820289)), static_cast<std::uint64_t>(UINT8_C(3))>; //  29 * 2^57 + 1
+  using ntt_prime_1 = ntt_prime<static_cast<std::uint64_t>(UINT64_C(2485986994308513793)), static_cast<std::uint64_t>(UINT8_C(5))>; //  69 * 2^55 + 1
+  using ntt_prime_2 = ntt_prime<static_cast<std::uint64_t>(UINT64_C(2936346957045563393)), static_cast<std::uint64_t>(UINT8_C(3))>; // 163 * 2^54 + 1
+
+  // The twiddle factors of one prime. Level h of the transform
+  // (with butterflies of span h) uses the roots of unity w_2h^j
+  // at index h + j of fwd (and w_2h^-j in inv), in the Montgomery
+  // form. The tables for one size are also valid for all smaller
+  // sizes. The pool of the tables of the three primes has the
+  // size 6 * num_points.
+  struct ntt_twiddles
+  {
+    std::array<const std::uint64_t*, static_cast<std::size_t>(UINT8_C(3))> fwd; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<const std::uint64_t*, static_cast<std::size_t>(UINT8_C(3))> inv; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  inline auto ntt_twiddles_view(const std::uint32_t num_points, const std::uint64_t* pool) -> ntt_twiddles
+  {
+    return
+    {
+      {{ pool,
+         pool + static_cast<std::size_t>(static_cast<std::size_t>(num_points) * static_cast<std::size_t>(UINT8_C(2))),   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         pool + static_cast<std::size_t>(static_cast<std::size_t>(num_points) * static_cast<std::size_t>(UINT8_C(4))) }}, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {{ pool + static_cast<std::size_t>(static_cast<std::size_t>(num_points) * static_cast<std::size_t>(UINT8_C(1))),   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         pool + static_cast<std::size_t>(static_cast<std::size_t>(num_points) * static_cast<std::size_t>(UINT8_C(3))),   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         pool + static_cast<std::size_t>(static_cast<std::size_t>(num_points) * static_cast<std::size_t>(UINT8_C(5))) }}  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    };
+  }
+
+  template<typename PrimeType>
+  auto ntt_twiddles_make_one(const std::uint32_t num_points, std::uint64_t* fwd, std::uint64_t* inv) -> void
+  {
+    const auto half = static_cast<std::uint32_t>(num_points / 2U);
+
+    const auto w_fwd = PrimeType::pow(PrimeType::to_montgomery(PrimeType::primitive_root()), static_cast<std::uint64_t>((PrimeType::prime() - 1U) / num_points));
+    const auto w_inv = PrimeType::pow(w_fwd, static_cast<std::uint64_t>(num_points - 1U));
+
+    // The top level holds the powers of the root of order num_points.
+    auto x_fwd = PrimeType::to_montgomery(static_cast<std::uint64_t>(UINT8_C(1)));
+    auto x_inv = x_fwd;
+
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < half; ++j)
+    {
+      fwd[half + j] = x_fwd; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      inv[half + j] = x_inv; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      x_fwd = PrimeType::mul(x_fwd, w_fwd);
+      x_inv = PrimeType::mul(x_inv, w_inv);
+    }
+
+    // Each lower level holds every second root of the level above.
+    for(auto h = static_cast<std::uint32_t>(half / 2U); h >= static_cast<std::uint32_t>(UINT8_C(1)); h /= 2U) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < h; ++j)
+      {
+        fwd[h + j] = fwd[(2U * h) + (2U * j)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        inv[h + j] = inv[(2U * h) + (2U * j)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    fwd[0U] = static_cast<std::uint64_t>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    inv[0U] = static_cast<std::uint64_t>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  inline auto ntt_twiddles_make(const std::uint32_t num_points, std::uint64_t* pool) -> ntt_twiddles
+  {
+    const auto n = static_cast<std::size_t>(num_points);
+
+    ntt_twiddles_make_one<ntt_prime_0>(num_points, pool,                    pool +  n);        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    ntt_twiddles_make_one<ntt_prime_1>(num_points, pool + (2U * n), pool + (3U * n)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    ntt_twiddles_make_one<ntt_prime_2>(num_points, pool + (4U * n), pool + (5U * n)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return ntt_twiddles_view(num_points, pool);
+  }
+
+  // The butterflies keep the residues lazily in [0, 2 * Prime).
+  template<typename PrimeType>
+  WIDE_DECIMAL_NTT_ALWAYS_INLINE inline auto ntt_reduce_2p(const std::uint64_t x) -> std::uint64_t
+  {
+    constexpr auto prime_x2 = static_cast<std::uint64_t>(PrimeType::prime() * 2U);
+
+    return ((x >= prime_x2) ? static_cast<std::uint64_t>(x - prime_x2) : x);
+  }
+
+  template<typename PrimeType>
+  WIDE_DECIMAL_NTT_ALWAYS_INLINE inline auto ntt_dif_butterfly(std::uint64_t& a, std::uint64_t& b, const std::uint64_t w) -> void
+  {
+    constexpr auto prime_x2 = static_cast<std::uint64_t>(PrimeType::prime() * 2U);
+
+    const auto d = static_cast<std::uint64_t>(static_cast<std::uint64_t>(a + prime_x2) - b);
+
+    a = ntt_reduce_2p<PrimeType>(static_cast<std::uint64_t>(a + b));
+    b = PrimeType::mul(d, w);
+  }
+
+  template<typename PrimeType>
+  WIDE_DECIMAL_NTT_ALWAYS_INLINE inline auto ntt_dit_butterfly(std::uint64_t& a, std::uint64_t& b, const std::uint64_t w) -> void
+  {
+    const auto t = PrimeType::mul(b, w);
+
+    b = ntt_reduce_2p<PrimeType>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a + PrimeType::prime()) - t));
+    a = ntt_reduce_2p<PrimeType>(static_cast<std::uint64_t>(a + t));
+  }
+
+  // One decimation-in-frequency level with butterflies of span h.
+  template<typename PrimeType>
+  auto ntt_dif_level(std::uint64_t* x, const std::uint32_t h, const std::uint64_t* w) -> void
+  {
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < h; ++j)
+    {
+      ntt_dif_butterfly<PrimeType>(x[j], x[j + h], w[h + j]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Two decimation-in-frequency levels (with butterflies of spans
+  // 2 * q and q) in one pass over the data.
+  template<typename PrimeType>
+  auto ntt_dif_level_pair(std::uint64_t* x, const std::uint32_t q, const std::uint64_t* w) -> void
+  {
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < q; ++j)
+    {
+      auto x0 = x[j];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x1 = x[j + q];        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x2 = x[j + (2U * q)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x3 = x[j + (3U * q)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      ntt_dif_butterfly<PrimeType>(x0, x2, w[(2U * q) + j]);     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      ntt_dif_butterfly<PrimeType>(x1, x3, w[(3U * q) + j]);     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto w_q = w[q + j]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      ntt_dif_butterfly<PrimeType>(x0, x1, w_q);
+      ntt_dif_butterfly<PrimeType>(x2, x3, w_q);
+
+      x[j]            = x0; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + q]        = x1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + (2U * q)] = x2; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + (3U * q)] = x3; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // One decimation-in-time level with butterflies of span h.
+  template<typename PrimeType>
+  auto ntt_dit_level(std::uint64_t* x, const std::uint32_t h, const std::uint64_t* w) -> void
+  {
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < h; ++j)
+    {
+      ntt_dit_butterfly<PrimeType>(x[j], x[j + h], w[h + j]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Two decimation-in-time levels (with butterflies of spans
+  // q and 2 * q) in one pass over the data.
+  template<typename PrimeType>
+  auto ntt_dit_level_pair(std::uint64_t* x, const std::uint32_t q, const std::uint64_t* w) -> void
+  {
+    for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < q; ++j)
+    {
+      auto x0 = x[j];            // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x1 = x[j + q];        // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x2 = x[j + (2U * q)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      auto x3 = x[j + (3U * q)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto w_q = w[q + j]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      ntt_dit_butterfly<PrimeType>(x0, x1, w_q);
+      ntt_dit_butterfly<PrimeType>(x2, x3, w_q);
+
+      ntt_dit_butterfly<PrimeType>(x0, x2, w[(2U * q) + j]);     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      ntt_dit_butterfly<PrimeType>(x1, x3, w[(3U * q) + j]);     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      x[j]            = x0; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + q]        = x1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + (2U * q)] = x2; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      x[j + (3U * q)] = x3; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Forward transform: natural-order input and bit-reversed output.
+  template<typename PrimeType>
+  auto ntt_dif_forward(const std::uint32_t num_points, std::uint64_t* x, const std::uint64_t* w) -> void // NOLINT(misc-no-recursion)
+  {
+    if(num_points > ntt_block_points())
+    {
+      const auto q = static_cast<std::uint32_t>(num_points / 4U);
+
+      ntt_dif_level_pair<PrimeType>(x, q, w);
+
+      for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += q)
+      {
+        ntt_dif_forward<PrimeType>(q, x + s, w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+    else
+    {
+      auto h = static_cast<std::uint32_t>(num_points / 2U);
+
+      for( ; h >= static_cast<std::uint32_t>(UINT8_C(2)); h /= 4U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += static_cast<std::uint32_t>(2U * h))
+        {
+          ntt_dif_level_pair<PrimeType>(x + s, static_cast<std::uint32_t>(h / 2U), w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+
+      if(h == static_cast<std::uint32_t>(UINT8_C(1)))
+      {
+        for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += static_cast<std::uint32_t>(UINT8_C(2)))
+        {
+          ntt_dif_level<PrimeType>(x + s, h, w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  // Inverse transform (unscaled): bit-reversed input and natural-order output.
+  template<typename PrimeType>
+  auto ntt_dit_inverse(const std::uint32_t num_points, std::uint64_t* x, const std::uint64_t* w) -> void // NOLINT(misc-no-recursion)
+  {
+    if(num_points > ntt_block_points())
+    {
+      const auto q = static_cast<std::uint32_t>(num_points / 4U);
+
+      for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += q)
+      {
+        ntt_dit_inverse<PrimeType>(q, x + s, w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      ntt_dit_level_pair<PrimeType>(x, q, w);
+    }
+    else
+    {
+      // An odd number of levels starts with one single level.
+      auto h = static_cast<std::uint32_t>(UINT8_C(1));
+
+      if((num_points & static_cast<std::uint32_t>(UINT32_C(0xAAAAAAAA))) != static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += static_cast<std::uint32_t>(UINT8_C(2)))
+        {
+          ntt_dit_level<PrimeType>(x + s, h, w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        h = static_cast<std::uint32_t>(UINT8_C(2));
+      }
+
+      for( ; h < num_points; h *= 4U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < num_points; s += static_cast<std::uint32_t>(4U * h))
+        {
+          ntt_dit_level_pair<PrimeType>(x + s, h, w); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+    }
+  }
+
+  // Cyclic convolution of a and b modulo one prime. The result
+  // (in a) is scaled by 1 / num_points and lies in [0, 2 * Prime).
+  // The array b may alias a for squaring.
+  template<typename PrimeType>
+  auto ntt_convolve(const std::uint32_t num_points,
+                          std::uint64_t* a,
+                          std::uint64_t* b,
+                    const std::uint64_t* w_fwd,
+                    const std::uint64_t* w_inv) -> void
+  {
+    ntt_dif_forward<PrimeType>(num_points, a, w_fwd);
+
+    if(b != a)
+    {
+      ntt_dif_forward<PrimeType>(num_points, b, w_fwd);
+    }
+
+    // The pointwise products are in bit-reversed order in both arrays.
+    // The scale of the products by R^-2 and of the inverse transform
+    // by num_points are removed in the second Montgomery product.
+    const auto scale =
+      PrimeType::to_montgomery
+      (
+        PrimeType::to_montgomery
+        (
+          static_cast<std::uint64_t>(PrimeType::prime() - static_cast<std::uint64_t>(static_cast<std::uint64_t>(PrimeType::prime() - 1U) / num_points))
+        )
+      );
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < num_points; ++i)
+    {
+      a[i] = PrimeType::mul(PrimeType::mul(a[i], b[i]), scale); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    ntt_dit_inverse<PrimeType>(num_points, a, w_inv);
+  }
+
+  // The residues of one coefficient of the convolution, combined
+  // with the Chinese remainder theorem (Garner's algorithm) into
+  // the 192-bit value x = r0 + p0 * (t1 + p1 * t2), which is
+  // returned in three 64-bit words, least significant word first.
+  using ntt_crt_value_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(3))>;
+
+  inline auto ntt_crt(std::uint64_t r0, std::uint64_t r1, std::uint64_t r2) -> ntt_crt_value_type
+  {
+    constexpr auto p0 = ntt_prime_0::prime();
+    constexpr auto p1 = ntt_prime_1::prime();
+    constexpr auto p2 = ntt_prime_2::prime();
+
+    // The constants are in the Montgomery form.
+    constexpr auto p0_inv_mod_p1    = ntt_prime_1::inverse(p0);
+    constexpr auto p0_mod_p2        = ntt_prime_2::to_montgomery(p0 % p2);
+    constexpr auto p0_p1_inv_mod_p2 = ntt_prime_2::inverse(ntt_prime_2::mul(p0 % p2, ntt_prime_2::to_montgomery(p1 % p2)));
+
+    r0 = ((r0 >= p0) ? static_cast<std::uint64_t>(r0 - p0) : r0);
+    r1 = ((r1 >= p1) ? static_cast<std::uint64_t>(r1 - p1) : r1);
+    r2 = ((r2 >= p2) ? static_cast<std::uint64_t>(r2 - p2) : r2);
+
+    // t1 = (r1 - r0) / p0 mod p1.
+    const auto r0_mod_p1 = static_cast<std::uint64_t>(r0 % p1);
+
+    const auto t1 = ntt_prime_1::mul((r1 >= r0_mod_p1) ? static_cast<std::uint64_t>(r1 - r0_mod_p1) : static_cast<std::uint64_t>(static_cast<std::uint64_t>(r1 + p1) - r0_mod_p1), p0_inv_mod_p1);
+
+    // t2 = (r2 - r0 - p0 * t1) / (p0 * p1) mod p2.
+    const auto r0_mod_p2 = static_cast<std::uint64_t>(r0 % p2);
+    const auto p0_t1     = ntt_prime_2::mul(t1, p0_mod_p2);
+
+    auto d2 = ((r2 >= r0_mod_p2) ? static_cast<std::uint64_t>(r2 - r0_mod_p2) : static_cast<std::uint64_t>(static_cast<std::uint64_t>(r2 + p2) - r0_mod_p2));
+
+    d2 = ((d2 >= p0_t1) ? static_cast<std::uint64_t>(d2 - p0_t1) : static_cast<std::uint64_t>(static_cast<std::uint64_t>(d2 + p2) - p0_t1));
+
+    const auto t2 = ntt_prime_2::mul(d2, p0_p1_inv_mod_p2);
+
+    // x = r0 + p0 * t1 + (p0 * p1) * t2.
+    auto p0_p1_hi = static_cast<std::uint64_t>(UINT8_C(0));
+    auto p0_p1_lo = ntt_mul_wide(p0, p1, p0_p1_hi);
+
+    auto x1 = static_cast<std::uint64_t>(UINT8_C(0));
+    auto x0 = ntt_mul_wide(p0, t1, x1);
+
+    x0 = static_cast<std::uint64_t>(x0 + r0);
+    x1 = static_cast<std::uint64_t>(x1 + ((x0 < r0) ? 1U : 0U));
+
+    auto y1 = static_cast<std::uint64_t>(UINT8_C(0));
+    auto y2 = static_cast<std::uint64_t>(UINT8_C(0));
+
+    const auto y0     = ntt_mul_wide(t2, p0_p1_lo, y1);
+    const auto y1_add = ntt_mul_wide(t2, p0_p1_hi, y2);
+
+    y1 = static_cast<std::uint64_t>(y1 + y1_add);
+    y2 = static_cast<std::uint64_t>(y2 + ((y1 < y1_add) ? 1U : 0U));
+
+    x0 = static_cast<std::uint64_t>(x0 + y0);
+
+    const auto carry0 = static_cast<std::uint64_t>((x0 < y0) ? 1U : 0U);
+
+    const auto x1_sum = static_cast<std::uint64_t>(x1 + y1);
+    const auto x1_out = static_cast<std::uint64_t>(x1_sum + carry0);
+
+    const auto carry1 = static_cast<std::uint64_t>(((x1_sum < y1) || (x1_out < x1_sum)) ? 1U : 0U);
+
+    return {{ x0, x1_out, static_cast<std::uint64_t>(y2 + carry1) }};
+  }
+
+  // Add b to the 192-bit value a.
+  inline auto ntt_crt_add(ntt_crt_value_type& a, const ntt_crt_value_type& b) -> void
+  {
+    auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < a.size(); ++i)
+    {
+      const auto sum = static_cast<std::uint64_t>(a[i] + b[i]);
+      const auto out = static_cast<std::uint64_t>(sum + carry);
+
+      carry = static_cast<std::uint64_t>(((sum < b[i]) || (out < sum)) ? 1U : 0U);
+
+      a[i] = out;
+    }
+  }
+
+  // Divide the 192-bit value a by a divisor below 2^32 in 32-bit
+  // steps and return the remainder.
+  template<const std::uint32_t Divisor>
+  auto ntt_crt_divmod(ntt_crt_value_type& a) -> std::uint32_t
+  {
+    auto rem = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(a.size()); i-- > static_cast<std::size_t>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto cur_hi = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem << static_cast<unsigned>(UINT8_C(32))) | static_cast<std::uint64_t>(a[i] >> static_cast<unsigned>(UINT8_C(32))));
+      const auto q_hi   = static_cast<std::uint64_t>(cur_hi / Divisor);
+
+      rem = static_cast<std::uint64_t>(cur_hi - static_cast<std::uint64_t>(q_hi * Divisor));
+
+      const auto cur_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(rem << static_cast<unsigned>(UINT8_C(32))) | static_cast<std::uint64_t>(static_cast<std::uint32_t>(a[i])));
+      const auto q_lo   = static_cast<std::uint64_t>(cur_lo / Divisor);
+
+      rem = static_cast<std::uint64_t>(cur_lo - static_cast<std::uint64_t>(q_lo * Divisor));
+
+      a[i] = static_cast<std::uint64_t>(static_cast<std::uint64_t>(q_hi << static_cast<unsigned>(UINT8_C(32))) | q_lo);
+    }
+
+    return static_cast<std::uint32_t>(rem);
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail::ntt
+  #else
+  } // namespace ntt
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_NTT_2026_10_17_H
@@ -11,7 +11,7 @@
 
 // This file implements low-level decwide_t algorithms such as
 // the operations for comparison, addition, subtraction, multiplication
-// (including Karatsuba and FFT loops), and division (but only
+// (including Karatsuba, FFT and NTT loops), and division (but only
 // division by 1 limb).
 
 #ifndef DECWIDE_T_DETAIL_OPS_2021_04_12_H // NOLINT(llvm-header-guard)
@@ -19,7 +19,10 @@
 
   #include <math/wide_decimal/decwide_t_detail.h>
   #include <math/wide_decimal/decwide_t_detail_fft.h>
+  #include <math/wide_decimal/decwide_t_detail_ntt.h>
 
+  #include <array>
+  #include <cstddef>
   #include <cstdint>
   #include <iterator>
   #include <type_traits>
@@ -604,6 +607,112 @@
     }
   }
 
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType,
+           typename TempLimbIteratorType>
+  auto eval_multiply_kara_n_by_n_to_2n_parallel(      OutputLimbIteratorType r,
+                                                      InputLimbIteratorType  a,
+                                                      InputLimbIteratorType  b,
+                                                const std::uint_fast32_t     n,
+                                                      TempLimbIteratorType   t) -> void
+  {
+    // This is the upper level of eval_multiply_kara_n_by_n_to_2n, with
+    // its three half-size products evaluated in parallel partitions
+    // (see executor_run). Each product has its own temporary storage,
+    // so the temporary storage t needs 8n (instead of 4n) limbs.
+
+    using local_limb_type = typename std::iterator_traits<InputLimbIteratorType>::value_type;
+
+    const auto nh = static_cast<std::uint_fast32_t>(n / static_cast<std::uint_fast32_t>(UINT8_C(2)));
+
+    InputLimbIteratorType a0 = a + nh;
+    InputLimbIteratorType a1 = a + 0U;
+
+    InputLimbIteratorType b0 = b + nh;
+    InputLimbIteratorType b1 = b + 0U;
+
+    OutputLimbIteratorType r0 = r + 0U;
+    OutputLimbIteratorType r1 = r + nh;
+    OutputLimbIteratorType r2 = r + n;
+
+    TempLimbIteratorType t0 = t + 0U;
+    TempLimbIteratorType t1 = t + nh;
+    TempLimbIteratorType t2 = t + n;
+    TempLimbIteratorType t4 = t + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2)));
+
+    // Calculate |a1-a0| in t0 and |b0-b1| in t1, and note their signs.
+    const std::int_fast8_t cmp_result_a1a0 = detail::compare_ranges(a1, a0, nh);
+
+    if(cmp_result_a1a0 == static_cast<std::int_fast8_t>(INT8_C(1)))
+    {
+      static_cast<void>(detail::eval_subtract_n(t0, a1, a0, static_cast<std::int32_t>(nh)));
+    }
+    else if(cmp_result_a1a0 == static_cast<std::int_fast8_t>(INT8_C(-1)))
+    {
+      static_cast<void>(detail::eval_subtract_n(t0, a0, a1, static_cast<std::int32_t>(nh)));
+    }
+
+    const std::int_fast8_t cmp_result_b0b1 = detail::compare_ranges(b0, b1, nh);
+
+    if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(1)))
+    {
+      static_cast<void>(detail::eval_subtract_n(t1, b0, b1, static_cast<std::int32_t>(nh)));
+    }
+    else if(cmp_result_b0b1 == static_cast<std::int_fast8_t>(INT8_C(-1)))
+    {
+      static_cast<void>(detail::eval_subtract_n(t1, b1, b0, static_cast<std::int32_t>(nh)));
+    }
+
+    const auto cmp_result_ab = static_cast<std::int_fast8_t>(cmp_result_a1a0 * cmp_result_b0b1);
+
+    // Calculate a1*b1 in the upper-order part of r, a0*b0 in the
+    // lower-order part of r and |a1-a0|*|b0-b1| in t2, in parallel.
+    detail::executor_run
+    (
+      static_cast<std::size_t>(UINT8_C(3)),
+      [&](const std::size_t partition)
+      {
+        const auto offset = static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(partition * 2U));
+
+        if(partition == static_cast<std::size_t>(UINT8_C(0)))
+        {
+          eval_multiply_kara_n_by_n_to_2n(r0, a1, b1, nh, t4 + offset);
+        }
+        else if(partition == static_cast<std::size_t>(UINT8_C(1)))
+        {
+          eval_multiply_kara_n_by_n_to_2n(r2, a0, b0, nh, t4 + offset);
+        }
+        else if(cmp_result_ab != static_cast<std::int_fast8_t>(INT8_C(0)))
+        {
+          eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4 + offset);
+        }
+      }
+    );
+
+    // Add a1*b1 and a0*b0 (copied to t4) to the middle two-quarters of r.
+    std::copy(r0, r0 + static_cast<std::size_t>(static_cast<std::size_t>(n) * static_cast<std::size_t>(UINT8_C(2))), t4);
+
+    local_limb_type carry;
+    carry = detail::eval_add_n(r1, r1, t4, static_cast<std::int32_t>(n));
+    eval_multiply_kara_propagate_carry(r0, nh, carry);
+    carry = detail::eval_add_n(r1, r1, t4 + n, static_cast<std::int32_t>(n));
+    eval_multiply_kara_propagate_carry(r0, nh, carry);
+
+    // Add or subtract |a1-a0|*|b0-b1|, depending on the signs.
+    if(cmp_result_ab == static_cast<std::int_fast8_t>(INT8_C(1)))
+    {
+      carry = detail::eval_add_n(r1, r1, t2, static_cast<std::int32_t>(n));
+
+      eval_multiply_kara_propagate_carry(r0, nh, carry);
+    }
+    else if(cmp_result_ab == static_cast<std::int_fast8_t>(static_cast<std::int_fast8_t>(INT8_C(-1))))
+    {
+      const auto has_borrow = detail::eval_subtract_n(r1, r1, t2, static_cast<std::int32_t>(n));
+
+      eval_multiply_kara_propagate_borrow(r0, nh, has_borrow);
+    }
+  }
+
   #if 0 // NOLINT(readability-avoid-unconditional-preprocessor-if)
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType,
@@ -676,9 +785,14 @@
                           InputLimbIteratorType  v,
                           FftFloatIteratorType   af,
                           FftFloatIteratorType   bf,
-                    const std::int32_t           prec_elems_for_multiply, // NOLINT(bugprone-easily-swappable-parameters)
-                    const std::uint32_t          n_fft) -> void           // NOLINT(bugprone-easily-swappable-parameters)
+                    const fft::fft_twiddles<typename std::iterator_traits<FftFloatIteratorType>::value_type>& tw,
+                    const std::int32_t           prec_elems_for_multiply,   // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::uint32_t          n_fft,                     // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::int32_t           result_elems_for_multiply) -> void
   {
+    // The (n * n -> 2n) product is calculated in full. Its upper
+    // result_elems_for_multiply limbs (from n up to 2n) are stored in r.
+
     using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
 
     constexpr auto local_elem_mask_half =
@@ -686,88 +800,304 @@
 
     using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
 
-    for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
-               i < static_cast<std::uint32_t>(prec_elems_for_multiply);
-             ++i)
-    {
-      af[ i * 2U]       = static_cast<local_fft_float_type>(u[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      af[(i * 2U) + 1U] = static_cast<local_fft_float_type>(u[i] % local_elem_mask_half);
+    // The half-limbs are packed as complex points with the even (high)
+    // half-limbs in the real parts and the odd (low) half-limbs in the
+    // imaginary parts. The real and imaginary parts are stored in the
+    // lower and upper halves of the FFT arrays.
+    const auto n_complex = static_cast<std::uint32_t>(n_fft / 2U);
 
-      bf[ i * 2U]       = static_cast<local_fft_float_type>(v[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      bf[(i * 2U) + 1U] = static_cast<local_fft_float_type>(v[i] % local_elem_mask_half);
-    }
+    auto a_re = af;
+    auto a_im = af + static_cast<std::ptrdiff_t>(n_complex); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto b_re = bf;
+    auto b_im = bf + static_cast<std::ptrdiff_t>(n_complex); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Squaring (which is frequent in square roots and in the AGM)
+    // needs only one forward transform.
+    const auto is_square = std::equal(u, u + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    const auto fill_distance =
+    // Transforms larger than one cache block are split into partitions,
+    // which run in parallel if the calling thread has an executor.
+    const auto partition_count =
       static_cast<std::size_t>
       (
-        static_cast<std::size_t>(prec_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))
+        (n_complex > detail::fft::fft_block_points()) ? executor_partition_count() : static_cast<std::size_t>(UINT8_C(1))
       );
 
-    std::fill(af + fill_distance, af + n_fft, static_cast<local_fft_float_type>(0));
-    std::fill(bf + fill_distance, bf + n_fft, static_cast<local_fft_float_type>(0));
+    const auto pack =
+      [prec_elems_for_multiply, n_complex, partition_count](FftFloatIteratorType x_re, FftFloatIteratorType x_im, InputLimbIteratorType x)
+      {
+        executor_run
+        (
+          partition_count,
+          [prec_elems_for_multiply, n_complex, partition_count, x_re, x_im, x](const std::size_t partition)
+          {
+            const auto i_first = detail::fft::fft_stripe_bound(n_complex, partition,      partition_count);
+            const auto i_last  = detail::fft::fft_stripe_bound(n_complex, partition + 1U, partition_count);
+
+            const auto i_limbs = (std::max)(i_first, (std::min)(i_last, static_cast<std::uint32_t>(prec_elems_for_multiply)));
+
+            for(auto i = i_first; i < i_limbs; ++i)
+            {
+              x_re[i] = static_cast<local_fft_float_type>(x[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
+              x_im[i] = static_cast<local_fft_float_type>(x[i] % local_elem_mask_half);
+            }
+
+            std::fill(x_re + static_cast<std::ptrdiff_t>(i_limbs), x_re + static_cast<std::ptrdiff_t>(i_last), static_cast<local_fft_float_type>(0)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::fill(x_im + static_cast<std::ptrdiff_t>(i_limbs), x_im + static_cast<std::ptrdiff_t>(i_last), static_cast<local_fft_float_type>(0)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+        );
+      };
+
+    const auto forward =
+      [n_complex, &tw, partition_count](FftFloatIteratorType x_re, FftFloatIteratorType x_im)
+      {
+        if(partition_count > static_cast<std::size_t>(UINT8_C(1)))
+        {
+          detail::fft::fft_dif_forward_parallel(n_complex, &x_re[0U], &x_im[0U], tw, partition_count);
+        }
+        else
+        {
+          detail::fft::fft_dif_forward(n_complex, &x_re[0U], &x_im[0U], tw);
+        }
+      };
 
     // Perform forward FFTs on the data arrays a and b.
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, true>(n_fft, af);
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, true>(n_fft, bf);
+    pack(a_re, a_im, u);
+
+    forward(a_re, a_im);
+
+    if(is_square)
+    {
+      b_re = a_re;
+      b_im = a_im;
+    }
+    else
+    {
+      pack(b_re, b_im, v);
+
+      forward(b_re, b_im);
+    }
 
     // Perform the convolution of a and b in the transform space.
     // This does, in fact, execute the actual multiplication of (a * b).
-    af[0U] *= bf[0U];
-    af[1U] *= bf[1U];
-
-    for(auto j  = static_cast<std::uint32_t>(UINT8_C(2));
-             j  < n_fft;
-             j += static_cast<std::uint32_t>(UINT8_C(2)))
+    // Then perform the reverse FFT on the result of the convolution.
+    if(partition_count > static_cast<std::size_t>(UINT8_C(1)))
     {
-      const local_fft_float_type tmp_aj = af[j];
+      detail::fft::fft_convolve_bitrev_parallel(n_complex, &a_re[0U], &a_im[0U], &b_re[0U], &b_im[0U], tw, partition_count);
 
-      af[j + 0U] = (tmp_aj * bf[j + 0U]) - (af[j + 1U] * bf[j + 1U]);
-      af[j + 1U] = (tmp_aj * bf[j + 1U]) + (af[j + 1U] * bf[j + 0U]);
+      detail::fft::fft_dit_inverse_parallel(n_complex, &a_re[0U], &a_im[0U], tw, partition_count);
     }
+    else
+    {
+      detail::fft::fft_convolve_bitrev(n_complex, &a_re[0U], &a_im[0U], &b_re[0U], &b_im[0U], tw);
 
-    // Perform the reverse FFT on the result of the convolution.
-    detail::fft::rfft_lanczos_rfft<local_fft_float_type, false>(n_fft, af);
+      detail::fft::fft_dit_inverse(n_complex, &a_re[0U], &a_im[0U], tw);
+    }
 
     // Release the carries and re-combine the low and high parts.
     // This sets the integral data elements in the big number
     // to the result of multiplication.
     using fft_carry_type = std::uint_fast64_t;
 
-    auto carry = static_cast<fft_carry_type>(UINT8_C(0));
+    // The convolution is scaled by 8 and the unscaled inverse
+    // transform by n_fft / 2. This power of 2 is removed exactly.
+    const auto fft_scale =
+      static_cast<local_fft_float_type>
+      (
+        detail::fft::template_one<local_fft_float_type>() / static_cast<local_fft_float_type>(static_cast<std::uint32_t>(n_fft * 4U))
+      );
+
+    // The limbs are released in chunks (one per partition), each of
+    // which starts without a carry. The carry out of each chunk is
+    // added into the limbs below it afterwards.
+    constexpr auto carry_partition_count_max = static_cast<std::size_t>(UINT8_C(64));
+
+    const auto carry_partition_count = (std::min)(partition_count, carry_partition_count_max);
+
+    std::array<fft_carry_type, carry_partition_count_max> carry_out { };
+
+    const auto result_elems = static_cast<std::uint32_t>(result_elems_for_multiply);
+
+    executor_run
+    (
+      carry_partition_count,
+      [r, a_re, a_im, fft_scale, result_elems, carry_partition_count, &carry_out](const std::size_t partition)
+      {
+        const auto k_first = detail::fft::fft_stripe_bound(result_elems, partition,      carry_partition_count);
+        const auto k_last  = detail::fft::fft_stripe_bound(result_elems, partition + 1U, carry_partition_count);
+
+        auto carry = static_cast<fft_carry_type>(UINT8_C(0));
+
+        for(auto k = k_last; k > k_first; --k) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          // The half-limb 2 * j (with j = k - 1) is a real part and
+          // the half-limb 2 * j - 1 is the imaginary part below it.
+          const auto j = static_cast<std::uint32_t>(k - 1U);
+
+                auto xaj   = static_cast<local_fft_float_type>(a_re[j] * fft_scale);
+          const auto xlo   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
+                     carry = static_cast<fft_carry_type> (xlo / local_elem_mask_half);
+          const auto nlo   = static_cast<local_limb_type>(xlo - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+
+          const auto j_is_non_zero = (j != static_cast<std::uint32_t>(UINT8_C(0)));
+
+                     xaj   = (j_is_non_zero ? static_cast<local_fft_float_type>(a_im[j - 1U] * fft_scale) : static_cast<local_fft_float_type>(0));
+          const auto xhi   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
+                     carry = static_cast<fft_carry_type> (xhi / local_elem_mask_half);
+          const auto nhi   = static_cast<local_limb_type>(xhi - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+
+          r[j] = static_cast<local_limb_type>(static_cast<local_limb_type>(nhi * local_elem_mask_half) + nlo);
+        }
+
+        carry_out[partition] = carry;
+      }
+    );
+
+    for(auto partition = static_cast<std::size_t>(UINT8_C(1)); partition < carry_partition_count; ++partition)
+    {
+      constexpr auto local_elem_mask = static_cast<fft_carry_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+      auto carry = carry_out[partition];
+
+      for(auto k = detail::fft::fft_stripe_bound(result_elems, partition, carry_partition_count); (carry != static_cast<fft_carry_type>(UINT8_C(0))) && (k > static_cast<std::uint32_t>(UINT8_C(0))); --k) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto sum = static_cast<fft_carry_type>(static_cast<fft_carry_type>(r[k - 1U]) + carry);
+
+        carry = static_cast<fft_carry_type>(sum / local_elem_mask);
+
+        r[k - 1U] = static_cast<local_limb_type>(sum - static_cast<fft_carry_type>(carry * local_elem_mask));
+      }
+    }
+  }
+
+  // The number of limbs in each point of the NTT multiplication,
+  // which holds 16 decimal digits per point.
+  template<typename LimbType>
+  constexpr auto ntt_limbs_per_point() -> std::uint32_t
+  {
+    return static_cast<std::uint32_t>(static_cast<std::int32_t>(INT8_C(16)) / decwide_t_helper_base<LimbType>::elem_digits10);
+  }
+
+  template<typename OutputLimbIteratorType,
+           typename InputLimbIteratorType>
+  auto mul_loop_ntt(      OutputLimbIteratorType r,
+                          InputLimbIteratorType  u,                       // NOLINT(bugprone-easily-swappable-parameters)
+                          InputLimbIteratorType  v,
+                          std::uint64_t*         ntt_pool,
+                    const ntt::ntt_twiddles&     tw,
+                    const std::int32_t           prec_elems_for_multiply,   // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::uint32_t          n_ntt,                     // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::int32_t           result_elems_for_multiply) -> void
+  {
+    // The (n * n -> 2n) product is calculated in full. Its upper
+    // result_elems_for_multiply limbs (from n up to 2n) are stored in r.
+
+    using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
 
-    const auto recombine_size =
-      static_cast<std::int32_t>
+    constexpr auto local_elem_mask = static_cast<std::uint32_t>(decwide_t_helper_base<local_limb_type>::elem_mask);
+
+    // Each point of the transforms holds the 16 decimal digits of
+    // (two, four or eight) consecutive limbs. The coefficients of the
+    // convolution stay below 2^137 and are recovered exactly from
+    // their residues modulo the three primes (with a product of 2^184).
+    constexpr auto limbs_per_point = ntt_limbs_per_point<local_limb_type>();
+
+    const auto prec = static_cast<std::uint32_t>(prec_elems_for_multiply);
+
+    const auto n_points_in =
+      static_cast<std::uint32_t>
       (
-          static_cast<std::int32_t>(prec_elems_for_multiply * static_cast<std::int32_t>(INT8_C(2)))
-        - static_cast<std::int32_t>(INT8_C(2))
+        static_cast<std::uint32_t>(prec + static_cast<std::uint32_t>(limbs_per_point - 1U)) / limbs_per_point
       );
 
-    for(auto                           j   = static_cast<std::uint32_t>(recombine_size);
-             static_cast<std::int32_t>(j) >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
-                                       j  -= static_cast<std::uint32_t>(UINT8_C(2)))
+    const auto pack =
+      [&u, &v, prec, n_points_in, n_ntt](std::uint64_t* x, const bool pack_u)
+      {
+        for(auto i = static_cast<std::uint32_t>(UINT8_C(0)); i < n_points_in; ++i)
+        {
+          auto point = static_cast<std::uint64_t>(UINT8_C(0));
+
+          for(auto s = static_cast<std::uint32_t>(UINT8_C(0)); s < limbs_per_point; ++s)
+          {
+            const auto index = static_cast<std::uint32_t>(static_cast<std::uint32_t>(i * limbs_per_point) + s);
+
+            const auto limb = ((index < prec) ? static_cast<std::uint64_t>(pack_u ? u[index] : v[index]) : static_cast<std::uint64_t>(UINT8_C(0)));
+
+            point = static_cast<std::uint64_t>(static_cast<std::uint64_t>(point * local_elem_mask) + limb);
+          }
+
+          x[i] = point; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        std::fill(x + static_cast<std::ptrdiff_t>(n_points_in), x + static_cast<std::ptrdiff_t>(n_ntt), static_cast<std::uint64_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      };
+
+    // The pool holds the residues modulo the three primes
+    // followed by the second operand.
+    std::uint64_t* a0 = ntt_pool;
+    std::uint64_t* a1 = ntt_pool + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n_ntt) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::uint64_t* a2 = ntt_pool + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n_ntt) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::uint64_t* b  = ntt_pool + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n_ntt) * static_cast<std::size_t>(UINT8_C(3))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Squaring (which is frequent in square roots and in the AGM)
+    // needs only one forward transform per prime.
+    const auto is_square = std::equal(u, u + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    pack(a0, true);
+
+    std::copy(a0, a0 + static_cast<std::ptrdiff_t>(n_ntt), a1); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::copy(a0, a0 + static_cast<std::ptrdiff_t>(n_ntt), a2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    if(!is_square) { pack(b, false); }
+    ntt::ntt_convolve<ntt::ntt_prime_0>(n_ntt, a0, (is_square ? a0 : b), tw.fwd[0U], tw.inv[0U]);
+
+    if(!is_square) { pack(b, false); }
+    ntt::ntt_convolve<ntt::ntt_prime_1>(n_ntt, a1, (is_square ? a1 : b), tw.fwd[1U], tw.inv[1U]);
+
+    if(!is_square) { pack(b, false); }
+    ntt::ntt_convolve<ntt::ntt_prime_2>(n_ntt, a2, (is_square ? a2 : b), tw.fwd[2U], tw.inv[2U]);
+
+    // Release the carries and split the points into limbs. The limbs
+    // of point i are stored from index (i + 1) * limbs_per_point onward
+    // and the final carry goes into the leading limbs. The carries start
+    // two points below the result, such that the carries which are left
+    // out can not reach the limbs of the result.
+    const auto result_elems = static_cast<std::uint32_t>(result_elems_for_multiply);
+
+    const auto n_points_out =
+      static_cast<std::uint32_t>
+      (
+        static_cast<std::uint32_t>(result_elems + static_cast<std::uint32_t>(limbs_per_point - 1U)) / limbs_per_point
+      );
+
+    auto carry = ntt::ntt_crt_value_type { };
+
+    for(auto i = static_cast<std::int32_t>((std::min)(static_cast<std::uint32_t>(n_points_out + 1U), static_cast<std::uint32_t>(n_ntt - 1U))); i >= static_cast<std::int32_t>(INT8_C(-1)); --i) // NOLINT(altera-id-dependent-backward-branch)
     {
-      const auto n_fft_half =
-        static_cast<local_fft_float_type>
+      if(i >= static_cast<std::int32_t>(INT8_C(0)))
+      {
+        const auto point_index = static_cast<std::uint32_t>(i);
+
+        ntt::ntt_crt_add(carry, ntt::ntt_crt(a0[point_index], a1[point_index], a2[point_index])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      const auto first_limb =
+        static_cast<std::uint32_t>
         (
-          static_cast<std::uint32_t>
-          (
-            n_fft >> static_cast<unsigned>(UINT8_C(1))
-          )
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(i + static_cast<std::int32_t>(INT8_C(1))) * limbs_per_point)
         );
 
-            auto xaj   = static_cast<local_fft_float_type>(af[j] / n_fft_half);
-      const auto xlo   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xlo / local_elem_mask_half);
-      const auto nlo   = static_cast<local_limb_type>(xlo - static_cast<fft_carry_type>(carry * local_elem_mask_half));
-
-      const auto j_is_non_zero = (j != static_cast<std::uint32_t>(UINT8_C(0)));
+      for(auto s = limbs_per_point; s-- > static_cast<std::uint32_t>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto limb = ntt::ntt_crt_divmod<local_elem_mask>(carry);
 
-                 xaj   = (j_is_non_zero ? static_cast<local_fft_float_type>(af[j - 1U] / n_fft_half) : static_cast<local_fft_float_type>(0));
-      const auto xhi   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xhi / local_elem_mask_half);
-      const auto nhi   = static_cast<local_limb_type>(xhi - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+        const auto index = static_cast<std::uint32_t>(first_limb + s);
 
-      r[j / 2U] = static_cast<local_limb_type>(static_cast<local_limb_type>(nhi * local_elem_mask_half) + nlo);
+        if(index < result_elems)
+        {
+          r[index] = static_cast<local_limb_type>(limb);
+        }
+      }
     }
   }
 
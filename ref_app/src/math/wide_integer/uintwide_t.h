@@ -1512,6 +1512,21 @@
                         const uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>& b,
                         std::enable_if_t<(IsSignedLeft || IsSignedRight), int>* p_nullparam = nullptr) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSignedLeft>, uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>>;
 
+  template<const size_t Width2,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = void>
+  class montgomery_field;
+
+  template<const size_t Width2,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = void>
+  class barrett_reduction;
+
+  template<const size_t Width2,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = void>
+  class fixed_base_powm;
+
   template<const size_t Width2,
            typename LimbType = std::uint32_t,
            typename AllocatorType = void,
@@ -2137,6 +2152,93 @@
         )
       );
 
+    // The thresholds (in bits) at which multiplication switches from
+    // Karatsuba to Toom-Cook 3-way and from there to the number-theoretic
+    // transform (NTT). The defaults stem from repeated runs of the
+    // calibration in the throughput section of app_benchmark_wide_integer.cpp
+    // on a 64-bit host. With 64-bit limbs, Toom-Cook beats Karatsuba from
+    // 32k bits, but the NTT beats Toom-Cook only from about 256k bits.
+    // So at 64k bits, these limbs gain at most about 5% over Karatsuba.
+    // With 32-bit limbs (or smaller), the NTT is already faster from 32k
+    // bits on (about 1.7 times at 64k bits), below which Toom-Cook does not
+    // beat Karatsuba. So the Toom-Cook tier is not used for these limbs,
+    // neither for a product nor as a step of the recursion. It is only
+    // reached with mul_with_algorithm() or with a lower threshold.
+    // The thresholds can be overridden with WIDE_INTEGER_TOOM3_THRESHOLD_BITS
+    // and WIDE_INTEGER_NTT_THRESHOLD_BITS.
+    #if defined(WIDE_INTEGER_NTT_THRESHOLD_BITS)
+    static constexpr auto ntt_threshold_bits = static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD_BITS);
+    #else
+    static constexpr auto ntt_threshold_bits =
+      static_cast<size_t>
+      (
+        (std::numeric_limits<limb_type>::digits > static_cast<int>(INT8_C(32))) ? static_cast<size_t>(UINT32_C(262144))
+                                                                                : static_cast<size_t>(UINT32_C(32768))
+      );
+    #endif
+
+    #if defined(WIDE_INTEGER_TOOM3_THRESHOLD_BITS)
+    static constexpr auto toom3_threshold_bits = static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD_BITS);
+    #else
+    static constexpr auto toom3_threshold_bits =
+      static_cast<size_t>
+      (
+        (std::numeric_limits<limb_type>::digits > static_cast<int>(INT8_C(32))) ? static_cast<size_t>(UINT32_C(32768))
+                                                                                : ntt_threshold_bits
+      );
+    #endif
+
+    static constexpr size_t number_of_limbs_toom3_threshold =
+      detail::max_unsafe
+      (
+        number_of_limbs_karatsuba_threshold,
+        static_cast<size_t>(toom3_threshold_bits / static_cast<size_t>(std::numeric_limits<limb_type>::digits))
+      );
+
+    static constexpr size_t number_of_limbs_ntt_threshold =
+      detail::max_unsafe
+      (
+        number_of_limbs_toom3_threshold,
+        static_cast<size_t>(ntt_threshold_bits / static_cast<size_t>(std::numeric_limits<limb_type>::digits))
+      );
+
+    // The threshold (in bits) from which division calculates the reciprocal
+    // of the divisor with Newton iteration and obtains the quotient with
+    // two multiplications, instead of using Knuth's long division. Since
+    // the reciprocal is calculated anew for each division, this only pays
+    // off for very wide integers. The long division with 64-bit limbs is
+    // about twice as fast, so that the threshold is higher for these.
+    // The threshold can be overridden with WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_BITS.
+    // Repeated reductions by the same modulus should use barrett_reduction.
+    #if defined(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_BITS)
+    static constexpr auto newton_division_threshold_bits = static_cast<size_t>(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_BITS);
+    #else
+    static constexpr auto newton_division_threshold_bits =
+      static_cast<size_t>
+      (
+        (std::numeric_limits<limb_type>::digits > static_cast<int>(INT8_C(32))) ? static_cast<size_t>(UINT32_C(262144))
+                                                                                : static_cast<size_t>(UINT32_C(131072))
+      );
+    #endif
+
+    static constexpr size_t number_of_limbs_newton_division_threshold =
+      detail::max_unsafe
+      (
+        static_cast<size_t>(UINT8_C(2)),
+        static_cast<size_t>(newton_division_threshold_bits / static_cast<size_t>(std::numeric_limits<limb_type>::digits))
+      );
+
+    enum class multiplication_algorithm { schoolbook, karatsuba, toom3, ntt };
+
+    static constexpr auto multiplication_algorithm_of(const size_t limb_count) -> multiplication_algorithm
+    {
+      return
+        (limb_count < number_of_limbs_karatsuba_threshold) ? multiplication_algorithm::schoolbook :
+        (limb_count < number_of_limbs_toom3_threshold)     ? multiplication_algorithm::karatsuba  :
+        (limb_count < number_of_limbs_ntt_threshold)       ? multiplication_algorithm::toom3      :
+                                                             multiplication_algorithm::ntt;
+    }
+
     // Verify that the Width2 template parameter (mirrored with my_width2):
     //   * Is equal to 2^n times 1...63.
     //   * And that there are at least 16, 24 or 32 binary digits, or more.
@@ -2568,6 +2670,36 @@
       return *this;
     }
 
+    // Multiply with an explicitly selected algorithm regardless of the
+    // thresholds. This is intended for the calibration of the thresholds.
+    constexpr auto mul_with_algorithm(const uintwide_t& other, const multiplication_algorithm algorithm) -> uintwide_t&
+    {
+      const uintwide_t other_copy(other); // NOLINT(performance-unnecessary-copy-initialization)
+
+      switch(algorithm)
+      {
+        case multiplication_algorithm::karatsuba: eval_mul_unary(*this, other_copy, std::integral_constant<multiplication_algorithm, multiplication_algorithm::karatsuba>()); break;
+        case multiplication_algorithm::toom3:     eval_mul_unary(*this, other_copy, std::integral_constant<multiplication_algorithm, multiplication_algorithm::toom3>());     break;
+        case multiplication_algorithm::ntt:       eval_mul_unary(*this, other_copy, std::integral_constant<multiplication_algorithm, multiplication_algorithm::ntt>());       break;
+        case multiplication_algorithm::schoolbook:
+        default:                                  eval_mul_unary(*this, other_copy, std::integral_constant<multiplication_algorithm, multiplication_algorithm::schoolbook>()); break;
+      }
+
+      return *this;
+    }
+
+    // Calculate the full product of a and b having double width. The values
+    // are treated as unsigned. The algorithm is selected from the number
+    // of limbs, in the same way as for the multiplication operator.
+    WIDE_INTEGER_NODISCARD static constexpr auto mul_to_double_width(const uintwide_t& a, const uintwide_t& b) -> double_width_type
+    {
+      double_width_type result { };
+
+      eval_mul_to_double_width(result.representation().begin(), a, b, std::integral_constant<multiplication_algorithm, multiplication_algorithm_of(number_of_limbs)>());
+
+      return result;
+    }
+
     constexpr auto mul_by_limb(const limb_type v) -> uintwide_t&
     {
       if(v == static_cast<limb_type>(UINT8_C(0)))
@@ -2614,7 +2746,7 @@
           if(numer_was_neg) { a.negate(); }
           if(denom_was_neg) { b.negate(); }
 
-          a.eval_divide_knuth(b);
+          a.eval_divide(b);
 
           if(numer_was_neg != denom_was_neg) { a.negate(); }
 
@@ -2622,7 +2754,7 @@
         }
         else
         {
-          eval_divide_knuth(other);
+          eval_divide(other);
         }
       }
 
@@ -2653,7 +2785,7 @@
 
           local_unsigned_wide_type remainder_unsigned { };
 
-          a.eval_divide_knuth(b, &remainder_unsigned);
+          a.eval_divide(b, &remainder_unsigned);
 
           // The sign of the remainder follows the sign of the denominator.
           if(numer_was_neg) { remainder_unsigned.negate(); }
@@ -2664,7 +2796,7 @@
         {
           uintwide_t remainder { };
 
-          eval_divide_knuth(other, &remainder);
+          eval_divide(other, &remainder);
 
           values = remainder.values;
         }
@@ -3439,6 +3571,16 @@
   #endif
     friend auto ::test_uintwide_t_edge::test_various_isolated_edge_cases() -> bool;
 
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType>
+    friend class montgomery_field;
+
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType>
+    friend class barrett_reduction;
+
     template<const size_t OtherWidth2,
              typename OtherLimbType,
              typename OtherAllocatorType,
@@ -3668,12 +3810,19 @@
     }
     #endif
 
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v) -> void
+    {
+      // Select the multiplication algorithm from the number of limbs.
+      eval_mul_unary(u, v, std::integral_constant<multiplication_algorithm, multiplication_algorithm_of(static_cast<size_t>(OtherWidth2 / static_cast<size_t>(std::numeric_limits<LimbType>::digits)))>());
+    }
+
     template<const size_t OtherWidth2>
     static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
                                          const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
-                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+                                         const std::integral_constant<multiplication_algorithm, multiplication_algorithm::schoolbook>&) -> void
     {
-      static_cast<void>(p_nullparam == nullptr);
 
       // Unary multiplication function using schoolbook multiplication,
       // but we only need to retain the low half of the n*n algorithm.
@@ -3704,9 +3853,8 @@
     template<const size_t OtherWidth2>
     static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
                                          const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
-                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+                                         const std::integral_constant<multiplication_algorithm, multiplication_algorithm::karatsuba>&) -> void
     {
-      static_cast<void>(p_nullparam == nullptr);
 
       // Unary multiplication function using Karatsuba multiplication.
 
@@ -3749,6 +3897,179 @@
                           u.values.begin());
     }
 
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                         const std::integral_constant<multiplication_algorithm, multiplication_algorithm::toom3>&) -> void
+    {
+
+      // Unary multiplication function using Toom-Cook 3-way multiplication.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_temp_size = static_cast<size_t>(eval_multiply_toom3_temp_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      using result_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_temp_size>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_temp_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      result_array_type  result { };
+      storage_array_type t { };
+
+      eval_multiply_toom3_n_by_n_to_2n(result.begin(),
+                                       u.values.cbegin(),
+                                       v.values.cbegin(),
+                                       local_number_of_limbs,
+                                       t.begin());
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                         const std::integral_constant<multiplication_algorithm, multiplication_algorithm::ntt>&) -> void
+    {
+
+      // Unary multiplication function using the number-theoretic transform.
+
+      static_assert(static_cast<size_t>(OtherWidth2 % static_cast<size_t>(UINT8_C(32))) == static_cast<size_t>(UINT8_C(0)),
+                    "Error: The NTT multiplication requires a width that is a multiple of 32 bits");
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_transform_size = ntt_transform_size(static_cast<size_t>(OtherWidth2 / static_cast<size_t>(UINT8_C(32))));
+
+      static_assert(local_transform_size <= ntt_transform_size_max,
+                    "Error: The width exceeds the limit of the NTT multiplication");
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <std::uint32_t,
+                                                       static_cast<size_t>(local_transform_size * static_cast<size_t>(UINT8_C(9)))>,
+                           detail::fixed_dynamic_array<std::uint32_t,
+                                                       static_cast<size_t>(local_transform_size * static_cast<size_t>(UINT8_C(9))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<std::uint32_t>>>;
+
+      storage_array_type t { };
+
+      // The digits of u and v are extracted before the result is written to u.
+      eval_multiply_ntt_n_by_n(u.values.begin(),
+                               u.values.cbegin(),
+                               v.values.cbegin(),
+                               local_number_of_limbs,
+                               local_number_of_limbs,
+                               t.begin());
+    }
+
+    template<typename ResultIterator>
+    static constexpr auto eval_mul_to_double_width(      ResultIterator r,
+                                                   const uintwide_t&    a,
+                                                   const uintwide_t&    b,
+                                                   const std::integral_constant<multiplication_algorithm, multiplication_algorithm::schoolbook>&) -> void
+    {
+      eval_multiply_n_by_n_to_2n(r, a.values.cbegin(), b.values.cbegin(), number_of_limbs);
+    }
+
+    template<typename ResultIterator>
+    static constexpr auto eval_mul_to_double_width(      ResultIterator r,
+                                                   const uintwide_t&    a,
+                                                   const uintwide_t&    b,
+                                                   const std::integral_constant<multiplication_algorithm, multiplication_algorithm::karatsuba>&) -> void
+    {
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4)))>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      storage_array_type t { };
+
+      eval_multiply_kara_n_by_n_to_2n(r, a.values.cbegin(), b.values.cbegin(), number_of_limbs, t.begin());
+    }
+
+    template<typename ResultIterator>
+    static constexpr auto eval_mul_to_double_width(      ResultIterator r,
+                                                   const uintwide_t&    a,
+                                                   const uintwide_t&    b,
+                                                   const std::integral_constant<multiplication_algorithm, multiplication_algorithm::toom3>&) -> void
+    {
+      constexpr auto local_temp_size = static_cast<size_t>(eval_multiply_toom3_temp_size(static_cast<unsigned_fast_type>(number_of_limbs)));
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_temp_size>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_temp_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      storage_array_type t { };
+
+      eval_multiply_toom3_n_by_n_to_2n(r, a.values.cbegin(), b.values.cbegin(), number_of_limbs, t.begin());
+    }
+
+    template<typename ResultIterator>
+    static constexpr auto eval_mul_to_double_width(      ResultIterator r,
+                                                   const uintwide_t&    a,
+                                                   const uintwide_t&    b,
+                                                   const std::integral_constant<multiplication_algorithm, multiplication_algorithm::ntt>&) -> void
+    {
+      static_assert(static_cast<size_t>(Width2 % static_cast<size_t>(UINT8_C(32))) == static_cast<size_t>(UINT8_C(0)),
+                    "Error: The NTT multiplication requires a width that is a multiple of 32 bits");
+
+      // The transform of the n*n->n multiplication already holds the full product.
+      constexpr auto local_transform_size = ntt_transform_size(static_cast<size_t>(Width2 / static_cast<size_t>(UINT8_C(32))));
+
+      static_assert(local_transform_size <= ntt_transform_size_max,
+                    "Error: The width exceeds the limit of the NTT multiplication");
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <std::uint32_t,
+                                                       static_cast<size_t>(local_transform_size * static_cast<size_t>(UINT8_C(9)))>,
+                           detail::fixed_dynamic_array<std::uint32_t,
+                                                       static_cast<size_t>(local_transform_size * static_cast<size_t>(UINT8_C(9))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<std::uint32_t>>>;
+
+      storage_array_type t { };
+
+      eval_multiply_ntt_n_by_n(r,
+                               a.values.cbegin(),
+                               b.values.cbegin(),
+                               number_of_limbs,
+                               static_cast<unsigned_fast_type>(number_of_limbs * static_cast<size_t>(UINT8_C(2))),
+                               t.begin());
+    }
+
     template<typename ResultIterator,
              typename InputIteratorLeft,
              typename InputIteratorRight>
@@ -4740,825 +5061,2157 @@
       }
     }
 
-    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    static constexpr auto eval_multiply_kara_size(const unsigned_fast_type n) -> unsigned_fast_type
     {
-      // Use Knuth's long division algorithm.
-      // The loop-ordering of indices in Knuth's original
-      // algorithm has been reversed due to the data format
-      // used here. Several optimizations and combinations
-      // of logic have been carried out in the source code.
+      // Get the smallest size that is not less than n and that
+      // the Karatsuba multiplication can halve evenly down to
+      // its schoolbook base case of 48 limbs or less.
+      auto shift = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-      // See also:
-      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
-      // Seminumerical Algorithms", Addison-Wesley (1998),
-      // Section 4.3.1 Algorithm D and Exercise 16.
+      while(static_cast<unsigned_fast_type>((n + static_cast<unsigned_fast_type>((static_cast<unsigned_fast_type>(UINT8_C(1)) << shift) - 1U)) >> shift) > static_cast<unsigned_fast_type>(UINT32_C(48))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++shift;
+      }
 
-      using local_uint_index_type = unsigned_fast_type;
+      return
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned_fast_type>((n + static_cast<unsigned_fast_type>((static_cast<unsigned_fast_type>(UINT8_C(1)) << shift) - 1U)) >> shift) << shift
+        );
+    }
 
-      local_uint_index_type u_offset { };
-      local_uint_index_type v_offset { };
+    static constexpr auto eval_multiply_toom3_sub_size(const unsigned_fast_type n) -> unsigned_fast_type
+    {
+      // The size of the sub-multiplications of the Toom-Cook 3-way
+      // multiplication, see eval_multiply_toom3_sub_n_by_n_to_2n().
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n >= static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold)) ? n : eval_multiply_kara_size(n)
+        );
+    }
 
-      auto crit_u =       values.crbegin();
-      auto crit_v = other.values.crbegin();
+    static constexpr auto eval_multiply_toom3_temp_size(const unsigned_fast_type n) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // The number of temporary limbs needed for one step of Toom-Cook 3-way
+      // multiplication of n*n limbs, including its sub-multiplications.
+      return
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(eval_multiply_toom3_sub_size(static_cast<unsigned_fast_type>(((n + 2U) / 3U) + 1U)) * 22U)
+          + eval_multiply_toom3_sub_temp_size(eval_multiply_toom3_sub_size(static_cast<unsigned_fast_type>(((n + 2U) / 3U) + 1U)))
+        );
+    }
 
-      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        ++crit_u;
-        ++u_offset;
-      }
+    static constexpr auto eval_multiply_toom3_sub_temp_size(const unsigned_fast_type n) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n < static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold))
+            ? static_cast<unsigned_fast_type>(n * 4U)
+            : eval_multiply_toom3_temp_size(n)
+        );
+    }
 
-      while(crit_v != other.values.crend() && (*crit_v == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+    template<typename InputIteratorTemp>
+    static constexpr auto eval_multiply_toom3_shift_right_one(InputIteratorTemp x, const unsigned_fast_type count) -> void
+    {
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type;
+
+      auto bit_from_above = static_cast<local_limb_type>(UINT8_C(0));
+
+      for(auto i = count; i > static_cast<unsigned_fast_type>(UINT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
       {
-        ++crit_v;
-        ++v_offset;
+        const auto limb = *detail::advance_and_point(x, static_cast<size_t>(i - 1U));
+
+        *detail::advance_and_point(x, static_cast<size_t>(i - 1U)) =
+          static_cast<local_limb_type>
+          (
+              static_cast<local_limb_type>(limb >> 1U)
+            | static_cast<local_limb_type>(bit_from_above << static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits - 1))
+          );
+
+        bit_from_above = static_cast<local_limb_type>(limb & static_cast<local_limb_type>(UINT8_C(1)));
       }
+    }
 
-      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
+    template<typename InputIteratorTemp>
+    static constexpr auto eval_multiply_toom3_divide_by_three(InputIteratorTemp x, const unsigned_fast_type count) -> void
+    {
+      // Divide by 3, where the division is known to be exact.
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(static_cast<int>(std::numeric_limits<local_limb_type>::digits * static_cast<int>(INT8_C(2))))>::exact_unsigned_type;
+
+      auto remainder = static_cast<local_double_limb_type>(UINT8_C(0));
+
+      for(auto i = count; i > static_cast<unsigned_fast_type>(UINT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
       {
-        // The denominator is zero. Set the maximum value and return.
-        // This also catches (0 / 0) and sets the maximum value for it.
-        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+        const auto numerator =
+          static_cast<local_double_limb_type>
+          (
+              static_cast<local_double_limb_type>(remainder << static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits))
+            | *detail::advance_and_point(x, static_cast<size_t>(i - 1U))
+          );
 
-        if(remainder != nullptr) // LCOV_EXCL_LINE
-        {
-          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
-        }
+        *detail::advance_and_point(x, static_cast<size_t>(i - 1U)) = static_cast<local_limb_type>(numerator / 3U);
+
+        remainder = static_cast<local_double_limb_type>(numerator % 3U);
       }
-      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The numerator is zero. Do nothing and return.
+    }
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
+    template<typename InputIteratorTemp>
+    static constexpr auto eval_multiply_toom3_evaluate(InputIteratorTemp        x0,
+                                                       InputIteratorTemp        x1,
+                                                       InputIteratorTemp        x2,
+                                                       InputIteratorTemp        p1,
+                                                       InputIteratorTemp        pm1,
+                                                       InputIteratorTemp        p2,
+                                                       const unsigned_fast_type m) -> std::int_fast8_t
+    {
+      // Evaluate the polynomial x0 + x1 y + x2 y^2 at the points
+      // y = 1, y = -1 and y = 2. The value at y = -1 is stored as
+      // its magnitude and the sign of it is returned.
+
+      //   x0 + x2 -> p1
+      static_cast<void>(eval_add_n(p1, x0, x2, m));
+
+      //   |x0 - x1 + x2| -> pm1
+      const auto cmp_result = compare_ranges(p1, x1, m);
+
+      if(cmp_result >= static_cast<std::int_fast8_t>(INT8_C(0)))
+      {
+        static_cast<void>(eval_subtract_n(pm1, p1, x1, m));
       }
       else
       {
-        const auto result_of_compare_left_with_right = compare(other);
+        static_cast<void>(eval_subtract_n(pm1, x1, p1, m));
+      }
 
-        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
-        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+      //   x0 + x1 + x2 -> p1
+      static_cast<void>(eval_add_n(p1, p1, x1, m));
 
-        if(left_is_less_than_right)
-        {
-          // If the denominator is larger than the numerator,
-          // then the result of the division is zero.
-          if(remainder != nullptr)
-          {
-            *remainder = *this;
-          }
+      //   x0 + 2 (x1 + 2 x2) -> p2
+      static_cast<void>(eval_add_n(p2, x2, x2, m));
+      static_cast<void>(eval_add_n(p2, p2, x1, m));
+      static_cast<void>(eval_add_n(p2, p2, p2, m));
+      static_cast<void>(eval_add_n(p2, p2, x0, m));
 
-          operator=(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
-        else if(left_is_equal_to_right)
-        {
-          // If the denominator is equal to the numerator,
-          // then the result of the division is one.
-          operator=(static_cast<std::uint8_t>(UINT8_C(1)));
+      return cmp_result;
+    }
 
-          if(remainder != nullptr)
-          {
-            *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
-          }
-        }
-        else
-        {
-          eval_divide_knuth_core(u_offset, v_offset, other, remainder);
-        }
+    template<typename ResultIterator,
+             typename InputIteratorTemp>
+    static constexpr auto eval_multiply_toom3_add_at(      ResultIterator     r,
+                                                     const unsigned_fast_type offset,
+                                                     const unsigned_fast_type count_r,
+                                                           InputIteratorTemp  c,
+                                                     const unsigned_fast_type count_c) -> void
+    {
+      // Add c to r at the limb offset. The limbs of c that lie beyond
+      // the end of r are known to be zero.
+      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
+
+      const auto count = detail::min_unsafe(count_c, static_cast<unsigned_fast_type>(count_r - offset));
+
+      ResultIterator r_offset = detail::advance_and_point(r, static_cast<result_difference_type>(offset));
+
+      const auto carry = eval_add_n(r_offset, r_offset, c, count);
+
+      eval_multiply_kara_propagate_carry(detail::advance_and_point(r_offset, static_cast<result_difference_type>(count)),
+                                         static_cast<unsigned_fast_type>(count_r - static_cast<unsigned_fast_type>(offset + count)),
+                                         carry);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_multiply_toom3_sub_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                              const InputIteratorLeft  a,
+                                              const InputIteratorRight b,
+                                              const unsigned_fast_type n,
+                                                    InputIteratorTemp  t) -> void
+    {
+      // The sub-multiplications of the Toom-Cook 3-way multiplication
+      // recurse into Toom-Cook 3-way or switch to Karatsuba. Here, n
+      // has been obtained from eval_multiply_toom3_sub_size().
+      if(n >= static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold))
+      {
+        eval_multiply_toom3_n_by_n_to_2n(r, a, b, n, t);
+      }
+      else
+      {
+        eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
       }
     }
 
-    template<const size_t RePhraseWidth2 = Width2>
-    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset, // NOLINT(readability-function-cognitive-complexity)
-                                          const unsigned_fast_type v_offset,
-                                          const uintwide_t& other,
-                                                uintwide_t* remainder,
-                                          std::enable_if_t<(RePhraseWidth2 > static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_multiply_toom3_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                          const InputIteratorLeft  a,
+                                          const InputIteratorRight b,
+                                          const unsigned_fast_type n,
+                                                InputIteratorTemp  t) -> void
     {
-      static_cast<void>(p_nullparam);
+      static_assert
+      (
+           (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
 
-      using local_uint_index_type = unsigned_fast_type;
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-      if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
+      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
+      using temp_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::difference_type;
+
+      // Based on "Algorithm 1.4 ToomCook3", Sect. 1.3.3, page 7
+      // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press (2011).
+
+      // The operands are split into three parts of k limbs, such as
+      // a = a0 + a1 y + a2 y^2 with y = b^k. The product polynomial
+      // c0 + c1 y + c2 y^2 + c3 y^3 + c4 y^4 is evaluated at the points
+      // y = 0, 1, -1, 2 and infinity with five sub-multiplications.
+      // The interpolation is ordered such that all intermediate values
+      // remain non-negative. It uses one exact division by 3.
+
+      // The parts and the evaluated operands are zero-padded to m limbs,
+      // which holds the carries of the evaluation and is a size that
+      // the sub-multiplications can handle.
+
+      const auto k  = static_cast<unsigned_fast_type>((n + 2U) / 3U);
+      const auto k2 = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+      const auto m  = eval_multiply_toom3_sub_size(static_cast<unsigned_fast_type>(k + 1U));
+      const auto m2 = static_cast<unsigned_fast_type>(m * 2U);
+
+      InputIteratorTemp a0   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  0U));
+      InputIteratorTemp a1   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  1U));
+      InputIteratorTemp a2   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  2U));
+      InputIteratorTemp b0   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  3U));
+      InputIteratorTemp b1   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  4U));
+      InputIteratorTemp b2   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  5U));
+      InputIteratorTemp p1   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  6U));
+      InputIteratorTemp pm1  = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  7U));
+      InputIteratorTemp p2   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  8U));
+      InputIteratorTemp q1   = detail::advance_and_point(t, static_cast<temp_difference_type>(m *  9U));
+      InputIteratorTemp qm1  = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 10U));
+      InputIteratorTemp q2   = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 11U));
+      InputIteratorTemp w0   = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 12U));
+      InputIteratorTemp w1   = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 14U));
+      InputIteratorTemp wm1  = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 16U));
+      InputIteratorTemp w2   = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 18U));
+      InputIteratorTemp winf = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 20U));
+      InputIteratorTemp tsub = detail::advance_and_point(t, static_cast<temp_difference_type>(m * 22U));
+
+      // Step 1
+      //   Split a and b into the zero-padded parts a0, a1, a2 and b0, b1, b2.
+      detail::fill_unsafe(a0, p1, static_cast<local_limb_type>(UINT8_C(0)));
+
+      detail::copy_unsafe(a,                                                                  detail::advance_and_point(a, static_cast<left_difference_type>(k)),       a0);
+      detail::copy_unsafe(detail::advance_and_point(a, static_cast<left_difference_type>(k)), detail::advance_and_point(a, static_cast<left_difference_type>(k * 2U)),  a1);
+      detail::copy_unsafe(detail::advance_and_point(a, static_cast<left_difference_type>(k * 2U)), detail::advance_and_point(a, static_cast<left_difference_type>(n)), a2);
+
+      detail::copy_unsafe(b,                                                                   detail::advance_and_point(b, static_cast<right_difference_type>(k)),       b0);
+      detail::copy_unsafe(detail::advance_and_point(b, static_cast<right_difference_type>(k)), detail::advance_and_point(b, static_cast<right_difference_type>(k * 2U)),  b1);
+      detail::copy_unsafe(detail::advance_and_point(b, static_cast<right_difference_type>(k * 2U)), detail::advance_and_point(b, static_cast<right_difference_type>(n)), b2);
+
+      // Step 2
+      //   Evaluate a and b at the points 1, -1 and 2.
+      const auto sign_a = eval_multiply_toom3_evaluate(a0, a1, a2, p1, pm1, p2, m);
+      const auto sign_b = eval_multiply_toom3_evaluate(b0, b1, b2, q1, qm1, q2, m);
+
+      const auto wm1_is_neg = (static_cast<std::int_fast8_t>(sign_a * sign_b) < static_cast<std::int_fast8_t>(INT8_C(0)));
+
+      // Step 3
+      //   The five sub-multiplications, where wm1 is a magnitude.
+      eval_multiply_toom3_sub_n_by_n_to_2n(w0,   a0,  b0,  m, tsub);
+      eval_multiply_toom3_sub_n_by_n_to_2n(w1,   p1,  q1,  m, tsub);
+      eval_multiply_toom3_sub_n_by_n_to_2n(wm1,  pm1, qm1, m, tsub);
+      eval_multiply_toom3_sub_n_by_n_to_2n(w2,   p2,  q2,  m, tsub);
+      eval_multiply_toom3_sub_n_by_n_to_2n(winf, a2,  b2,  m, tsub);
+
+      // Step 4
+      //   (w1 - wm1) / 2 = c1 + c3 -> w1
+      if(wm1_is_neg)
+      {
+        static_cast<void>(eval_add_n(w1, w1, wm1, m2));
+      }
+      else
       {
-        // The denominator has one single limb.
-        // Use a one-dimensional division algorithm.
-        const limb_type short_denominator = *other.values.cbegin();
+        static_cast<void>(eval_subtract_n(w1, w1, wm1, m2));
+      }
 
-        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+      eval_multiply_toom3_shift_right_one(w1, m2);
+
+      // Step 5
+      //   wm1 + (c1 + c3) - w0 - winf = c2 -> wm1
+      if(wm1_is_neg)
+      {
+        static_cast<void>(eval_subtract_n(wm1, w1, wm1, m2));
       }
       else
       {
-        // We will now use the Knuth long division algorithm.
+        static_cast<void>(eval_add_n(wm1, wm1, w1, m2));
+      }
 
-        // Compute the normalization factor d.
-        const auto d =
-          static_cast<limb_type>
-          (
-              static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
-            / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - 1U) - v_offset))) + static_cast<limb_type>(1U))
-          );
+      static_cast<void>(eval_subtract_n(wm1, wm1, w0,   m2));
+      static_cast<void>(eval_subtract_n(wm1, wm1, winf, m2));
 
-        // Step D1(b), normalize u -> u * d = uu.
-        // Step D1(c): normalize v -> v * d = vv.
+      // Step 6
+      //   (((w2 - w0 - 4 (c2 + 4 winf)) / 2) - (c1 + c3)) / 3 = c3 -> w2,
+      //   where 4 (c2 + 4 winf) is stored in the (no longer needed) parts.
+      InputIteratorTemp tmp = a0;
 
-        using uu_array_type =
-          std::conditional_t<std::is_same<AllocatorType, void>::value,
-                             detail::fixed_static_array <limb_type, static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1)))>,
-                             detail::fixed_dynamic_array<limb_type,
-                                                         static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))),
-                                                         typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                                           std::allocator<void>,
-                                                                                                           AllocatorType>>::template rebind_alloc<limb_type>>>;
+      static_cast<void>(eval_add_n(tmp, winf, winf, m2));
+      static_cast<void>(eval_add_n(tmp, tmp,  tmp,  m2));
+      static_cast<void>(eval_add_n(tmp, tmp,  wm1,  m2));
+      static_cast<void>(eval_add_n(tmp, tmp,  tmp,  m2));
+      static_cast<void>(eval_add_n(tmp, tmp,  tmp,  m2));
 
-        uu_array_type uu { };
+      static_cast<void>(eval_subtract_n(w2, w2, w0,  m2));
+      static_cast<void>(eval_subtract_n(w2, w2, tmp, m2));
 
-        representation_type
-          vv
-          {
-            static_cast<typename representation_type::size_type>(number_of_limbs),
-            static_cast<typename representation_type::value_type>(UINT8_C(0)),
-            typename representation_type::allocator_type() // LCOV_EXCL_LINE
-          };
+      eval_multiply_toom3_shift_right_one(w2, m2);
 
-        if(d > static_cast<limb_type>(UINT8_C(1)))
-        {
-          {
-            const auto num_limbs_minus_u_ofs =
-              static_cast<size_t>
-              (
-                static_cast<local_uint_index_type>(number_of_limbs) - u_offset
-              );
+      static_cast<void>(eval_subtract_n(w2, w2, w1, m2));
 
-            const auto u_carry =
-              eval_multiply_1d
-              (
-                uu.begin(),
-                values.cbegin(),
-                d,
-                static_cast<unsigned_fast_type>(num_limbs_minus_u_ofs)
-              );
+      eval_multiply_toom3_divide_by_three(w2, m2);
 
-            *(uu.begin() + num_limbs_minus_u_ofs) = u_carry;
-          }
+      // Step 7
+      //   (c1 + c3) - c3 = c1 -> w1
+      static_cast<void>(eval_subtract_n(w1, w1, w2, m2));
 
-          static_cast<void>
-          (
-            eval_multiply_1d
-            (
-              vv.begin(),
-              other.values.cbegin(),
-              d,
-              static_cast<unsigned_fast_type>(number_of_limbs - v_offset)
-            )
-          );
-        }
-        else
-        {
-          detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
+      // Step 8
+      //   Recompose r = c0 + c1 y + c2 y^2 + c3 y^3 + c4 y^4.
+      const auto n2 = static_cast<unsigned_fast_type>(n * 2U);
 
-          *(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset)) = static_cast<limb_type>(UINT8_C(0));
+      detail::copy_unsafe(w0, detail::advance_and_point(w0, static_cast<temp_difference_type>(k * 2U)), r);
 
-          vv = other.values;
-        }
+      detail::fill_unsafe(detail::advance_and_point(r, static_cast<result_difference_type>(k * 2U)),
+                          detail::advance_and_point(r, static_cast<result_difference_type>(k * 4U)),
+                          static_cast<local_limb_type>(UINT8_C(0)));
 
-        // Step D2: Initialize j.
-        // Step D7: Loop on j from m to 0.
+      detail::copy_unsafe(winf,
+                          detail::advance_and_point(winf, static_cast<temp_difference_type>(k2 * 2U)),
+                          detail::advance_and_point(r, static_cast<result_difference_type>(k * 4U)));
 
-        const auto n   = static_cast<local_uint_index_type>                                   (number_of_limbs - v_offset);
-        const auto m   = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) - n);
-        const auto vj0 = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(n - static_cast<local_uint_index_type>(UINT8_C(1))));
+      eval_multiply_toom3_add_at(r, static_cast<unsigned_fast_type>(k * 1U), n2, w1,  m2);
+      eval_multiply_toom3_add_at(r, static_cast<unsigned_fast_type>(k * 2U), n2, wm1, m2);
+      eval_multiply_toom3_add_at(r, static_cast<unsigned_fast_type>(k * 3U), n2, w2,  m2);
+    }
 
-        auto vv_at_vj0_it = detail::advance_and_point(vv.cbegin(), static_cast<size_t>(vj0)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+    // The number-theoretic transform (NTT) multiplication uses three
+    // primes of the form c * 2^k + 1 (with k >= 23) and their primitive
+    // roots. The convolution is computed exactly modulo each of the primes
+    // and the coefficients are recovered with the Chinese remainder theorem.
+    static constexpr auto ntt_prime_0 = static_cast<std::uint32_t>(UINT32_C(998244353)); // 119 * 2^23 + 1
+    static constexpr auto ntt_prime_1 = static_cast<std::uint32_t>(UINT32_C(469762049)); //   7 * 2^26 + 1
+    static constexpr auto ntt_prime_2 = static_cast<std::uint32_t>(UINT32_C(754974721)); //  45 * 2^24 + 1
 
-        const auto vv_at_vj0           = *vv_at_vj0_it--;
-        const auto vv_at_vj0_minus_one = *vv_at_vj0_it;
+    static constexpr auto ntt_root_0 = static_cast<std::uint32_t>(UINT8_C(3));
+    static constexpr auto ntt_root_1 = static_cast<std::uint32_t>(UINT8_C(3));
+    static constexpr auto ntt_root_2 = static_cast<std::uint32_t>(UINT8_C(11));
 
-        auto values_at_m_minus_j_it = detail::advance_and_point(values.begin(), static_cast<size_t>(m)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+    // The largest transform size is limited by the smallest power of two in
+    // the primes. The convolution of 32-bit digits of this length can not
+    // exceed the product of the primes (about 2^88).
+    static constexpr auto ntt_transform_size_max = static_cast<size_t>(UINT32_C(0x800000));
 
-        for(auto j = static_cast<local_uint_index_type>(UINT8_C(0)); j <= m; ++j) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          // Step D3 [Calculate q_hat].
-          //   if u[j] == v[j0]
-          //     set q_hat = b - 1
-          //   else
-          //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+    static constexpr auto ntt_transform_size(const size_t digit_count) -> size_t
+    {
+      // The transform size is a power of two that holds the full product.
+      auto transform_size = static_cast<size_t>(UINT8_C(1));
 
-          const auto uj     = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs + 1U) - 1U) - u_offset) - j);
-          const auto u_j_j1 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*(uu.cbegin() + static_cast<size_t>(uj))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + static_cast<size_t>(uj - 1U)));
+      while(transform_size < static_cast<size_t>(digit_count * 2U)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        transform_size = static_cast<size_t>(transform_size * 2U);
+      }
 
-          auto q_hat =
-            static_cast<limb_type>
-            (
-              (*(uu.cbegin() + static_cast<size_t>(uj)) == vv_at_vj0)
-                ? (std::numeric_limits<limb_type>::max)()
-                : static_cast<limb_type>(u_j_j1 / vv_at_vj0)
-            );
+      return transform_size;
+    }
 
-          // Decrease q_hat if necessary.
-          // This means that q_hat must be decreased if the
-          // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
-          // exceeds the range of uintwide_t.
+    template<const std::uint32_t Prime>
+    static constexpr auto ntt_mul_mod(const std::uint32_t a, const std::uint32_t b) -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * b) % Prime);
+    }
 
-          for(auto t = static_cast<double_limb_type>(u_j_j1 - static_cast<double_limb_type>(q_hat * static_cast<double_limb_type>(vv_at_vj0)));
-                     ;
-                       --q_hat, t = static_cast<double_limb_type>(t + vv_at_vj0))
-          {
-            if(   (detail::make_hi<limb_type>(t) != static_cast<limb_type>(UINT8_C(0)))
-               || (   static_cast<double_limb_type>(static_cast<double_limb_type>(vv_at_vj0_minus_one) * q_hat)
-                   <= static_cast<double_limb_type>(static_cast<double_limb_type>(t << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *detail::advance_and_point(uu.cbegin(), static_cast<size_t>(uj - 2U)))))
-            {
-              break;
-            }
-          }
+    template<const std::uint32_t Prime>
+    static constexpr auto ntt_pow_mod(const std::uint32_t b, const std::uint32_t p) -> std::uint32_t
+    {
+      auto result = static_cast<std::uint32_t>(UINT8_C(1));
+      auto x      = b;
 
-          {
-            // Step D4: Multiply and subtract.
-            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+      for(auto p_local = p; p_local != static_cast<std::uint32_t>(UINT8_C(0)); p_local >>= 1U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if((p_local & 1U) != static_cast<std::uint32_t>(UINT8_C(0)))
+        {
+          result = ntt_mul_mod<Prime>(result, x);
+        }
 
-            // Set nv = q_hat * (v[1, ... n]).
-            uu_array_type nv { };
+        x = ntt_mul_mod<Prime>(x, x);
+      }
 
-            *(nv.begin() + static_cast<size_t>(n)) = eval_multiply_1d(nv.begin(), vv.cbegin(), q_hat, n);
+      return result;
+    }
 
-            const auto has_borrow =
-              eval_subtract_n
-              (
-                detail::advance_and_point(uu.begin(),  static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                nv.cbegin(),
-                static_cast<unsigned_fast_type>
-                (
-                  static_cast<local_uint_index_type>(n + static_cast<local_uint_index_type>(UINT8_C(1)))
-                )
-              );
+    template<const std::uint32_t Prime>
+    static constexpr auto ntt_mul_shoup(const std::uint32_t a, const std::uint32_t w, const std::uint32_t w_shoup) -> std::uint32_t
+    {
+      // Multiply a by the constant w modulo Prime, where w_shoup = (w * 2^32) / Prime
+      // has been precomputed (V. Shoup). This requires no division. The result
+      // is lazily reduced to the range [0, 2 * Prime).
+      const auto q = static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * w_shoup) >> 32U);
 
-            // Step D5: Test the remainder.
-            // Set the result value: Set result.m_data[m - j] = q_hat.
-            // Use the condition (u[j] < 0), in other words if the borrow
-            // is non-zero, then step D6 needs to be carried out.
+      return static_cast<std::uint32_t>(static_cast<std::uint32_t>(a * w) - static_cast<std::uint32_t>(q * Prime));
+    }
 
-            if(has_borrow)
-            {
-              --q_hat;
+    template<const std::uint32_t Prime>
+    static constexpr auto ntt_shoup_of(const std::uint32_t w) -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(w) << 32U) / Prime);
+    }
 
-              // Step D6: Add back.
-              // Add v[1, ... n] back to u[j, ... j + n],
-              // and decrease the result by 1.
+    template<const std::uint32_t Prime,
+             const std::uint32_t Root,
+             typename DigitIterator>
+    static constexpr auto eval_ntt_twiddles(      DigitIterator w_fwd,
+                                                  DigitIterator w_fwd_shoup,
+                                                  DigitIterator w_inv,
+                                                  DigitIterator w_inv_shoup,
+                                            const size_t        transform_size) -> void
+    {
+      // Build the tables of the twiddle factors and their Shoup constants.
+      // The twiddle factors of the stage with butterflies of half-length h
+      // are stored contiguously at the indices h, ..., 2h - 1, so that the
+      // transforms read them sequentially.
+      const auto omega       = ntt_pow_mod<Prime>(Root, static_cast<std::uint32_t>((Prime - 1U) / transform_size));
+      const auto omega_shoup = ntt_shoup_of<Prime>(omega);
 
-              static_cast<void>
-              (
-                eval_add_n(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(uj - n)),
-                           detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                           vv.cbegin(),
-                           static_cast<unsigned_fast_type>(n))
-              );
-            }
-          }
+      const auto half = static_cast<size_t>(transform_size / 2U);
 
-          // Get the result data.
-          *values_at_m_minus_j_it = static_cast<limb_type>(q_hat);
+      auto omega_pow = static_cast<std::uint32_t>(UINT8_C(1));
 
-          if(j < m)
-          {
-            --values_at_m_minus_j_it;
-          }
-        }
+      for(auto j = static_cast<size_t>(UINT8_C(0)); j < half; ++j)
+      {
+        *detail::advance_and_point(w_fwd,       static_cast<size_t>(half + j)) = omega_pow;
+        *detail::advance_and_point(w_fwd_shoup, static_cast<size_t>(half + j)) = ntt_shoup_of<Prime>(omega_pow);
 
-        // Clear the data elements that have not
-        // been computed in the division algorithm.
-        {
-          const auto m_plus_one =
-            static_cast<local_uint_index_type>
-            (
-              static_cast<local_uint_index_type>(m) + static_cast<local_uint_index_type>(UINT8_C(1))
-            );
+        omega_pow = ntt_mul_shoup<Prime>(omega_pow, omega, omega_shoup);
 
-          detail::fill_unsafe(detail::advance_and_point(values.begin(), m_plus_one), values.end(), static_cast<limb_type>(UINT8_C(0)));
-        }
+        omega_pow = static_cast<std::uint32_t>((omega_pow >= Prime) ? static_cast<std::uint32_t>(omega_pow - Prime) : omega_pow);
+      }
 
-        if(remainder != nullptr)
+      // The inverse twiddle factors are omega^-j = Prime - omega^(half - j).
+      // The Shoup constant of Prime - w is the bitwise complement of the one
+      // of w, since w * 2^32 is never divisible by Prime.
+      *detail::advance_and_point(w_inv,       half) = *detail::advance_and_point(w_fwd,       half);
+      *detail::advance_and_point(w_inv_shoup, half) = *detail::advance_and_point(w_fwd_shoup, half);
+
+      for(auto j = static_cast<size_t>(UINT8_C(1)); j < half; ++j)
+      {
+        const auto index_fwd = static_cast<size_t>(static_cast<size_t>(half * 2U) - j);
+
+        *detail::advance_and_point(w_inv,       static_cast<size_t>(half + j)) = static_cast<std::uint32_t>(Prime - *detail::advance_and_point(w_fwd, index_fwd));
+        *detail::advance_and_point(w_inv_shoup, static_cast<size_t>(half + j)) = static_cast<std::uint32_t>(~*detail::advance_and_point(w_fwd_shoup, index_fwd));
+      }
+
+      for(auto h = static_cast<size_t>(half / 2U); h > static_cast<size_t>(UINT8_C(0)); h /= 2U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto j = static_cast<size_t>(UINT8_C(0)); j < h; ++j)
         {
-          auto rl_it_fwd = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-            detail::advance_and_point(remainder->values.begin(), static_cast<signed_fast_type>(n));
+          const auto index_from = static_cast<size_t>(static_cast<size_t>(h * 2U) + static_cast<size_t>(j * 2U));
 
-          if(d == static_cast<limb_type>(UINT8_C(1)))
-          {
-            detail::copy_unsafe(uu.cbegin(),
-                                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset))),
-                                remainder->values.begin());
-          }
-          else
-          {
-            auto previous_u = static_cast<limb_type>(UINT8_C(0));
+          *detail::advance_and_point(w_fwd,       static_cast<size_t>(h + j)) = *detail::advance_and_point(w_fwd,       index_from);
+          *detail::advance_and_point(w_fwd_shoup, static_cast<size_t>(h + j)) = *detail::advance_and_point(w_fwd_shoup, index_from);
+          *detail::advance_and_point(w_inv,       static_cast<size_t>(h + j)) = *detail::advance_and_point(w_inv,       index_from);
+          *detail::advance_and_point(w_inv_shoup, static_cast<size_t>(h + j)) = *detail::advance_and_point(w_inv_shoup, index_from);
+        }
+      }
+    }
 
-            auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+    template<const std::uint32_t Prime,
+             typename DigitIterator>
+    static constexpr auto eval_ntt_forward(      DigitIterator x,
+                                           const DigitIterator d,
+                                           const size_t        digit_count,
+                                           const size_t        transform_size,
+                                           const DigitIterator w,
+                                           const DigitIterator w_shoup) -> void
+    {
+      // The forward transform of the digits d with decimation in frequency.
+      // The result is left in bit-reversed order and lazily reduced to the
+      // range [0, 2 * Prime).
+      constexpr auto prime_x2 = static_cast<std::uint32_t>(Prime * 2U);
 
-            auto ul =
-              static_cast<signed_fast_type>
-              (
-                static_cast<size_t>
-                (
-                    number_of_limbs
-                  - static_cast<size_t>(v_offset + static_cast<size_t>(UINT8_C(1)))
-                )
-              );
+      // The first stage only has digits in its lower half,
+      // since the upper half is zero-padded.
+      const auto half = static_cast<size_t>(transform_size / 2U);
 
-            for( ; rl_it_rev != remainder->values.rend(); ++rl_it_rev, --ul) // NOLINT(altera-id-dependent-backward-branch)
-            {
-              const auto t =
-                static_cast<double_limb_type>
-                (
-                    *(uu.cbegin() + static_cast<size_t>(ul))
-                  + static_cast<double_limb_type>
-                    (
-                      static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-                    )
-                );
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < half; ++i)
+      {
+        const auto x_lo = static_cast<std::uint32_t>((i < digit_count) ? static_cast<std::uint32_t>(*detail::advance_and_point(d, i) % Prime) : static_cast<std::uint32_t>(UINT8_C(0)));
 
-              *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t / d));
-              previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
-            }
-          }
+        *detail::advance_and_point(x, i) = x_lo;
 
-          detail::fill_unsafe(rl_it_fwd, remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+        *detail::advance_and_point(x, static_cast<size_t>(half + i)) =
+          ntt_mul_shoup<Prime>(x_lo, *detail::advance_and_point(w, static_cast<size_t>(half + i)), *detail::advance_and_point(w_shoup, static_cast<size_t>(half + i)));
+      }
+
+      for(auto h = static_cast<size_t>(half / 2U); h > static_cast<size_t>(UINT8_C(0)); h /= 2U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto s = static_cast<size_t>(UINT8_C(0)); s < transform_size; s += static_cast<size_t>(h * 2U))
+        {
+          DigitIterator px_lo = detail::advance_and_point(x, s);
+          DigitIterator px_hi = detail::advance_and_point(x, static_cast<size_t>(s + h));
+          DigitIterator pw    = detail::advance_and_point(w,       h);
+          DigitIterator pws   = detail::advance_and_point(w_shoup, h);
+
+          for(auto j = static_cast<size_t>(UINT8_C(0)); j < h; ++j)
+          {
+            const auto x_lo = *px_lo;
+            const auto x_hi = *px_hi;
+
+            const auto x_sum = static_cast<std::uint32_t>(x_lo + x_hi);
+
+            *px_lo++ = static_cast<std::uint32_t>((x_sum >= prime_x2) ? static_cast<std::uint32_t>(x_sum - prime_x2) : x_sum);
+            *px_hi++ = ntt_mul_shoup<Prime>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(x_lo + prime_x2) - x_hi), *pw++, *pws++);
+          }
         }
       }
     }
 
-    template<const size_t RePhraseWidth2 = Width2>
-    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset,
-                                          const unsigned_fast_type v_offset,
-                                          const uintwide_t& other,
-                                                uintwide_t* remainder,
-                                          std::enable_if_t<(RePhraseWidth2 <= static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    template<const std::uint32_t Prime,
+             typename DigitIterator>
+    static constexpr auto eval_ntt_inverse(      DigitIterator x,
+                                           const size_t        transform_size,
+                                           const DigitIterator w,
+                                           const DigitIterator w_shoup) -> void
     {
-      static_cast<void>(p_nullparam);
+      // The inverse transform (without scaling) with decimation in time.
+      // It starts from bit-reversed order. The values are lazily reduced
+      // to the range [0, 4 * Prime) and finally reduced to [0, Prime).
+      constexpr auto prime_x2 = static_cast<std::uint32_t>(Prime * 2U);
 
-      static_cast<void>(v_offset);
+      for(auto h = static_cast<size_t>(UINT8_C(1)); h < transform_size; h *= 2U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto s = static_cast<size_t>(UINT8_C(0)); s < transform_size; s += static_cast<size_t>(h * 2U))
+        {
+          DigitIterator px_lo = detail::advance_and_point(x, s);
+          DigitIterator px_hi = detail::advance_and_point(x, static_cast<size_t>(s + h));
+          DigitIterator pw    = detail::advance_and_point(w,       h);
+          DigitIterator pws   = detail::advance_and_point(w_shoup, h);
 
-      // The denominator has one single limb.
-      // Use a one-dimensional division algorithm.
-      const auto short_denominator = static_cast<limb_type>(*other.values.cbegin());
+          for(auto j = static_cast<size_t>(UINT8_C(0)); j < h; ++j)
+          {
+            const auto u = static_cast<std::uint32_t>((*px_lo >= prime_x2) ? static_cast<std::uint32_t>(*px_lo - prime_x2) : *px_lo);
+            const auto v = ntt_mul_shoup<Prime>(*px_hi, *pw++, *pws++);
 
-      eval_divide_by_single_limb(short_denominator, u_offset, remainder);
-    }
+            *px_lo++ = static_cast<std::uint32_t>(u + v);
+            *px_hi++ = static_cast<std::uint32_t>(static_cast<std::uint32_t>(u + prime_x2) - v);
+          }
+        }
+      }
 
-    template<typename IntegralType>
-    static constexpr auto exceeds_width(IntegralType n) -> bool
-    {
-      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
-    }
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < transform_size; ++i)
+      {
+        auto xi = *detail::advance_and_point(x, i);
 
-    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
-    {
-      return
-        static_cast<limb_type>
-        (
-          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
-                           : (std::numeric_limits<limb_type>::max)()
-        );
+        xi = static_cast<std::uint32_t>((xi >= prime_x2) ? static_cast<std::uint32_t>(xi - prime_x2) : xi);
+        xi = static_cast<std::uint32_t>((xi >= Prime)    ? static_cast<std::uint32_t>(xi - Prime)    : xi);
+
+        *detail::advance_and_point(x, i) = xi;
+      }
     }
 
-    template<typename IntegralType>
-    constexpr auto shl(IntegralType n) -> void
+    template<const std::uint32_t Prime,
+             const std::uint32_t Root,
+             typename DigitIterator>
+    static constexpr auto eval_ntt_convolve(      DigitIterator x,
+                                                  DigitIterator y,
+                                            const DigitIterator da,
+                                            const DigitIterator db,
+                                            const size_t        digit_count,
+                                            const size_t        transform_size,
+                                                  DigitIterator w,
+                                            const bool          is_square) -> void
     {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
+      // Compute the cyclic convolution of the digits of a and b modulo Prime
+      // and store it in x. The array y is used for the transform of b.
+      // The array w holds the tables of the twiddle factors (and their Shoup
+      // constants) for the forward and the inverse transforms.
 
-      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+      // The forward transform uses decimation in frequency and leaves its
+      // result in bit-reversed order. The inverse transform uses decimation
+      // in time and starts from bit-reversed order. So no bit-reversal
+      // permutation is needed.
 
-      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
-      {
-        detail::copy_backward_unsafe(values.cbegin(),
-                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
-                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+      // The butterflies use the lazy reduction of D. Harvey, "Faster
+      // arithmetic for number-theoretic transforms", J. Symb. Comp. 60
+      // (2014). The values remain less than 4 * Prime, which is less
+      // than 2^32 for all three primes.
 
-        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
+      DigitIterator w_fwd       = w;
+      DigitIterator w_fwd_shoup = detail::advance_and_point(w, static_cast<size_t>(transform_size * 1U));
+      DigitIterator w_inv       = detail::advance_and_point(w, static_cast<size_t>(transform_size * 2U));
+      DigitIterator w_inv_shoup = detail::advance_and_point(w, static_cast<size_t>(transform_size * 3U));
+
+      eval_ntt_twiddles<Prime, Root>(w_fwd, w_fwd_shoup, w_inv, w_inv_shoup, transform_size);
+
+      eval_ntt_forward<Prime>(x, da, digit_count, transform_size, w_fwd, w_fwd_shoup);
+
+      // A square needs only one forward transform.
+      DigitIterator y_or_x = (is_square ? x : y);
+
+      if(!is_square)
+      {
+        eval_ntt_forward<Prime>(y, db, digit_count, transform_size, w_fwd, w_fwd_shoup);
       }
 
-      using local_integral_type = unsigned_fast_type;
+      // Multiply pointwise and include the scaling of the inverse transform.
+      const auto transform_size_inv       = ntt_pow_mod<Prime>(static_cast<std::uint32_t>(transform_size), static_cast<std::uint32_t>(Prime - 2U));
+      const auto transform_size_inv_shoup = ntt_shoup_of<Prime>(transform_size_inv);
 
-      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < transform_size; ++i)
       {
-        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+        *detail::advance_and_point(x, i) =
+          ntt_mul_shoup<Prime>(ntt_mul_mod<Prime>(*detail::advance_and_point(x, i), *detail::advance_and_point(y_or_x, i)), transform_size_inv, transform_size_inv_shoup);
+      }
 
-        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      eval_ntt_inverse<Prime>(x, transform_size, w_inv, w_inv_shoup);
+    }
 
-        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DigitIterator>
+    static constexpr auto eval_multiply_ntt_n_by_n(      ResultIterator     r,
+                                                   const InputIteratorLeft  a,
+                                                   const InputIteratorRight b,
+                                                   const unsigned_fast_type count,
+                                                   const unsigned_fast_type count_r,
+                                                         DigitIterator      t) -> void
+    {
+      // Multiply with the number-theoretic transform. The operands are
+      // split into 32-bit digits. The convolution of the digits is computed
+      // modulo three primes and the coefficients are recovered with Garner's
+      // algorithm (Chinese remainder theorem) before propagating the carries.
+      // The lowest count_r limbs of the n*n->2n product are retained, where
+      // count_r is either n or 2n. The temporary storage t needs nine times
+      // the transform size in 32-bit digits.
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      using left_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
+      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
+
+      constexpr auto local_limb_digits = static_cast<size_t>(std::numeric_limits<local_limb_type>::digits);
+
+      const auto digit_count    = static_cast<size_t>(static_cast<size_t>(count   * local_limb_digits) / 32U);
+      const auto digit_count_r  = static_cast<size_t>(static_cast<size_t>(count_r * local_limb_digits) / 32U);
+      const auto transform_size = ntt_transform_size(digit_count);
+
+      DigitIterator da = t;
+      DigitIterator db = detail::advance_and_point(t, static_cast<size_t>(transform_size / 2U));
+      DigitIterator x0 = detail::advance_and_point(t, static_cast<size_t>(transform_size * 1U));
+      DigitIterator x1 = detail::advance_and_point(t, static_cast<size_t>(transform_size * 2U));
+      DigitIterator x2 = detail::advance_and_point(t, static_cast<size_t>(transform_size * 3U));
+      DigitIterator y  = detail::advance_and_point(t, static_cast<size_t>(transform_size * 4U));
+      DigitIterator w  = detail::advance_and_point(t, static_cast<size_t>(transform_size * 5U));
+
+      // Split the limbs of a and b into 32-bit digits.
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < digit_count; ++i)
+      {
+        auto digit_a = static_cast<std::uint64_t>(UINT8_C(0));
+        auto digit_b = static_cast<std::uint64_t>(UINT8_C(0));
+
+        if(local_limb_digits <= static_cast<size_t>(UINT8_C(32)))
         {
-          const auto t = *ai;
+          const auto limbs_per_digit = static_cast<size_t>(static_cast<size_t>(UINT8_C(32)) / local_limb_digits);
 
-          *ai++ =
-            static_cast<limb_type>
-            (
-                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
-              | part_from_previous_value
-            );
+          for(auto j = static_cast<size_t>(UINT8_C(0)); j < limbs_per_digit; ++j)
+          {
+            const auto index = static_cast<size_t>(static_cast<size_t>(i * limbs_per_digit) + j);
 
-          const auto right_shift_previous_value =
-            static_cast<local_integral_type>
-            (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(left_shift_amount)
-              )
-            );
+            digit_a |= static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(a, static_cast<left_difference_type>(index)))  << static_cast<unsigned>(j * local_limb_digits));
+            digit_b |= static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(b, static_cast<right_difference_type>(index))) << static_cast<unsigned>(j * local_limb_digits));
+          }
+        }
+        else
+        {
+          const auto shift = static_cast<unsigned>(static_cast<unsigned>(i % 2U) * 32U);
 
-          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
+          digit_a = static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(a, static_cast<left_difference_type>(i / 2U)))  >> shift);
+          digit_b = static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(b, static_cast<right_difference_type>(i / 2U))) >> shift);
         }
+
+        *detail::advance_and_point(da, i) = static_cast<std::uint32_t>(digit_a);
+        *detail::advance_and_point(db, i) = static_cast<std::uint32_t>(digit_b);
       }
-    }
 
-    template<typename IntegralType>
-    constexpr auto shr(IntegralType n) -> void
-    {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
+      const auto is_square = (compare_ranges(da, db, static_cast<unsigned_fast_type>(digit_count)) == static_cast<std::int_fast8_t>(INT8_C(0)));
 
-      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+      eval_ntt_convolve<ntt_prime_0, ntt_root_0>(x0, y, da, db, digit_count, transform_size, w, is_square);
+      eval_ntt_convolve<ntt_prime_1, ntt_root_1>(x1, y, da, db, digit_count, transform_size, w, is_square);
+      eval_ntt_convolve<ntt_prime_2, ntt_root_2>(x2, y, da, db, digit_count, transform_size, w, is_square);
 
-      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
-      {
-        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
-                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
-                            values.begin());
+      // Recover the coefficients with Garner's algorithm and propagate
+      // the carries. A coefficient is less than digit_count * 2^64 and
+      // the carry is less than 2^58. The digits of the result overwrite
+      // the digits of a and b, which are no longer needed.
+      constexpr auto p01     = static_cast<std::uint64_t>(static_cast<std::uint64_t>(ntt_prime_0) * ntt_prime_1);
+      constexpr auto p01_lo  = static_cast<std::uint32_t>(p01);
+      constexpr auto p01_hi  = static_cast<std::uint32_t>(p01 >> 32U);
 
-        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
-                            values.end(),
-                            right_shift_fill_value());
-      }
+      const auto inv_p0_mod_p1  = ntt_pow_mod<ntt_prime_1>(static_cast<std::uint32_t>(ntt_prime_0 % ntt_prime_1), static_cast<std::uint32_t>(ntt_prime_1 - 2U));
+      const auto inv_p01_mod_p2 = ntt_pow_mod<ntt_prime_2>(static_cast<std::uint32_t>(p01 % ntt_prime_2), static_cast<std::uint32_t>(ntt_prime_2 - 2U));
 
-      using local_integral_type = unsigned_fast_type;
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
 
-      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < digit_count_r; ++i)
       {
-        auto part_from_previous_value =
-          static_cast<limb_type>
-          (
-            (!is_neg(*this))
-              ? static_cast<limb_type>(UINT8_C(0))
-              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
-          );
+        const auto r0 = *detail::advance_and_point(x0, i);
+        const auto r1 = *detail::advance_and_point(x1, i);
+        const auto r2 = *detail::advance_and_point(x2, i);
 
-        auto r_ai =
-          static_cast<reverse_iterator>
-          (
-            detail::advance_and_point
-            (
-              values.begin(),
-              static_cast<signed_fast_type>
-              (
-                static_cast<unsigned_fast_type>(number_of_limbs) - offset
-              )
-            )
-          );
+        const auto t1 = ntt_mul_mod<ntt_prime_1>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(r1 + ntt_prime_1) - static_cast<std::uint32_t>(r0 % ntt_prime_1)) % ntt_prime_1, inv_p0_mod_p1);
 
-        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          const auto t = *r_ai;
+        const auto x01 = static_cast<std::uint64_t>(r0 + static_cast<std::uint64_t>(static_cast<std::uint64_t>(ntt_prime_0) * t1));
 
-          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+        const auto t2 = ntt_mul_mod<ntt_prime_2>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(r2 + ntt_prime_2) - static_cast<std::uint32_t>(x01 % ntt_prime_2)) % ntt_prime_2, inv_p01_mod_p2);
 
-          const auto left_shift_previous_value =
-            static_cast<local_integral_type>
+        // The coefficient is x01 + p01 * t2.
+        const auto sum_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(p01_lo) * t2) + x01 + carry);
+
+        *detail::advance_and_point(da, i) = static_cast<std::uint32_t>(sum_lo);
+
+        carry = static_cast<std::uint64_t>(static_cast<std::uint64_t>(sum_lo >> 32U) + static_cast<std::uint64_t>(static_cast<std::uint64_t>(p01_hi) * t2));
+      }
+
+      // Pack the 32-bit digits of the result into limbs.
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < static_cast<size_t>(count_r); ++i)
+      {
+        local_limb_type limb { };
+
+        if(local_limb_digits <= static_cast<size_t>(UINT8_C(32)))
+        {
+          const auto bit_index = static_cast<size_t>(i * local_limb_digits);
+
+          limb = static_cast<local_limb_type>(*detail::advance_and_point(da, static_cast<size_t>(bit_index / 32U)) >> static_cast<unsigned>(bit_index % 32U));
+        }
+        else
+        {
+          limb =
+            static_cast<local_limb_type>
             (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(right_shift_amount)
-              )
+                static_cast<std::uint64_t>(*detail::advance_and_point(da, static_cast<size_t>(i * 2U)))
+              | static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(da, static_cast<size_t>(static_cast<size_t>(i * 2U) + 1U))) << 32U)
             );
-
-          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
         }
+
+        *detail::advance_and_point(r, static_cast<result_difference_type>(i)) = limb;
       }
     }
 
-    // Read string function.
-    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    constexpr auto eval_divide(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
     {
-      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+      // Select Knuth's long division or the division with a Newton reciprocal.
+      eval_divide(other, remainder, std::integral_constant<bool, (number_of_limbs >= number_of_limbs_newton_division_threshold)>());
+    }
 
-      const auto str_length =
-        static_cast<unsigned_fast_type>
-        (
-          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
-        );
+    constexpr auto eval_divide(const uintwide_t& other, uintwide_t* remainder, const std::false_type&) -> void
+    {
+      eval_divide_knuth(other, remainder);
+    }
 
-      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
+    constexpr auto eval_divide(const uintwide_t& other, uintwide_t* remainder, const std::true_type&) -> void
+    {
+      // The cost of the long division is proportional to the product of the
+      // lengths of the quotient and of the divisor, whereas the division with
+      // the reciprocal needs a fixed number of full-width multiplications.
+      // So the long division remains faster for short divisors and quotients.
+      const auto u_len = significant_limb_count(values);
+      const auto v_len = significant_limb_count(other.values);
 
-      // Detect: Is there a plus sign?
-      // And if there is a plus sign, skip over the plus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto division_with_reciprocal_is_faster =
+        (   (v_len != static_cast<unsigned_fast_type>(UINT8_C(0)))
+         && (u_len >= v_len)
+         && (static_cast<size_t>(static_cast<size_t>(static_cast<size_t>(u_len - v_len) + 1U) * static_cast<size_t>(v_len * 4U)) >= static_cast<size_t>(number_of_limbs * number_of_limbs)));
+
+      if(division_with_reciprocal_is_faster)
       {
-        ++pos;
+        eval_divide_newton(other, remainder);
       }
-
-      auto str_has_neg_sign = false;
-
-      // Detect: Is there a minus sign?
-      // And if there is a minus sign, skip over the minus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      else
       {
-        str_has_neg_sign = true;
-
-        ++pos;
+        eval_divide_knuth(other, remainder);
       }
+    }
 
-      // Set the base if the client has supplied a non-zero base-hint.
-      auto base = static_cast<std::uint_fast8_t>(base_hint);
+    static constexpr auto significant_limb_count(const representation_type& rep) -> unsigned_fast_type
+    {
+      auto count = static_cast<unsigned_fast_type>(number_of_limbs);
 
-      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      auto crit = rep.crbegin();
+
+      while((count != static_cast<unsigned_fast_type>(UINT8_C(0))) && (*crit == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+        ++crit;
+        --count;
+      }
 
-        // Perform a dynamic detection of the base.
-        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
-        {
-          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-          if(might_be_oct_or_hex)
-          {
-            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is octal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
-
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
-            }
-            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is hexadecimal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+      return count;
+    }
 
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
-            }
-          }
-          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          {
-            // The input format is decimal.
-            ;
-          }
-        }
-      }
+    // Get the upper limb of the limb pair (hi, lo) shifted left by less than one limb.
+    static constexpr auto shift_limb_pair_left(const limb_type hi, const limb_type lo, const unsigned shift) -> limb_type
+    {
+      return
+        static_cast<limb_type>
+        (
+          (shift == static_cast<unsigned>(UINT8_C(0)))
+            ? hi
+            : static_cast<limb_type>(static_cast<limb_type>(hi << shift) | static_cast<limb_type>(lo >> static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<limb_type>::digits) - shift)))
+        );
+    }
 
-      auto char_is_valid = true;
+    static constexpr auto eval_mulmod_by_limb(const uintwide_t& a, const limb_type v, const uintwide_t& m) -> uintwide_t
+    {
+      // Calculate (a * v) % m for a in the range [0, m) and a single limb v.
+      // The product has at most one limb more than m, so that the quotient
+      // is a single limb. It is estimated from the normalized leading limbs
+      // of the product and of the modulus, which overestimates the quotient
+      // by at most two (Theorem B in Sect. 4.3.1 of D. E. Knuth, "The Art of
+      // Computer Programming", Vol. 2). Then m is added back at most twice.
 
-      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
 
-        const auto char_is_apostrophe = (c == static_cast<char>(39));
+      const auto m_len = significant_limb_count(m.values);
 
-        if(!char_is_apostrophe)
-        {
-          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '8'));
+      using local_product_array_type = detail::array_detail::array<limb_type, static_cast<std::size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1)))>;
 
-            if(char_is_valid)
-            {
-              const auto uc_oct = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+      local_product_array_type r { };
+      local_product_array_type t { };
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+      r[static_cast<std::size_t>(m_len)] = eval_multiply_1d(r.begin(), a.values.cbegin(), v, m_len);
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '9'));
+      const auto m_top  = *detail::advance_and_point(m.values.cbegin(), static_cast<size_t>(m_len - 1U));
+      const auto m_next = ((m_len > static_cast<unsigned_fast_type>(UINT8_C(1))) ? *detail::advance_and_point(m.values.cbegin(), static_cast<size_t>(m_len - 2U)) : static_cast<limb_type>(UINT8_C(0)));
+      const auto r_top  = r[static_cast<std::size_t>(m_len)];
+      const auto r_mid  = r[static_cast<std::size_t>(m_len - 1U)];
+      const auto r_next = ((m_len > static_cast<unsigned_fast_type>(UINT8_C(1))) ? r[static_cast<std::size_t>(m_len - 2U)] : static_cast<limb_type>(UINT8_C(0)));
 
-            if(char_is_valid)
-            {
-              const auto uc_dec = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+      const auto shift = static_cast<unsigned>(static_cast<unsigned>(limb_digits - 1U) - static_cast<unsigned>(detail::msb_helper(m_top)));
 
-              static_cast<void>(mul_by_limb(static_cast<limb_type>(UINT8_C(10))));
+      const auto r_hi =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(shift_limb_pair_left(r_top, r_mid, shift)) << limb_digits)
+          | static_cast<double_limb_type>(shift_limb_pair_left(r_mid, r_next, shift))
+        );
 
-              static_cast<void>(operator+=(uc_dec));
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
-          {
-            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
-            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
-            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+      const auto q_hat =
+        static_cast<limb_type>
+        (
+          (std::min)
+          (
+            static_cast<double_limb_type>(r_hi / static_cast<double_limb_type>(shift_limb_pair_left(m_top, m_next, shift))),
+            static_cast<double_limb_type>((std::numeric_limits<limb_type>::max)())
+          )
+        );
 
-            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+      t[static_cast<std::size_t>(m_len)] = eval_multiply_1d(t.begin(), m.values.cbegin(), q_hat, m_len);
 
-            if(char_is_valid)
-            {
-              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+      auto has_borrow = eval_subtract_n(r.begin(), r.cbegin(), t.cbegin(), static_cast<unsigned_fast_type>(m_len + 1U));
 
-              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
-              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
-              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+      while(has_borrow) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto carry = eval_add_n(r.begin(), r.cbegin(), m.values.cbegin(), m_len);
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+        r[static_cast<std::size_t>(m_len)] = static_cast<limb_type>(r[static_cast<std::size_t>(m_len)] + carry);
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
-            }
-          }
-        }
+        has_borrow = ((carry == static_cast<limb_type>(UINT8_C(0))) || (r[static_cast<std::size_t>(m_len)] != static_cast<limb_type>(UINT8_C(0))));
       }
 
-      if(str_has_neg_sign)
-      {
-        // Exclude this line from code coverage, even though explicit
-        // test cases (search for "result_overshift_is_ok") are known
-        // to cover this line.
-        negate(); // LCOV_EXCL_LINE
-      }
+      uintwide_t result { };
 
-      return char_is_valid;
+      detail::copy_unsafe(r.cbegin(), detail::advance_and_point(r.cbegin(), m_len), result.values.begin());
+
+      return result;
     }
 
-    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
+    constexpr auto eval_divide_newton(const uintwide_t& other, uintwide_t* remainder) -> void
     {
-      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      // Divide by multiplying with the reciprocal of the divisor, which is
+      // calculated with Newton iteration. The divisor must not be zero and
+      // both values must not be negative.
+
+      // See also Algorithms 3.5 and 3.6 (approximate reciprocal, Barrett's
+      // algorithm) in R. P. Brent and P. Zimmermann, "Modern Computer
+      // Arithmetic", Cambridge University Press (2010).
+
+      using local_unsigned_wide_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+      using local_unsigned_double_wide_type = typename local_unsigned_wide_type::double_width_type;
+
+      // Normalize the divisor, such that its most significant bit is set.
+      const auto shift = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(Width2 - 1U) - msb(other));
+
+      local_unsigned_wide_type d(other);
+
+      d <<= shift;
+
+      const local_unsigned_wide_type d_rec(local_unsigned_wide_type::eval_reciprocal_newton(d));
+
+      local_unsigned_double_wide_type x(local_unsigned_wide_type(*this));
+
+      x <<= shift;
+
+      local_unsigned_wide_type q { };
+
+      local_unsigned_wide_type::eval_divide_by_reciprocal(x, d, d_rec, q);
+
+      values = q.values;
+
+      if(remainder != nullptr)
       {
-        *it = static_cast<limb_type>(~(*it));
+        x >>= shift;
+
+        remainder->values = local_unsigned_wide_type(x).values;
       }
-    } // LCOV_EXCL_LINE
+    }
 
-    constexpr auto preincrement() -> void
+    static constexpr auto eval_divide_by_reciprocal(      double_width_type& x,
+                                                    const uintwide_t&        d,
+                                                    const uintwide_t&        d_rec,
+                                                          uintwide_t&        q) -> void
     {
-      // Implement self-increment.
+      // Divide x < (d * 2^Width2) by d having its most significant bit set.
+      // The reciprocal is d_rec = ((2^((2 * Width2) - 1)) - 1) / d. The upper
+      // half of x times the reciprocal underestimates the quotient q by at
+      // most 6, which is corrected with subtractions. The remainder is left
+      // in x. This is only used for unsigned types.
+      q = uintwide_t(mul_to_double_width(uintwide_t(x >> Width2), d_rec) >> static_cast<size_t>(Width2 - 1U));
 
-      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto) // LCOV_EXCL_LINE
+      x -= mul_to_double_width(q, d);
 
-      do
+      const double_width_type d_dbl(d);
+
+      while(x >= d_dbl) // NOLINT(altera-id-dependent-backward-branch)
       {
-        ++(*it);
+        x -= d_dbl;
+
+        ++q;
       }
-      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
     }
 
-    constexpr auto predecrement() -> void
+    static constexpr auto eval_reciprocal_newton(const uintwide_t& d) -> uintwide_t
     {
-      // Implement self-decrement.
+      // Calculate the reciprocal ((2^((2 * Width2) - 1)) - 1) / d of d having
+      // its most significant bit set. The result lies in the range
+      // [2^(Width2 - 1) - 1, 2^Width2 - 1]. When the half width still uses
+      // Karatsuba multiplication, the reciprocal of the upper half of d is
+      // calculated recursively and refined with one Newton step at the full
+      // width. Otherwise the long division is faster. This is only used for
+      // unsigned types.
+      constexpr auto half_width = static_cast<size_t>(Width2 / 2U);
 
-      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      return eval_reciprocal_newton(d, std::integral_constant<bool, (   (number_of_limbs >= static_cast<size_t>(number_of_limbs_karatsuba_threshold * 2U))
+                                                                     && (half_width >= static_cast<size_t>(UINT8_C(16)))
+                                                                     && (static_cast<size_t>(half_width % static_cast<size_t>(std::numeric_limits<limb_type>::digits)) == static_cast<size_t>(UINT8_C(0))))>());
+    }
 
-      do
-      {
-        --(*it);
-      }
-      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    static constexpr auto eval_reciprocal_newton(const uintwide_t& d, const std::false_type&) -> uintwide_t
+    {
+      // Use the long division at the end of the recursion.
+      double_width_type x(static_cast<std::uint8_t>(UINT8_C(1)));
+
+      x <<= static_cast<size_t>(static_cast<size_t>(Width2 * 2U) - 1U);
+
+      --x;
+
+      x.eval_divide_knuth(double_width_type(d));
+
+      return uintwide_t(x);
     }
-  };
 
-  // Define some convenient unsigned wide integer types.
-  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t>;
-  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t>;
-  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t>;
-  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t>;
-  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t>;
-  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t>;
-  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t>;
-  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t>;
-  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t>;
-  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t>;
-  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t>;
+    static constexpr auto eval_reciprocal_newton(const uintwide_t& d, const std::true_type&) -> uintwide_t
+    {
+      constexpr auto half_width = static_cast<size_t>(Width2 / 2U);
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+      using half_width_type = uintwide_t<half_width, LimbType, AllocatorType, false>;
 
-  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+      // The scaled reciprocal x = x_half * 2^half_width of the upper half
+      // of d differs from the reciprocal of d by less than 2^(half_width + 2).
+      const half_width_type x_half(half_width_type::eval_reciprocal_newton(half_width_type(d >> half_width)));
 
-  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t, void, true>;
-  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t, void, true>;
-  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t, void, true>;
-  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t, void, true>;
-  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t, void, true>;
-  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t, void, true>;
-  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t, void, true>;
-  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t, void, true>;
-  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t, void, true>;
-  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t, void, true>;
-  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t, void, true>;
+      uintwide_t x(x_half);
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+      x <<= half_width;
 
-  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+      double_width_type b(static_cast<std::uint8_t>(UINT8_C(1)));
 
-  // Insert a base class for numeric_limits<> support.
-  // This class inherits from std::numeric_limits<unsigned int>
-  // in order to provide limits for a non-specific unsigned type.
+      b <<= static_cast<size_t>(static_cast<size_t>(Width2 * 2U) - 1U);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
-    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
-  {
-  private:
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      // One Newton step x = x + ((x * (b - (d * x))) / b) squares the
+      // relative error. The difference e = |b - (d * x)| is less than
+      // 2^((3 * half_width) + 2). So the correction (x * e) / b can be
+      // calculated at half width from the upper half of e, with an
+      // error of less than 8.
+      double_width_type dx(mul_to_double_width(d, x));
 
-  public:
-    static constexpr int digits          = (!IsSigned)
-                                             ? static_cast<int>(local_wide_integer_type::my_width2)
-                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+      const auto x_is_too_large = (dx >= b);
 
-    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
-    static constexpr int max_digits10    = digits10;
-    static constexpr int max_exponent    = digits;
-    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+      const half_width_type e_half((x_is_too_large ? double_width_type(dx - b) : double_width_type(b - dx)) >> static_cast<size_t>(Width2 + 2U));
 
-    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
-    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
-    static constexpr auto lowest() -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
-  };
+      const uintwide_t c(half_width_type::mul_to_double_width(x_half, e_half) >> static_cast<size_t>(half_width - 3U));
 
-  template<class T>
-  struct is_integral : public std::is_integral<T> { };
+      if(x_is_too_large)
+      {
+        x -= c;
+      }
+      else
+      {
+        const uintwide_t x_next(x + c);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-    : public std::integral_constant<bool, true> { };
+        // The reciprocal is at most 2^Width2 - 1.
+        x = ((x_next < x) ? limits_helper_max<false>() : x_next);
+      }
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+      // Correct the remaining error of a few units.
+      const double_width_type d_dbl(d);
 
-  WIDE_INTEGER_NAMESPACE_END
+      dx = mul_to_double_width(d, x);
 
-  namespace std
+      while(dx >= b) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        dx -= d_dbl;
+
+        --x;
+      }
+
+      dx += d_dbl;
+
+      while(dx < b) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        dx += d_dbl;
+
+        ++x;
+      }
+
+      return x;
+    }
+
+    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    {
+      // Use Knuth's long division algorithm.
+      // The loop-ordering of indices in Knuth's original
+      // algorithm has been reversed due to the data format
+      // used here. Several optimizations and combinations
+      // of logic have been carried out in the source code.
+
+      // See also:
+      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
+      // Seminumerical Algorithms", Addison-Wesley (1998),
+      // Section 4.3.1 Algorithm D and Exercise 16.
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      local_uint_index_type u_offset { };
+      local_uint_index_type v_offset { };
+
+      auto crit_u =       values.crbegin();
+      auto crit_v = other.values.crbegin();
+
+      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit_u;
+        ++u_offset;
+      }
+
+      while(crit_v != other.values.crend() && (*crit_v == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit_v;
+        ++v_offset;
+      }
+
+      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The denominator is zero. Set the maximum value and return.
+        // This also catches (0 / 0) and sets the maximum value for it.
+        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+
+        if(remainder != nullptr) // LCOV_EXCL_LINE
+        {
+          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
+        }
+      }
+      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The numerator is zero. Do nothing and return.
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+        }
+      }
+      else
+      {
+        const auto result_of_compare_left_with_right = compare(other);
+
+        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
+        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+
+        if(left_is_less_than_right)
+        {
+          // If the denominator is larger than the numerator,
+          // then the result of the division is zero.
+          if(remainder != nullptr)
+          {
+            *remainder = *this;
+          }
+
+          operator=(static_cast<std::uint8_t>(UINT8_C(0)));
+        }
+        else if(left_is_equal_to_right)
+        {
+          // If the denominator is equal to the numerator,
+          // then the result of the division is one.
+          operator=(static_cast<std::uint8_t>(UINT8_C(1)));
+
+          if(remainder != nullptr)
+          {
+            *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+          }
+        }
+        else
+        {
+          eval_divide_knuth_core(u_offset, v_offset, other, remainder);
+        }
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset, // NOLINT(readability-function-cognitive-complexity)
+                                          const unsigned_fast_type v_offset,
+                                          const uintwide_t& other,
+                                                uintwide_t* remainder,
+                                          std::enable_if_t<(RePhraseWidth2 > static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The denominator has one single limb.
+        // Use a one-dimensional division algorithm.
+        const limb_type short_denominator = *other.values.cbegin();
+
+        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+      }
+      else
+      {
+        // We will now use the Knuth long division algorithm.
+
+        // Compute the normalization factor d.
+        const auto d =
+          static_cast<limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+            / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - 1U) - v_offset))) + static_cast<limb_type>(1U))
+          );
+
+        // Step D1(b), normalize u -> u * d = uu.
+        // Step D1(c): normalize v -> v * d = vv.
+
+        using uu_array_type =
+          std::conditional_t<std::is_same<AllocatorType, void>::value,
+                             detail::fixed_static_array <limb_type, static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1)))>,
+                             detail::fixed_dynamic_array<limb_type,
+                                                         static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))),
+                                                         typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                           std::allocator<void>,
+                                                                                                           AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+        uu_array_type uu { };
+
+        representation_type
+          vv
+          {
+            static_cast<typename representation_type::size_type>(number_of_limbs),
+            static_cast<typename representation_type::value_type>(UINT8_C(0)),
+            typename representation_type::allocator_type() // LCOV_EXCL_LINE
+          };
+
+        if(d > static_cast<limb_type>(UINT8_C(1)))
+        {
+          {
+            const auto num_limbs_minus_u_ofs =
+              static_cast<size_t>
+              (
+                static_cast<local_uint_index_type>(number_of_limbs) - u_offset
+              );
+
+            const auto u_carry =
+              eval_multiply_1d
+              (
+                uu.begin(),
+                values.cbegin(),
+                d,
+                static_cast<unsigned_fast_type>(num_limbs_minus_u_ofs)
+              );
+
+            *(uu.begin() + num_limbs_minus_u_ofs) = u_carry;
+          }
+
+          static_cast<void>
+          (
+            eval_multiply_1d
+            (
+              vv.begin(),
+              other.values.cbegin(),
+              d,
+              static_cast<unsigned_fast_type>(number_of_limbs - v_offset)
+            )
+          );
+        }
+        else
+        {
+          detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
+
+          *(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset)) = static_cast<limb_type>(UINT8_C(0));
+
+          vv = other.values;
+        }
+
+        // Step D2: Initialize j.
+        // Step D7: Loop on j from m to 0.
+
+        const auto n   = static_cast<local_uint_index_type>                                   (number_of_limbs - v_offset);
+        const auto m   = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) - n);
+        const auto vj0 = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(n - static_cast<local_uint_index_type>(UINT8_C(1))));
+
+        auto vv_at_vj0_it = detail::advance_and_point(vv.cbegin(), static_cast<size_t>(vj0)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        const auto vv_at_vj0           = *vv_at_vj0_it--;
+        const auto vv_at_vj0_minus_one = *vv_at_vj0_it;
+
+        auto values_at_m_minus_j_it = detail::advance_and_point(values.begin(), static_cast<size_t>(m)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        for(auto j = static_cast<local_uint_index_type>(UINT8_C(0)); j <= m; ++j) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          // Step D3 [Calculate q_hat].
+          //   if u[j] == v[j0]
+          //     set q_hat = b - 1
+          //   else
+          //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+
+          const auto uj     = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs + 1U) - 1U) - u_offset) - j);
+          const auto u_j_j1 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*(uu.cbegin() + static_cast<size_t>(uj))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + static_cast<size_t>(uj - 1U)));
+
+          auto q_hat =
+            static_cast<limb_type>
+            (
+              (*(uu.cbegin() + static_cast<size_t>(uj)) == vv_at_vj0)
+                ? (std::numeric_limits<limb_type>::max)()
+                : static_cast<limb_type>(u_j_j1 / vv_at_vj0)
+            );
+
+          // Decrease q_hat if necessary.
+          // This means that q_hat must be decreased if the
+          // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
+          // exceeds the range of uintwide_t.
+
+          for(auto t = static_cast<double_limb_type>(u_j_j1 - static_cast<double_limb_type>(q_hat * static_cast<double_limb_type>(vv_at_vj0)));
+                     ;
+                       --q_hat, t = static_cast<double_limb_type>(t + vv_at_vj0))
+          {
+            if(   (detail::make_hi<limb_type>(t) != static_cast<limb_type>(UINT8_C(0)))
+               || (   static_cast<double_limb_type>(static_cast<double_limb_type>(vv_at_vj0_minus_one) * q_hat)
+                   <= static_cast<double_limb_type>(static_cast<double_limb_type>(t << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *detail::advance_and_point(uu.cbegin(), static_cast<size_t>(uj - 2U)))))
+            {
+              break;
+            }
+          }
+
+          {
+            // Step D4: Multiply and subtract.
+            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+
+            // Set nv = q_hat * (v[1, ... n]).
+            uu_array_type nv { };
+
+            *(nv.begin() + static_cast<size_t>(n)) = eval_multiply_1d(nv.begin(), vv.cbegin(), q_hat, n);
+
+            const auto has_borrow =
+              eval_subtract_n
+              (
+                detail::advance_and_point(uu.begin(),  static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
+                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
+                nv.cbegin(),
+                static_cast<unsigned_fast_type>
+                (
+                  static_cast<local_uint_index_type>(n + static_cast<local_uint_index_type>(UINT8_C(1)))
+                )
+              );
+
+            // Step D5: Test the remainder.
+            // Set the result value: Set result.m_data[m - j] = q_hat.
+            // Use the condition (u[j] < 0), in other words if the borrow
+            // is non-zero, then step D6 needs to be carried out.
+
+            if(has_borrow)
+            {
+              --q_hat;
+
+              // Step D6: Add back.
+              // Add v[1, ... n] back to u[j, ... j + n],
+              // and decrease the result by 1.
+
+              static_cast<void>
+              (
+                eval_add_n(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(uj - n)),
+                           detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
+                           vv.cbegin(),
+                           static_cast<unsigned_fast_type>(n))
+              );
+            }
+          }
+
+          // Get the result data.
+          *values_at_m_minus_j_it = static_cast<limb_type>(q_hat);
+
+          if(j < m)
+          {
+            --values_at_m_minus_j_it;
+          }
+        }
+
+        // Clear the data elements that have not
+        // been computed in the division algorithm.
+        {
+          const auto m_plus_one =
+            static_cast<local_uint_index_type>
+            (
+              static_cast<local_uint_index_type>(m) + static_cast<local_uint_index_type>(UINT8_C(1))
+            );
+
+          detail::fill_unsafe(detail::advance_and_point(values.begin(), m_plus_one), values.end(), static_cast<limb_type>(UINT8_C(0)));
+        }
+
+        if(remainder != nullptr)
+        {
+          auto rl_it_fwd = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+            detail::advance_and_point(remainder->values.begin(), static_cast<signed_fast_type>(n));
+
+          if(d == static_cast<limb_type>(UINT8_C(1)))
+          {
+            detail::copy_unsafe(uu.cbegin(),
+                                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset))),
+                                remainder->values.begin());
+          }
+          else
+          {
+            auto previous_u = static_cast<limb_type>(UINT8_C(0));
+
+            auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+
+            auto ul =
+              static_cast<signed_fast_type>
+              (
+                static_cast<size_t>
+                (
+                    number_of_limbs
+                  - static_cast<size_t>(v_offset + static_cast<size_t>(UINT8_C(1)))
+                )
+              );
+
+            for( ; rl_it_rev != remainder->values.rend(); ++rl_it_rev, --ul) // NOLINT(altera-id-dependent-backward-branch)
+            {
+              const auto t =
+                static_cast<double_limb_type>
+                (
+                    *(uu.cbegin() + static_cast<size_t>(ul))
+                  + static_cast<double_limb_type>
+                    (
+                      static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
+                    )
+                );
+
+              *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t / d));
+              previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
+            }
+          }
+
+          detail::fill_unsafe(rl_it_fwd, remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+        }
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset,
+                                          const unsigned_fast_type v_offset,
+                                          const uintwide_t& other,
+                                                uintwide_t* remainder,
+                                          std::enable_if_t<(RePhraseWidth2 <= static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      static_cast<void>(v_offset);
+
+      // The denominator has one single limb.
+      // Use a one-dimensional division algorithm.
+      const auto short_denominator = static_cast<limb_type>(*other.values.cbegin());
+
+      eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+    }
+
+    template<typename IntegralType>
+    static constexpr auto exceeds_width(IntegralType n) -> bool
+    {
+      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
+    {
+      return
+        static_cast<limb_type>
+        (
+          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
+                           : (std::numeric_limits<limb_type>::max)()
+        );
+    }
+
+    template<typename IntegralType>
+    constexpr auto shl(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        detail::copy_backward_unsafe(values.cbegin(),
+                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
+                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+
+        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+
+        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *ai;
+
+          *ai++ =
+            static_cast<limb_type>
+            (
+                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
+              | part_from_previous_value
+            );
+
+          const auto right_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(left_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
+        }
+      }
+    }
+
+    template<typename IntegralType>
+    constexpr auto shr(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
+                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
+                            values.begin());
+
+        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
+                            values.end(),
+                            right_shift_fill_value());
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value =
+          static_cast<limb_type>
+          (
+            (!is_neg(*this))
+              ? static_cast<limb_type>(UINT8_C(0))
+              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
+          );
+
+        auto r_ai =
+          static_cast<reverse_iterator>
+          (
+            detail::advance_and_point
+            (
+              values.begin(),
+              static_cast<signed_fast_type>
+              (
+                static_cast<unsigned_fast_type>(number_of_limbs) - offset
+              )
+            )
+          );
+
+        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *r_ai;
+
+          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+
+          const auto left_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(right_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
+        }
+      }
+    }
+
+    // Read string function.
+    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    {
+      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      const auto str_length =
+        static_cast<unsigned_fast_type>
+        (
+          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
+        );
+
+      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      // Detect: Is there a plus sign?
+      // And if there is a plus sign, skip over the plus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        ++pos;
+      }
+
+      auto str_has_neg_sign = false;
+
+      // Detect: Is there a minus sign?
+      // And if there is a minus sign, skip over the minus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        str_has_neg_sign = true;
+
+        ++pos;
+      }
+
+      // Set the base if the client has supplied a non-zero base-hint.
+      auto base = static_cast<std::uint_fast8_t>(base_hint);
+
+      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      {
+        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+
+        // Perform a dynamic detection of the base.
+        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
+        {
+          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          if(might_be_oct_or_hex)
+          {
+            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is octal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
+            }
+            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is hexadecimal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
+            }
+          }
+          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          {
+            // The input format is decimal.
+            ;
+          }
+        }
+      }
+
+      auto char_is_valid = true;
+
+      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto char_is_apostrophe = (c == static_cast<char>(39));
+
+        if(!char_is_apostrophe)
+        {
+          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+          {
+            char_is_valid = ((c >= '0') && (c <= '8'));
+
+            if(char_is_valid)
+            {
+              const auto uc_oct = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
+            }
+          }
+          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+          {
+            char_is_valid = ((c >= '0') && (c <= '9'));
+
+            if(char_is_valid)
+            {
+              const auto uc_dec = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+
+              static_cast<void>(mul_by_limb(static_cast<limb_type>(UINT8_C(10))));
+
+              static_cast<void>(operator+=(uc_dec));
+            }
+          }
+          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+          {
+            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
+            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
+            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+
+            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+
+            if(char_is_valid)
+            {
+              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+
+              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
+              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
+              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
+            }
+          }
+        }
+      }
+
+      if(str_has_neg_sign)
+      {
+        // Exclude this line from code coverage, even though explicit
+        // test cases (search for "result_overshift_is_ok") are known
+        // to cover this line.
+        negate(); // LCOV_EXCL_LINE
+      }
+
+      return char_is_valid;
+    }
+
+    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
+    {
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        *it = static_cast<limb_type>(~(*it));
+      }
+    } // LCOV_EXCL_LINE
+
+    constexpr auto preincrement() -> void
+    {
+      // Implement self-increment.
+
+      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto) // LCOV_EXCL_LINE
+
+      do
+      {
+        ++(*it);
+      }
+      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
+
+    constexpr auto predecrement() -> void
+    {
+      // Implement self-decrement.
+
+      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      do
+      {
+        --(*it);
+      }
+      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
+  };
+
+  // Define some convenient unsigned wide integer types.
+  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t>;
+  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t>;
+  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t>;
+  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t>;
+  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t>;
+  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t>;
+  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t>;
+  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t>;
+  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t>;
+  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t>;
+  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t, void, true>;
+  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t, void, true>;
+  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t, void, true>;
+  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t, void, true>;
+  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t, void, true>;
+  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t, void, true>;
+  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t, void, true>;
+  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t, void, true>;
+  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t, void, true>;
+  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t, void, true>;
+  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t, void, true>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  // Insert a base class for numeric_limits<> support.
+  // This class inherits from std::numeric_limits<unsigned int>
+  // in order to provide limits for a non-specific unsigned type.
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
+    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
+  {
+  private:
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  public:
+    static constexpr int digits          = (!IsSigned)
+                                             ? static_cast<int>(local_wide_integer_type::my_width2)
+                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+
+    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    static constexpr int max_digits10    = digits10;
+    static constexpr int max_exponent    = digits;
+    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+
+    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
+    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
+    static constexpr auto lowest() -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
+  };
+
+  template<class T>
+  struct is_integral : public std::is_integral<T> { };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+    : public std::integral_constant<bool, true> { };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  WIDE_INTEGER_NAMESPACE_END
+
+  namespace std
+  {
+    // Specialization of std::numeric_limits<uintwide_t>.
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #else
+    template<const ::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
+      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #endif
+  } // namespace std
+
+  WIDE_INTEGER_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_integer {
+  #else
+  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  // Non-member binary logic operations of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(   std::is_integral<IntegralType>::value
+                                                                                                                                       && std::is_signed<IntegralType>::value),
+                                                                                                                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
   {
-    // Specialization of std::numeric_limits<uintwide_t>.
-    #if defined(WIDE_INTEGER_NAMESPACE)
-    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #else
-    template<const ::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
-      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #endif
-  } // namespace std
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+  }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
+                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
+                                                                                                                                       && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
+                                                                                                                                       typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    const auto u_is_neg = local_wide_integer_type::is_neg(u);
+
+    local_wide_integer_type remainder;
+
+    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, static_cast<unsigned_fast_type>(UINT8_C(0)), &remainder);
+
+    using local_limb_type = typename local_wide_integer_type::limb_type;
+
+    auto u_rem = static_cast<local_limb_type>(remainder);
+
+    return ((!u_is_neg) ? u_rem : static_cast<local_limb_type>(static_cast<local_limb_type>(~u_rem) + static_cast<local_limb_type>(UINT8_C(1))));
+  }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
+                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
+                                                                                                                                       && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
+                                                                                                                                       uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+  }
+
+  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
+  #endif
+
+  // Non-member binary logic operations of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member shift functions of (uintwide_t shift IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+
+  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+
+  // Non-member comparison functions of (uintwide_t cmp IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member comparison functions of (IntegralType cmp uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
+  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+
+  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  // I/O streaming functions.
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
+                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+  {
+    std::basic_ostringstream<char_type, traits_type> ostr;
+
+    const std::ios::fmtflags my_flags = out.flags();
+
+    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
+    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
+    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+
+    auto base_rep = std::uint_fast8_t { };
+
+    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
+    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
+    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
+
+    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
+    const auto fill_char_out = static_cast<char>(out.fill());
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+    {
+      using string_storage_oct_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+    {
+      using string_storage_dec_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                          std::allocator<void>,
+                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_dec_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+    {
+      using string_storage_hex_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_hex_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+
+    return (out << ostr.str());
+  }
+
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator>>(std::basic_istream<char_type, traits_type>& in,
+                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  {
+    std::string str_in;
 
-  WIDE_INTEGER_NAMESPACE_BEGIN
+    in >> str_in;
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    x = local_wide_integer_type(str_in.c_str());
+
+    return in;
+  }
+
+  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  // Implement various number-theoretical tools.
 
   #if(__cplusplus >= 201703L)
   namespace math::wide_integer {
@@ -5566,849 +7219,1228 @@
   namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
   #endif
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+  namespace detail {
 
-  // Non-member binary logic operations of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  namespace my_own {
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
+  {
+    using local_floating_point_type = FloatingPointType;
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(   std::is_integral<IntegralType>::value
-                                                                                                                                       && std::is_signed<IntegralType>::value),
-                                                                                                                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+    const auto x_is_neg = (x < static_cast<local_floating_point_type>(0.0L));
+
+    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+
+    auto e2 = static_cast<int>(INT8_C(0));
+
+    constexpr auto two_pow32 =
+      static_cast<long double>
+      (
+        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
+      );
+
+    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      // TBD: Maybe optimize this exponent reduction
+      // with a more clever kind of binary searching.
+
+      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
+      e2 += static_cast<int>(INT32_C(32));
+    }
+
+    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+
+    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+
+      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+
+      ++e2;
+    }
+
+    if(expptr != nullptr)
+    {
+      *expptr = e2;
+    }
+
+    return ((!x_is_neg) ? f : -f);
+  }
+
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
+  {
+    using std::frexp;
+
+    return frexp(x, expptr);
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    auto x_is_finite = true;
+
+    const auto x_is_nan = (x != x);
+
+    if(x_is_nan)
+    {
+      x_is_finite = false;
+    }
+    else
+    {
+      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
+      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+
+      if(x_is_inf_pos || x_is_inf_neg)
+      {
+        x_is_finite = false;
+      }
+    }
+
+    return x_is_finite;
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
+  {
+    using std::isfinite;
+
+    return (isfinite)(x);
+  }
+  } // namespace my_own
+  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+
+  template<typename UnsignedIntegralType>
+  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+
+    // This assumes that at least one bit is set.
+    // Otherwise saturation of the index will occur.
+
+    // Naive and basic LSB search.
+    // TBD: This could be improved with a binary search
+    // on the lowest bit position of the fundamental type.
+    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
+    {
+      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
+
+      ++result;
+    }
+
+    return result;
+  }
+
+  template<typename UnsignedIntegralType>
+  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto i = signed_fast_type { };
+
+    // TBD: This could potentially be improved with a binary
+    // search for the highest bit position in the type.
+
+    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
+    {
+      const auto bit_is_set =
+      (
+        static_cast<local_unsigned_integral_type>
+        (
+          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
+        )
+        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
+      );
+
+      if(bit_is_set)
+      {
+        break;
+      }
+    }
+
+    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast32_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast16_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast8_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+  {
+    if(&x != &y)
+    {
+      detail::swap_unsafe(x, y);
+    }
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
   {
+    // Calculate the position of the least-significant bit.
+    // Use a linear search starting from the least significant limb.
+
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
 
-    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+    {
+      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+
+      if(vi != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::lsb_helper(*it)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
+              )
+          );
+
+        break;
+      }
+    }
+
+    return bpos;
   }
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
-                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
-                                                                                                                                       && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
-                                                                                                                                       typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
   {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    // Calculate the position of the most-significant bit.
+    // Use a linear search starting from the most significant limb.
 
-    const auto u_is_neg = local_wide_integer_type::is_neg(u);
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
 
-    local_wide_integer_type remainder;
+    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
+    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
 
-    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, static_cast<unsigned_fast_type>(UINT8_C(0)), &remainder);
+    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
 
-    using local_limb_type = typename local_wide_integer_type::limb_type;
+      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::msb_helper(*ri)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
+              )
+          );
 
-    auto u_rem = static_cast<local_limb_type>(remainder);
+        break;
+      }
+    }
 
-    return ((!u_is_neg) ? u_rem : static_cast<local_limb_type>(static_cast<local_limb_type>(~u_rem) + static_cast<local_limb_type>(UINT8_C(1))));
+    return bpos;
   }
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
-                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
-                                                                                                                                       && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
-                                                                                                                                       uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
   }
 
-  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square root.
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
-  #endif
+    local_wide_integer_type s;
 
-  // Non-member binary logic operations of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
 
-  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
 
-  // Non-member shift functions of (uintwide_t shift IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+      // Obtain the initial value.
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
+            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
+        );
 
-  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
 
-  // Non-member comparison functions of (uintwide_t cmp IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+      // Perform the iteration for the square root.
+      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
 
-  // Non-member comparison functions of (IntegralType cmp uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
 
-  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
-  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+        if(u >= s) { break; } // LCOV_EXCL_LINE
+      }
+    }
 
-  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+    return s;
+  }
 
-  // I/O streaming functions.
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
+  template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
-                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
   {
-    std::basic_ostringstream<char_type, traits_type> ostr;
-
-    const std::ios::fmtflags my_flags = out.flags();
-
-    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
-    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
-    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
-
-    auto base_rep = std::uint_fast8_t { };
-
-    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
-    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
-    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
-
-    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
-    const auto fill_char_out = static_cast<char>(out.fill());
+    // Calculate the cube root.
 
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
-    {
-      using string_storage_oct_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+    local_wide_integer_type s;
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+    if(local_wide_integer_type::is_neg(m))
+    {
+      s = -cbrt(-m);
+    }
+    else if(m.is_zero())
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
 
-      str_result.fill('\0');
+      // Obtain the initial value.
+      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          (msb_pos_mod_3 == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 3U)
+            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(3)) - msb_pos_mod_3)) / 3U)
+        );
 
-      static_cast<void>(ostr << str_result.data());
-    }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
-    {
-      using string_storage_dec_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                          std::allocator<void>,
-                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_dec_type str_result { };
+      // Perform the iteration for the k'th root.
+      // See Algorithm 1.14 RootInt, Sect. 1.5.2
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
 
-      str_result.fill('\0');
+      const auto three_minus_one =
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
+        );
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
 
-      static_cast<void>(ostr << str_result.data());
-    }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
-    {
-      using string_storage_hex_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+        local_wide_integer_type m_over_s_pow_3_minus_one = m;
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_hex_type str_result { };
+        for(auto   j = static_cast<unsigned_fast_type>(UINT8_C(0));
+                   j < static_cast<unsigned_fast_type>(static_cast<unsigned>(3U - 1U));
+                 ++j)
+        {
+          // Use a loop here to divide by s^(3 - 1) because
+          // without a loop, s^(3 - 1) is likely to overflow.
 
-      str_result.fill('\0');
+          m_over_s_pow_3_minus_one /= s;
+        }
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / static_cast<unsigned>(UINT8_C(3));
 
-      static_cast<void>(ostr << str_result.data());
+        if(u >= s) { break; }
+      }
     }
 
-    return (out << ostr.str());
+    return s;
   }
 
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
+  template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  auto operator>>(std::basic_istream<char_type, traits_type>& in,
-                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  constexpr auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    std::string str_in;
-
-    in >> str_in;
+    // Calculate the k'th root.
 
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-    x = local_wide_integer_type(str_in.c_str());
+    local_wide_integer_type s;
 
-    return in;
-  }
+    if(k < static_cast<std::uint_fast8_t>(UINT8_C(2)))
+    {
+      s = m;
+    }
+    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(2)))
+    {
+      s = sqrt(m);
+    }
+    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(3)))
+    {
+      s = cbrt(m);
+    }
+    else
+    {
+      if(m.is_zero() || local_wide_integer_type::is_neg(m))
+      {
+        s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      }
+      else
+      {
+        // Obtain the initial guess via algorithms
+        // involving the position of the msb.
+        const auto msb_pos = msb(m);
 
-  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+        // Obtain the initial value.
+        const auto msb_pos_mod_k = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(k));
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+        const auto left_shift_amount =
+          static_cast<unsigned_fast_type>
+          (
+            ((msb_pos_mod_k == static_cast<unsigned_fast_type>(UINT8_C(0)))
+              ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / k)
+              : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(k - msb_pos_mod_k)) / k))
+          );
 
-  // Implement various number-theoretical tools.
+        auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
 
-  #if(__cplusplus >= 201703L)
-  namespace math::wide_integer {
-  #else
-  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
-  #endif
+        // Perform the iteration for the k'th root.
+        // See Algorithm 1.14 RootInt, Sect. 1.5.2
+        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press, 2011.
 
-  namespace detail {
+        const auto k_minus_one = static_cast<unsigned_fast_type>(k - 1U);
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  namespace my_own {
+        for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
+                   i < static_cast<unsigned_fast_type>(UINT8_C(64));
+                 ++i)
+        {
+          s = u;
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
-  {
-    using local_floating_point_type = FloatingPointType;
+          local_wide_integer_type m_over_s_pow_k_minus_one = m;
 
-    const auto x_is_neg = (x < static_cast<local_floating_point_type>(0.0L));
+          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < k_minus_one; ++j) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            // Use a loop here to divide by s^(k - 1) because
+            // without a loop, s^(k - 1) is likely to overflow.
 
-    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+            m_over_s_pow_k_minus_one /= s;
+          }
 
-    auto e2 = static_cast<int>(INT8_C(0));
+          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
 
-    constexpr auto two_pow32 =
-      static_cast<long double>
-      (
-        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
-      );
+          if(u >= s) { break; } // LCOV_EXCL_LINE
+        }
+      }
+    }
 
-    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
-    {
-      // TBD: Maybe optimize this exponent reduction
-      // with a more clever kind of binary searching.
+    return s;
+  }
 
-      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
-      e2 += static_cast<int>(INT32_C(32));
-    }
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate (b ^ p).
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+    local_wide_integer_type result;
+    auto p0 = static_cast<local_limb_type>(p);
 
-    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
+    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
     {
-      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
+    {
+      result = b;
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
+    {
+      result  = b;
+      result *= b;
+    }
+    else
+    {
+      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
 
-      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+      local_wide_integer_type y      (b);
+      local_wide_integer_type p_local(p);
 
-      ++e2;
-    }
+      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_wide_integer_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          result *= y;
+        }
 
-    if(expptr != nullptr)
-    {
-      *expptr = e2;
+        y *= y;
+
+        p_local >>= 1U;
+      }
     }
 
-    return ((!x_is_neg) ? f : -f);
+    return result;
   }
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
+  namespace detail {
+
+  // The maximum window size (in bits) of the sliding window exponentiation.
+  // The table of odd powers has 2^(window_bits - 1) elements, with 16
+  // elements for the default of 5 bits. The window size can be limited
+  // with WIDE_INTEGER_POWM_MAX_WINDOW_BITS on systems with little RAM,
+  // where 1 bit selects plain (left-to-right) binary exponentiation.
+  #if defined(WIDE_INTEGER_POWM_MAX_WINDOW_BITS)
+  constexpr auto powm_max_window_bits = static_cast<unsigned_fast_type>(WIDE_INTEGER_POWM_MAX_WINDOW_BITS);
+  #else
+  constexpr auto powm_max_window_bits = static_cast<unsigned_fast_type>(UINT8_C(5));
+  #endif
+
+  static_assert((powm_max_window_bits >= static_cast<unsigned_fast_type>(UINT8_C(1))) && (powm_max_window_bits <= static_cast<unsigned_fast_type>(UINT8_C(8))),
+                "Error: The maximum window size of powm must be in the range 1...8 bits");
+
+  // Get the bit with the given index of an exponent, whose limbs are
+  // stored in an array.
+  template<typename LimbArrayType>
+  constexpr auto powm_exponent_bit(const LimbArrayType& e, const unsigned_fast_type index) -> unsigned_fast_type
   {
-    using std::frexp;
+    using local_limb_type = typename LimbArrayType::value_type;
 
-    return frexp(x, expptr);
+    constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    return static_cast<unsigned_fast_type>(static_cast<local_limb_type>(e[static_cast<std::size_t>(index / limb_digits)] >> static_cast<unsigned>(index % limb_digits)) & static_cast<local_limb_type>(UINT8_C(1)));
   }
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
+  // Calculate (y ^ p) with the multiplication and the squaring of the
+  // reduction (barrett_reduction or montgomery_field), in which one is the
+  // number one and y is the base. The exponent is scanned from its most
+  // significant bit with a sliding window of odd powers y^1, y^3, y^5, ...
+  // The window size k is chosen from the bit length L of the exponent,
+  // such that the table (2^(k - 1) multiplications) and the windows
+  // (about L / (k + 1) multiplications) together need the fewest
+  // multiplications. If the base is a single limb v (v_is_small), the
+  // multiplications by the base are much cheaper than a full modular
+  // multiplication, and binary exponentiation is used.
+
+  // See also Algorithm 14.85 in A. J. Menezes, P. C. van Oorschot,
+  // S. A. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996.
+  template<typename ReductionType,
+           typename OtherIntegralTypeP>
+  constexpr auto powm_sliding_window(const ReductionType&                      reduction,
+                                     const typename ReductionType::value_type& one,
+                                     const typename ReductionType::value_type& y,
+                                     const typename ReductionType::limb_type   v,
+                                     const bool                                v_is_small,
+                                     const OtherIntegralTypeP&                 p) -> typename ReductionType::value_type
   {
-    using local_floating_point_type = FloatingPointType;
-
-    auto x_is_finite = true;
+    using local_value_type = typename ReductionType::value_type;
+    using local_limb_type  = typename ReductionType::limb_type;
 
-    const auto x_is_nan = (x != x);
+    constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
 
-    if(x_is_nan)
-    {
-      x_is_finite = false;
-    }
-    else
-    {
-      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
-      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+    constexpr auto exponent_limbs =
+      static_cast<std::size_t>
+      (
+        (static_cast<unsigned_fast_type>(std::numeric_limits<OtherIntegralTypeP>::digits) + static_cast<unsigned_fast_type>(limb_digits - 1U)) / limb_digits
+      );
 
-      if(x_is_inf_pos || x_is_inf_neg)
-      {
-        x_is_finite = false;
-      }
-    }
+    // Extract the limbs of the exponent. The exponent is not shifted
+    // beyond its width, which would be undefined for built-in types.
+    array_detail::array<local_limb_type, exponent_limbs> e { };
 
-    return x_is_finite;
-  }
+    {
+      OtherIntegralTypeP p_local(p);
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
-  {
-    using std::isfinite;
+      auto shift = static_cast<unsigned>(UINT8_C(0));
 
-    return (isfinite)(x);
-  }
-  } // namespace my_own
-  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < exponent_limbs; ++i)
+      {
+        p_local >>= shift; // NOLINT(hicpp-signed-bitwise)
 
-  template<typename UnsignedIntegralType>
-  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+        e[i] = static_cast<local_limb_type>(p_local);
 
-    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+        shift = static_cast<unsigned>(limb_digits);
+      }
+    }
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+    // Find the bit length of the exponent.
+    auto bit_count = static_cast<unsigned_fast_type>(exponent_limbs * limb_digits);
 
-    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+    while((bit_count != static_cast<unsigned_fast_type>(UINT8_C(0))) && (powm_exponent_bit(e, static_cast<unsigned_fast_type>(bit_count - 1U)) == static_cast<unsigned_fast_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      --bit_count;
+    }
 
-    // This assumes that at least one bit is set.
-    // Otherwise saturation of the index will occur.
+    local_value_type x(one);
 
-    // Naive and basic LSB search.
-    // TBD: This could be improved with a binary search
-    // on the lowest bit position of the fundamental type.
-    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
+    if(v_is_small)
     {
-      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
+      for(auto i = bit_count; i != static_cast<unsigned_fast_type>(UINT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(i != bit_count)
+        {
+          x = reduction.square(x);
+        }
 
-      ++result;
+        if(powm_exponent_bit(e, static_cast<unsigned_fast_type>(i - 1U)) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          x = reduction.multiply_by_limb(x, v);
+        }
+      }
+
+      return x;
     }
 
-    return result;
-  }
+    // Choose the window size with the fewest multiplications.
+    auto window_bits = static_cast<unsigned_fast_type>(UINT8_C(1));
 
-  template<typename UnsignedIntegralType>
-  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+    {
+      auto cost_min = (std::numeric_limits<unsigned_fast_type>::max)();
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+      for(auto k = static_cast<unsigned_fast_type>(UINT8_C(1)); k <= powm_max_window_bits; ++k)
+      {
+        const auto cost =
+          static_cast<unsigned_fast_type>
+          (
+              static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(1)) << static_cast<unsigned>(k - 1U))
+            + static_cast<unsigned_fast_type>(bit_count / static_cast<unsigned_fast_type>(k + 1U))
+          );
 
-    auto i = signed_fast_type { };
+        if(cost < cost_min)
+        {
+          cost_min    = cost;
+          window_bits = k;
+        }
+      }
+    }
 
-    // TBD: This could potentially be improved with a binary
-    // search for the highest bit position in the type.
+    // The table of the odd powers table[j] = y^(2j + 1).
+    array_detail::array<local_value_type, static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << static_cast<unsigned>(powm_max_window_bits - 1U))> table { };
+
+    table[static_cast<std::size_t>(UINT8_C(0))] = y;
 
-    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
     {
-      const auto bit_is_set =
-      (
-        static_cast<local_unsigned_integral_type>
-        (
-          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
-        )
-        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
-      );
+      const auto table_size = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << static_cast<unsigned>(window_bits - 1U));
 
-      if(bit_is_set)
+      if(table_size > static_cast<std::size_t>(UINT8_C(1)))
       {
-        break;
+        const local_value_type y2(reduction.square(y));
+
+        for(auto j = static_cast<std::size_t>(UINT8_C(1)); j < table_size; ++j)
+        {
+          table[j] = reduction.multiply(table[static_cast<std::size_t>(j - 1U)], y2);
+        }
       }
     }
 
-    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
-  }
+    auto x_is_one = true;
 
-  template<>
-  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast32_t>(u);
+    auto i = bit_count;
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+    while(i != static_cast<unsigned_fast_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      if(powm_exponent_bit(e, static_cast<unsigned_fast_type>(i - 1U)) == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        if(!x_is_one)
+        {
+          x = reduction.square(x);
+        }
 
-    return r;
-  }
+        --i;
+      }
+      else
+      {
+        // Find the longest window of at most window_bits bits,
+        // which starts at bit (i - 1) and ends with a set bit.
+        auto window_length = (std::min)(window_bits, i);
 
-  template<>
-  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast16_t>(u);
+        while(powm_exponent_bit(e, static_cast<unsigned_fast_type>(i - window_length)) == static_cast<unsigned_fast_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          --window_length;
+        }
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+        auto window_value = static_cast<std::size_t>(UINT8_C(0));
 
-    return r;
-  }
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < window_length; ++j)
+        {
+          window_value = static_cast<std::size_t>(static_cast<std::size_t>(window_value << 1U) | static_cast<std::size_t>(powm_exponent_bit(e, static_cast<unsigned_fast_type>(i - 1U - j))));
 
-  template<>
-  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast8_t>(u);
+          if(!x_is_one)
+          {
+            x = reduction.square(x);
+          }
+        }
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+        const auto& y_odd_power = table[static_cast<std::size_t>(window_value >> 1U)];
 
-    return r;
+        x = (x_is_one ? y_odd_power : reduction.multiply(x, y_odd_power));
+
+        x_is_one = false;
+
+        i = static_cast<unsigned_fast_type>(i - window_length);
+      }
+    }
+
+    return x;
   }
 
   } // namespace detail
 
   template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
-                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+           typename AllocatorType>
+  class montgomery_field
   {
-    if(&x != &y)
+    // Modular arithmetic in Montgomery form for an odd modulus m > 1.
+    // An element a is represented as (a * R) % m, with R = 2^Width2.
+    // The product of two elements is reduced with the coarsely
+    // integrated operand scanning (CIOS) method, which interleaves
+    // the multiplication and the reduction limb by limb, so that
+    // all calculations remain at the normal width and no division
+    // is needed. The constants (R^2 % m) and (-m^-1 % 2^limb_bits)
+    // are calculated once in the constructor.
+
+    // See also Algorithm 14.36 in A. J. Menezes, P. C. van Oorschot,
+    // S. A. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996,
+    // and C. K. Koc, T. Acar, B. S. Kaliski, "Analyzing and Comparing
+    // Montgomery Multiplication Algorithms", IEEE Micro 16(3), 1996.
+
+  public:
+    using value_type       = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type        = typename value_type::limb_type;
+    using double_limb_type = typename value_type::double_limb_type;
+
+    explicit constexpr montgomery_field(const value_type& m)
+      : my_m         (m),
+        my_m_inv_neg (negated_inverse_of_limb(*m.crepresentation().cbegin())),
+        my_one       (),
+        my_r2        ()
     {
-      detail::swap_unsafe(x, y);
-    }
-  }
+      using local_double_width_type = typename value_type::double_width_type;
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
-  {
-    // Calculate the position of the least-significant bit.
-    // Use a linear search starting from the least significant limb.
+      const local_double_width_type m_dbl(m);
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+      // R % m, which is the number one in Montgomery form.
+      local_double_width_type r(static_cast<std::uint8_t>(UINT8_C(1)));
 
-    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+      r <<= static_cast<unsigned>(Width2);
+      r %= m_dbl;
 
-    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
-    {
-      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+      my_one = value_type(r);
 
-      if(vi != static_cast<local_value_type>(UINT8_C(0)))
-      {
-        bpos =
-          static_cast<unsigned_fast_type>
-          (
-              detail::lsb_helper(*it)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
-              )
-          );
+      // R^2 % m, which converts into Montgomery form.
+      r *= r;
+      r %= m_dbl;
 
-        break;
-      }
+      my_r2 = value_type(r);
     }
 
-    return bpos;
-  }
+    WIDE_INTEGER_NODISCARD constexpr auto modulus() const -> const value_type& { return my_m; }
+    WIDE_INTEGER_NODISCARD constexpr auto one    () const -> const value_type& { return my_one; }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
-  {
-    // Calculate the position of the most-significant bit.
-    // Use a linear search starting from the most significant limb.
+    // The input of to_montgomery() may have any value. All other
+    // functions expect elements in Montgomery form in the range [0, m).
+    WIDE_INTEGER_NODISCARD constexpr auto to_montgomery  (const value_type& a) const -> value_type { return multiply(a, my_r2); }
+    WIDE_INTEGER_NODISCARD constexpr auto from_montgomery(const value_type& a) const -> value_type { return multiply(a, value_type(static_cast<std::uint8_t>(UINT8_C(1)))); }
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+    WIDE_INTEGER_NODISCARD constexpr auto add(const value_type& a, const value_type& b) const -> value_type
+    {
+      // The sum may wrap around, in which case it also exceeds m.
+      const value_type s(a + b);
 
-    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
-    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
+      return (((s < a) || (s >= my_m)) ? value_type(s - my_m) : s);
+    }
 
-    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
+    WIDE_INTEGER_NODISCARD constexpr auto subtract(const value_type& a, const value_type& b) const -> value_type
     {
-      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
+      return ((a >= b) ? value_type(a - b) : value_type((a - b) + my_m));
+    }
 
-      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+    WIDE_INTEGER_NODISCARD constexpr auto multiply(const value_type& a, const value_type& b) const -> value_type
+    {
+      constexpr auto n = static_cast<size_t>(value_type::number_of_limbs);
+
+      // The intermediate result has two more limbs than the operands.
+      detail::array_detail::array<limb_type, static_cast<std::size_t>(n + static_cast<size_t>(UINT8_C(2)))> t { };
+
+      const auto& a_rep = a.crepresentation();
+      const auto& b_rep = b.crepresentation();
+      const auto& m_rep = my_m.crepresentation();
+
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < n; ++i)
       {
-        bpos =
-          static_cast<unsigned_fast_type>
+        // Add the product of a and the limb b[i].
+        const auto b_i = static_cast<double_limb_type>(*detail::advance_and_point(b_rep.cbegin(), i));
+
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<size_t>(UINT8_C(0)); j < n; ++j)
+        {
+          const auto sum =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(t[j])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(a_rep.cbegin(), j)) * b_i)
+              + carry
+            );
+
+          t[j]  = detail::make_lo<limb_type>(sum);
+          carry = detail::make_hi<limb_type>(sum);
+        }
+
+        {
+          const auto sum = static_cast<double_limb_type>(static_cast<double_limb_type>(t[n]) + carry);
+
+          t[n]                                               = detail::make_lo<limb_type>(sum);
+          t[static_cast<size_t>(n + static_cast<size_t>(1U))] = detail::make_hi<limb_type>(sum);
+        }
+
+        // Add the multiple q * m, which makes the lowest limb zero,
+        // and shift the intermediate result down by one limb.
+        const auto q = static_cast<double_limb_type>(static_cast<limb_type>(static_cast<double_limb_type>(t[static_cast<size_t>(UINT8_C(0))]) * my_m_inv_neg));
+
+        carry =
+          detail::make_hi<limb_type>
           (
-              detail::msb_helper(*ri)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
-              )
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(t[static_cast<size_t>(UINT8_C(0))])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(*m_rep.cbegin()) * q)
+            )
           );
 
-        break;
-      }
-    }
+        for(auto j = static_cast<size_t>(UINT8_C(1)); j < n; ++j)
+        {
+          const auto sum =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(t[j])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(m_rep.cbegin(), j)) * q)
+              + carry
+            );
 
-    return bpos;
-  }
+          t[static_cast<size_t>(j - static_cast<size_t>(1U))] = detail::make_lo<limb_type>(sum);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+          carry = detail::make_hi<limb_type>(sum);
+        }
 
-    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
-  }
+        const auto sum = static_cast<double_limb_type>(static_cast<double_limb_type>(t[n]) + carry);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // Calculate the square root.
+        t[static_cast<size_t>(n - static_cast<size_t>(1U))] = detail::make_lo<limb_type>(sum);
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+        t[n] = static_cast<limb_type>(t[static_cast<size_t>(n + static_cast<size_t>(1U))] + detail::make_hi<limb_type>(sum));
+      }
 
-    local_wide_integer_type s;
+      value_type result { };
+
+      detail::copy_unsafe(t.cbegin(), detail::advance_and_point(t.cbegin(), n), result.representation().begin());
+
+      // The intermediate result is less than 2m, so that one
+      // conditional subtraction of m completes the reduction.
+      if((t[n] != static_cast<limb_type>(UINT8_C(0))) || (result >= my_m))
+      {
+        result -= my_m;
+      }
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto square(const value_type& a) const -> value_type { return multiply(a, a); }
 
-    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    // Calculate (a * v) % m for a single limb v. If a is in Montgomery
+    // form, then so is the result.
+    WIDE_INTEGER_NODISCARD constexpr auto multiply_by_limb(const value_type& a, const limb_type v) const -> value_type
     {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      return value_type::eval_mulmod_by_limb(a, v, my_m);
     }
-    else
-    {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
 
-      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
+    // Calculate (b ^ p) % m, where b and the result are not in Montgomery form,
+    // see detail::powm_sliding_window().
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const value_type& b, const OtherIntegralTypeP& p) const -> value_type
+    {
+      const auto v = static_cast<limb_type>(b);
 
-      // Obtain the initial value.
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
-        (
-          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
-            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
-            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
-        );
+      const auto v_is_small = ((b < my_m) && (b == value_type(v)));
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+      return from_montgomery(detail::powm_sliding_window(*this, my_one, to_montgomery(b), v, v_is_small, p));
+    }
 
-      // Perform the iteration for the square root.
-      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+  private:
+    value_type my_m;
+    limb_type  my_m_inv_neg;
+    value_type my_one;
+    value_type my_r2;
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
-      {
-        s = u;
+    static constexpr auto negated_inverse_of_limb(const limb_type m0) -> limb_type
+    {
+      // Calculate -m0^-1 % 2^limb_bits with Newton iteration. For odd m0,
+      // the initial value x = m0 is correct in the lowest 3 bits, and each
+      // step x = x * (2 - (m0 * x)) doubles the number of correct bits.
 
-        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
+      auto x = m0;
 
-        if(u >= s) { break; } // LCOV_EXCL_LINE
+      for(auto   correct_bits = static_cast<int>(INT8_C(3));
+                 correct_bits < std::numeric_limits<limb_type>::digits;
+                 correct_bits = static_cast<int>(correct_bits * static_cast<int>(INT8_C(2))))
+      {
+        x = static_cast<limb_type>(static_cast<double_limb_type>(x) * static_cast<limb_type>(static_cast<limb_type>(UINT8_C(2)) - static_cast<limb_type>(static_cast<double_limb_type>(m0) * x)));
       }
-    }
 
-    return s;
-  }
+      return static_cast<limb_type>(static_cast<limb_type>(~x) + static_cast<limb_type>(UINT8_C(1)));
+    }
+  };
 
   template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
+           typename AllocatorType>
+  class barrett_reduction
   {
-    // Calculate the cube root.
+    // Modular reduction with a precomputed reciprocal of the modulus m > 0.
+    // The modulus is normalized with a left shift, such that its most
+    // significant bit is set, and its reciprocal is calculated once in the
+    // constructor (with Newton iteration for large widths). Then a reduction
+    // needs two multiplications and a few subtractions instead of a long
+    // division. Unlike in Montgomery form, the values are not transformed
+    // and the modulus may also be even.
+
+    // See also Algorithm 14.42 in A. J. Menezes, P. C. van Oorschot,
+    // S. A. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996,
+    // and P. Barrett, "Implementing the Rivest Shamir and Adleman public key
+    // encryption algorithm on a standard digital signal processor",
+    // CRYPTO '86, LNCS 263 (1987).
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  public:
+    using value_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using double_width_type = typename value_type::double_width_type;
+    using limb_type         = typename value_type::limb_type;
 
-    local_wide_integer_type s;
+    explicit constexpr barrett_reduction(const value_type& m)
+      : my_m    (m),
+        my_shift(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(Width2 - 1U) - msb(m))),
+        my_d    (m << my_shift),
+        my_d_rec(value_type::eval_reciprocal_newton(my_d)) { }
 
-    if(local_wide_integer_type::is_neg(m))
-    {
-      s = -cbrt(-m);
-    }
-    else if(m.is_zero())
-    {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
-    }
-    else
+    WIDE_INTEGER_NODISCARD constexpr auto modulus() const -> const value_type& { return my_m; }
+
+    // Calculate x % m for x < (m * 2^Width2). This holds for the
+    // product of a value in the range [0, m) with any other value.
+    WIDE_INTEGER_NODISCARD constexpr auto reduce(const double_width_type& x) const -> value_type
     {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
+      double_width_type r(x);
 
-      // Obtain the initial value.
-      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
+      r <<= my_shift;
 
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
-        (
-          (msb_pos_mod_3 == static_cast<unsigned_fast_type>(UINT8_C(0)))
-            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 3U)
-            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(3)) - msb_pos_mod_3)) / 3U)
-        );
+      value_type q { };
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+      value_type::eval_divide_by_reciprocal(r, my_d, my_d_rec, q);
 
-      // Perform the iteration for the k'th root.
-      // See Algorithm 1.14 RootInt, Sect. 1.5.2
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+      r >>= my_shift;
 
-      const auto three_minus_one =
-        static_cast<unsigned_fast_type>
-        (
-          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
-        );
+      return value_type(r);
+    }
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
-      {
-        s = u;
+    WIDE_INTEGER_NODISCARD constexpr auto reduce(const value_type& x) const -> value_type { return reduce(double_width_type(x)); }
 
-        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+    // Calculate (a * b) % m, where at least one of a and b is in the range [0, m).
+    WIDE_INTEGER_NODISCARD constexpr auto multiply(const value_type& a, const value_type& b) const -> value_type
+    {
+      return reduce(value_type::mul_to_double_width(a, b));
+    }
 
-        for(auto   j = static_cast<unsigned_fast_type>(UINT8_C(0));
-                   j < static_cast<unsigned_fast_type>(static_cast<unsigned>(3U - 1U));
-                 ++j)
-        {
-          // Use a loop here to divide by s^(3 - 1) because
-          // without a loop, s^(3 - 1) is likely to overflow.
+    WIDE_INTEGER_NODISCARD constexpr auto square(const value_type& a) const -> value_type { return multiply(a, a); }
 
-          m_over_s_pow_3_minus_one /= s;
-        }
+    // Calculate (a * v) % m for a in the range [0, m) and a single limb v.
+    WIDE_INTEGER_NODISCARD constexpr auto multiply_by_limb(const value_type& a, const limb_type v) const -> value_type
+    {
+      return value_type::eval_mulmod_by_limb(a, v, my_m);
+    }
 
-        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / static_cast<unsigned>(UINT8_C(3));
+    // Calculate (b ^ p) % m, see detail::powm_sliding_window().
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const value_type& b, const OtherIntegralTypeP& p) const -> value_type
+    {
+      const value_type y(reduce(b));
 
-        if(u >= s) { break; }
-      }
+      const auto v = static_cast<limb_type>(y);
+
+      return detail::powm_sliding_window(*this, reduce(value_type(static_cast<std::uint8_t>(UINT8_C(1)))), y, v, (y == value_type(v)), p);
     }
 
-    return s;
-  }
+  private:
+    value_type         my_m;
+    unsigned_fast_type my_shift;
+    value_type         my_d;
+    value_type         my_d_rec;
+  };
 
   template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+           typename AllocatorType>
+  class fixed_base_powm
   {
-    // Calculate the k'th root.
+    // Modular exponentiation of a fixed base b with many exponents p of up
+    // to Width2 bits, as in Diffie-Hellman key exchange. The bits of the
+    // exponent are arranged in comb_teeth rows of comb_spacing bits, and
+    // the products of the powers b^(2^(row * comb_spacing)) for all subsets
+    // of the rows are calculated once in the constructor (fixed-base comb).
+    // Then powm(p) needs only comb_spacing squarings and at most comb_spacing
+    // multiplications, instead of Width2 squarings in powm(). The modular
+    // multiplications use barrett_reduction, so that the modulus may also
+    // be even.
+
+    // See also Algorithm 14.113 in A. J. Menezes, P. C. van Oorschot,
+    // S. A. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996,
+    // and C. H. Lim, P. J. Lee, "More Flexible Exponentiation with
+    // Precomputation", CRYPTO '94, LNCS 839 (1994).
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  public:
+    using value_type     = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type      = typename value_type::limb_type;
+    using reduction_type = barrett_reduction<Width2, LimbType, AllocatorType>;
 
-    local_wide_integer_type s;
+    static constexpr auto comb_teeth   = static_cast<unsigned_fast_type>(UINT8_C(4));
+    static constexpr auto comb_spacing = static_cast<unsigned_fast_type>((static_cast<unsigned_fast_type>(Width2) + static_cast<unsigned_fast_type>(comb_teeth - 1U)) / comb_teeth);
 
-    if(k < static_cast<std::uint_fast8_t>(UINT8_C(2)))
-    {
-      s = m;
-    }
-    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(2)))
-    {
-      s = sqrt(m);
-    }
-    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(3)))
-    {
-      s = cbrt(m);
-    }
-    else
+    constexpr fixed_base_powm(const value_type& b, const value_type& m)
+      : my_reduction(m),
+        my_table    ()
     {
-      if(m.is_zero() || local_wide_integer_type::is_neg(m))
-      {
-        s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
-      }
-      else
+      // Each element my_table[s] is the product of the powers
+      // b^(2^(row * comb_spacing)) of the rows, whose bits are set in s.
+      my_table[static_cast<std::size_t>(UINT8_C(0))] = my_reduction.reduce(value_type(static_cast<std::uint8_t>(UINT8_C(1))));
+      my_table[static_cast<std::size_t>(UINT8_C(1))] = my_reduction.reduce(b);
+
+      for(auto row = static_cast<unsigned_fast_type>(UINT8_C(1)); row < comb_teeth; ++row)
       {
-        // Obtain the initial guess via algorithms
-        // involving the position of the msb.
-        const auto msb_pos = msb(m);
+        const auto s_row = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << static_cast<unsigned>(row));
 
-        // Obtain the initial value.
-        const auto msb_pos_mod_k = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(k));
+        value_type y(my_table[static_cast<std::size_t>(s_row >> 1U)]);
 
-        const auto left_shift_amount =
-          static_cast<unsigned_fast_type>
-          (
-            ((msb_pos_mod_k == static_cast<unsigned_fast_type>(UINT8_C(0)))
-              ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / k)
-              : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(k - msb_pos_mod_k)) / k))
-          );
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < comb_spacing; ++j)
+        {
+          y = my_reduction.square(y);
+        }
 
-        auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+        my_table[s_row] = y;
 
-        // Perform the iteration for the k'th root.
-        // See Algorithm 1.14 RootInt, Sect. 1.5.2
-        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press, 2011.
+        for(auto s = static_cast<std::size_t>(UINT8_C(1)); s < s_row; ++s)
+        {
+          my_table[static_cast<std::size_t>(s_row + s)] = my_reduction.multiply(y, my_table[s]);
+        }
+      }
+    }
 
-        const auto k_minus_one = static_cast<unsigned_fast_type>(k - 1U);
+    WIDE_INTEGER_NODISCARD constexpr auto modulus() const -> const value_type& { return my_reduction.modulus(); }
 
-        for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
-                   i < static_cast<unsigned_fast_type>(UINT8_C(64));
-                 ++i)
+    // Calculate (b ^ p) % m.
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const value_type& p) const -> value_type
+    {
+      value_type x(my_table[static_cast<std::size_t>(UINT8_C(0))]);
+
+      auto x_is_one = true;
+
+      for(auto column = comb_spacing; column != static_cast<unsigned_fast_type>(UINT8_C(0)); --column)
+      {
+        if(!x_is_one)
         {
-          s = u;
+          x = my_reduction.square(x);
+        }
 
-          local_wide_integer_type m_over_s_pow_k_minus_one = m;
+        // Collect the bits of the exponent in this column of the comb.
+        auto s = static_cast<std::size_t>(UINT8_C(0));
 
-          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < k_minus_one; ++j) // NOLINT(altera-id-dependent-backward-branch)
-          {
-            // Use a loop here to divide by s^(k - 1) because
-            // without a loop, s^(k - 1) is likely to overflow.
+        for(auto row = static_cast<unsigned_fast_type>(UINT8_C(0)); row < comb_teeth; ++row)
+        {
+          const auto index = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(row * comb_spacing) + static_cast<unsigned_fast_type>(column - 1U));
 
-            m_over_s_pow_k_minus_one /= s;
+          if(index < static_cast<unsigned_fast_type>(Width2))
+          {
+            s |= static_cast<std::size_t>(static_cast<std::size_t>(detail::powm_exponent_bit(p.crepresentation(), index)) << static_cast<unsigned>(row));
           }
+        }
 
-          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+        if(s != static_cast<std::size_t>(UINT8_C(0)))
+        {
+          x = (x_is_one ? my_table[s] : my_reduction.multiply(x, my_table[s]));
 
-          if(u >= s) { break; } // LCOV_EXCL_LINE
+          x_is_one = false;
         }
       }
+
+      return x;
     }
 
-    return s;
+  private:
+    reduction_type my_reduction;
+
+    detail::array_detail::array<value_type, static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << static_cast<unsigned>(comb_teeth))> my_table;
+  };
+
+  namespace detail {
+
+  // Use the Montgomery field in powm() when the modulus is odd and
+  // has the same unsigned type as the base. Otherwise return false.
+  template<typename NormalWidthType,
+           typename OtherIntegralTypeP,
+           typename OtherIntegralTypeM>
+  constexpr auto powm_montgomery(const NormalWidthType&, const OtherIntegralTypeP&, const OtherIntegralTypeM&, NormalWidthType&) -> bool
+  {
+    return false;
   }
 
   template<typename OtherIntegralTypeP,
            const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+           typename AllocatorType>
+  constexpr auto powm_montgomery(const uintwide_t<Width2, LimbType, AllocatorType, false>& b,
+                                 const OtherIntegralTypeP&                                 p,
+                                 const uintwide_t<Width2, LimbType, AllocatorType, false>& m,
+                                       uintwide_t<Width2, LimbType, AllocatorType, false>& result) -> bool
   {
-    // Calculate (b ^ p).
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+    const auto m_is_odd =
+      (static_cast<LimbType>(*m.crepresentation().cbegin() & static_cast<LimbType>(UINT8_C(1))) != static_cast<LimbType>(UINT8_C(0)));
 
-    local_wide_integer_type result;
-    auto p0 = static_cast<local_limb_type>(p);
-
-    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
+    if((!m_is_odd) || (m == static_cast<unsigned>(UINT8_C(1))))
     {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
-    }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
-    {
-      result = b;
-    }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
-    {
-      result  = b;
-      result *= b;
+      return false;
     }
-    else
-    {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
 
-      local_wide_integer_type y      (b);
-      local_wide_integer_type p_local(p);
+    result = montgomery_field<Width2, LimbType, AllocatorType>(m).powm(b, p);
 
-      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_wide_integer_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
-        {
-          result *= y;
-        }
+    return true;
+  }
 
-        y *= y;
+  // Use Barrett reduction in powm() when the modulus is not zero and has
+  // the same unsigned type as the base. Otherwise return false.
+  template<typename NormalWidthType,
+           typename OtherIntegralTypeP,
+           typename OtherIntegralTypeM>
+  constexpr auto powm_barrett(const NormalWidthType&, const OtherIntegralTypeP&, const OtherIntegralTypeM&, NormalWidthType&) -> bool
+  {
+    return false;
+  }
 
-        p_local >>= 1U;
-      }
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  constexpr auto powm_barrett(const uintwide_t<Width2, LimbType, AllocatorType, false>& b,
+                              const OtherIntegralTypeP&                                 p,
+                              const uintwide_t<Width2, LimbType, AllocatorType, false>& m,
+                                    uintwide_t<Width2, LimbType, AllocatorType, false>& result) -> bool
+  {
+    if(m == static_cast<unsigned>(UINT8_C(0)))
+    {
+      return false;
     }
 
-    return result;
+    result = barrett_reduction<Width2, LimbType, AllocatorType>(m).powm(b, p);
+
+    return true;
   }
 
+  } // namespace detail
+
   template<typename OtherIntegralTypeP,
            typename OtherIntegralTypeM,
            const size_t Width2,
@@ -6448,6 +8480,21 @@
     }
     else
     {
+      #if defined(WIDE_INTEGER_USE_MONTGOMERY_FIELD)
+      // Optionally use Montgomery multiplication, which needs no division.
+      if(detail::powm_montgomery(b, p, m, result))
+      {
+        return result;
+      }
+      #endif
+
+      // Reduce with the precomputed reciprocal of the modulus instead of
+      // a long division in each step.
+      if(detail::powm_barrett(b, p, m, result))
+      {
+        return result;
+      }
+
       using local_other_integral_p_type = OtherIntegralTypeP;
 
       local_double_width_type     x      (static_cast<std::uint8_t>(UINT8_C(1)));
@@ -6677,7 +8724,7 @@
 
     local_unsigned_wide_type ur { };
 
-    ua.eval_divide_knuth(ub, &ur);
+    ua.eval_divide(ub, &ur);
 
     using divmod_result_pair_type = std::pair<local_unsigned_wide_type, local_unsigned_wide_type>;
 
@@ -6708,7 +8755,7 @@
 
     local_unsigned_wide_type ur { };
 
-    ua.eval_divide_knuth(ub, &ur);
+    ua.eval_divide(ub, &ur);
 
     using divmod_result_pair_type =
       std::pair<local_unknown_signedness_left_type, local_unknown_signedness_right_type>;
@@ -6999,6 +9046,12 @@
     // Note: Some comments in this subroutine use the Wolfram Language(TM).
     // These can be exercised at the web links to WolframAlpha(R) provided
 
+    // Note: The modular exponentiations, which dominate the run time of
+    // this test, use the Barrett reduction of barrett_reduction, which is
+    // set up once for n, and sliding window exponentiation. When
+    // WIDE_INTEGER_USE_MONTGOMERY_FIELD is defined, they use the
+    // Montgomery multiplication of montgomery_field instead.
+
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
     using local_limb_type         = typename local_wide_integer_type::limb_type;
 
@@ -7149,11 +9202,34 @@
     // Since we have already excluded all small factors
     // up to and including 227, n is greater than 227.
 
+    // The modular exponentiations and the repeated squarings use the
+    // same precomputed reduction by np.
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const barrett_reduction<Width2, LimbType, AllocatorType> np_reduction { local_unsigned_wide_integer_type { np } };
+
+    #if defined(WIDE_INTEGER_USE_MONTGOMERY_FIELD)
+    const montgomery_field<Width2, LimbType, AllocatorType> np_powm_reduction { local_unsigned_wide_integer_type { np } };
+    #else
+    const barrett_reduction<Width2, LimbType, AllocatorType>& np_powm_reduction { np_reduction };
+    #endif
+
+    auto
+      powm_np
+      {
+        [&np_powm_reduction](const local_wide_integer_type& b, const local_wide_integer_type& p)
+        {
+          return local_wide_integer_type { np_powm_reduction.powm(local_unsigned_wide_integer_type { b }, local_unsigned_wide_integer_type { p }) };
+        }
+      };
+
     {
       // Perform a single Fermat test which will
-      // exclude many non-prime candidates.
+      // exclude many non-prime candidates. The base
+      // fits in a single limb, which makes the
+      // multiplications by the base cheap.
 
-      const local_wide_integer_type fn { powm(local_wide_integer_type(static_cast<local_limb_type>(228U)), nm1, np) };
+      const local_wide_integer_type fn { powm_np(local_wide_integer_type(static_cast<local_limb_type>(228U)), nm1) };
 
       if(!isone(fn))
       {
@@ -7187,11 +9263,7 @@
     do
     {
       x = distribution(generator, params);
-      y = powm(x, q, np);
-
-      using local_double_width_type = typename local_wide_integer_type::double_width_type;
-
-      const local_double_width_type np_dbl { np };
+      y = powm_np(x, q);
 
       std::size_t jdx { UINT8_C(0) };
 
@@ -7211,15 +9283,10 @@
         {
           // Continue with the next value of y.
 
-          // Manually calculate:
+          // Calculate:
           //   y = powm(y, 2, np);
 
-          local_double_width_type yd { y };
-
-          yd *= yd;
-          yd %= np_dbl;
-
-          y = local_wide_integer_type { yd };
+          y = local_wide_integer_type { np_reduction.square(local_unsigned_wide_integer_type { y }) };
         }
       }
 
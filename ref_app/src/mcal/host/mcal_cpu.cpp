@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2019 - 2023.
+//  Copyright Christopher Kormanyos 2019 - 2026.
 //  Distributed under the Boost Software License,
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -7,7 +7,62 @@
 
 #include <mcal_cpu.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace local
+{
+  // Limit the sleep so that the idle task still services the watchdog.
+  constexpr auto idle_sleep_max_microseconds = static_cast<std::uint32_t>(UINT32_C(100000));
+
+  std::mutex              idle_mutex;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  std::condition_variable idle_condition;      // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  // The wakeup takes the mutex only when the idle task is sleeping.
+  // The idle task sets idle_is_sleeping before it tests the pending
+  // wakeup, and the wakeup sets the pending wakeup before it tests
+  // idle_is_sleeping, so that at least one of them sees the other.
+  std::atomic<bool>       idle_wakeup_pending; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  std::atomic<bool>       idle_is_sleeping;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace local
+
 auto mcal::cpu::init() -> void
 {
   // Subroutine is empty on purpose.
 }
+
+auto mcal::cpu::idle_sleep(const std::uint32_t timeout_microseconds) -> void
+{
+  const auto timeout = std::chrono::microseconds((std::min)(timeout_microseconds, local::idle_sleep_max_microseconds));
+
+  local::idle_is_sleeping.store(true);
+
+  if(!local::idle_wakeup_pending.exchange(false))
+  {
+    std::unique_lock<std::mutex> lock(local::idle_mutex);
+
+    static_cast<void>(local::idle_condition.wait_for(lock, timeout, []() { return local::idle_wakeup_pending.load(); }));
+
+    local::idle_wakeup_pending.store(false);
+  }
+
+  local::idle_is_sleeping.store(false);
+}
+
+auto mcal::cpu::idle_wakeup() -> void
+{
+  // A wakeup that is already pending needs nothing more.
+  if((!local::idle_wakeup_pending.exchange(true)) && local::idle_is_sleeping.load())
+  {
+    {
+      // Taking the mutex ensures that the idle task is either before
+      // its test of the pending wakeup or already waiting.
+      const std::lock_guard<std::mutex> lock(local::idle_mutex);
+    }
+
+    local::idle_condition.notify_one();
+  }
+}
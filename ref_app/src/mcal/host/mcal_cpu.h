@@ -10,6 +10,9 @@
 
   #define MY_PROGMEM
 
+  // The host supports the tickless idle of the multitasking scheduler.
+  #define MCAL_CPU_HAS_IDLE_SLEEP
+
   #include <cstdint>
   #include <type_traits>
 
@@ -24,6 +27,13 @@
 
       inline auto nop() -> void { }
 
+      // Sleep until the timeout (in microseconds) has elapsed or
+      // until a wakeup is signaled, whichever comes first.
+      // A wakeup that was signaled before the sleep is not lost.
+      auto idle_sleep(const std::uint32_t timeout_microseconds) -> void;
+
+      auto idle_wakeup() -> void;
+
     } // namespace cpu
   } // namespace mcal
 
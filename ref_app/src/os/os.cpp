@@ -5,12 +5,20 @@
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
-#include <mcal_irq.h>
 #include <os/os.h>
+#include <os/os_atomic.h>
 #include <os/os_task_control_block.h>
 
+#include <util/utility/util_priority_bitmap.h>
+
+#if defined(OS_CFG_EXECUTOR_WORKER_COUNT)
+#include <os/os_executor.h>
+#endif
+
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <limits>
 
 namespace local
 {
@@ -18,10 +26,22 @@ namespace local
 
   using task_index_type = std::uint_fast8_t;
 
+  using task_bitmap_type = util::priority_bitmap<OS_TASK_COUNT>;
+
+  static_assert(OS_TASK_COUNT <= static_cast<std::size_t>(std::numeric_limits<task_index_type>::max()),
+                "the task count exceeds the range of the task index");
+
   auto os_task_list() -> task_list_type&;
 
   // The index of the running task.
   task_index_type os_task_index; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  // The set of tasks that are ready, either having an event
+  // or having an expired interval timer. The lowest index wins.
+  task_bitmap_type os_task_ready; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  // The set of tasks whose interval timer has expired.
+  task_bitmap_type os_task_timeout; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 } // namespace local
 
 // The one (and only one) operating system task list.
@@ -32,6 +52,267 @@ auto local::os_task_list() -> local::task_list_type&
   return my_task_list;
 }
 
+#if defined(OS_CFG_EXECUTOR_WORKER_COUNT)
+
+namespace local
+{
+  using executor_type = os::executor<OS_TASK_COUNT>;
+
+  auto os_executor() -> executor_type&;
+} // namespace local
+
+auto local::os_executor() -> local::executor_type&
+{
+  static executor_type my_executor(os_task_list(), static_cast<std::size_t>(OS_CFG_EXECUTOR_WORKER_COUNT));
+
+  return my_executor;
+}
+
+OS_NORETURN auto os::start_os() -> void
+{
+  // Initialize each task and start the worker threads of the executor.
+  local::os_executor().start();
+
+  // Initialize the idle task.
+  OS_IDLE_TASK_INIT();
+
+  // The calling thread services the idle task. It sleeps until the
+  // earliest task deadline or until an event is set, as in the
+  // single-threaded scheduler.
+  for(;;)
+  {
+    OS_IDLE_TASK_FUNC();
+
+    OS_IDLE_TASK_SLEEP(local::os_executor().ticks_until_next_deadline(os::timer_type::get_mark()));
+  }
+}
+
+auto os::set_event(const task_id_type task_id, const event_type& event_to_set) -> bool
+{
+  const auto result_set_is_ok = local::os_executor().set_event(static_cast<std::size_t>(task_id), event_to_set);
+
+  OS_IDLE_TASK_WAKEUP();
+
+  return result_set_is_ok;
+}
+
+auto os::get_event(event_type& event_to_get) -> void
+{
+  local::os_executor().get_event(event_to_get);
+}
+
+auto os::clear_event(const event_type& event_to_clear) -> void
+{
+  local::os_executor().clear_event(event_to_clear);
+}
+
+auto os::post_event_from_isr(const task_id_type* task_ids_first,
+                             const task_id_type* task_ids_last,
+                             const event_type&   event_to_set) -> bool
+{
+  auto result_post_is_ok = true;
+
+  for(auto it_task_id = task_ids_first; it_task_id != task_ids_last; ++it_task_id) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  {
+    result_post_is_ok = (local::os_executor().set_event(static_cast<std::size_t>(*it_task_id), event_to_set) && result_post_is_ok);
+  }
+
+  OS_IDLE_TASK_WAKEUP();
+
+  return result_post_is_ok;
+}
+
+auto os::get_task_profile(const task_id_type task_id, task_profile_type& profile_to_get) -> bool
+{
+  // The task profile is not collected by the executor, see os_cfg.h.
+  static_cast<void>(task_id);
+
+  profile_to_get = task_profile_type { };
+
+  return false;
+}
+
+#else
+
+namespace local
+{
+  // The set of tasks for which an event has been posted since the
+  // scheduler last looked. Setting an event only sets a bit in this
+  // set, using atomic operations, so that the ready set is modified
+  // by the scheduler alone and needs no interrupt-disable protection.
+  using task_post_word_type = std::uint32_t;
+
+  constexpr auto task_post_word_digits = static_cast<std::size_t>(std::numeric_limits<task_post_word_type>::digits);
+  constexpr auto task_post_word_count  = static_cast<std::size_t>((OS_TASK_COUNT + (task_post_word_digits - 1U)) / task_post_word_digits);
+
+  using task_post_list_type = std::array<task_post_word_type, task_post_word_count>;
+
+  task_post_list_type os_task_posted; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  auto os_task_post_mask(const std::size_t task_index) -> task_post_word_type;
+
+  auto os_task_post(task_post_list_type& task_post_list, const std::size_t task_index) -> void;
+
+  auto os_task_post_merge(task_bitmap_type& task_ready) -> void;
+} // namespace local
+
+auto local::os_task_post_mask(const std::size_t task_index) -> local::task_post_word_type
+{
+  return static_cast<task_post_word_type>(static_cast<task_post_word_type>(UINT8_C(1)) << static_cast<unsigned>(task_index % task_post_word_digits));
+}
+
+auto local::os_task_post(local::task_post_list_type& task_post_list, const std::size_t task_index) -> void
+{
+  const auto word_index = static_cast<std::size_t>(task_index / task_post_word_digits);
+
+  task_post_list[word_index] = static_cast<task_post_word_type>(task_post_list[word_index] | os_task_post_mask(task_index));
+}
+
+// Move the posted tasks into the ready set of the scheduler.
+auto local::os_task_post_merge(local::task_bitmap_type& task_ready) -> void
+{
+  for(auto word_index = static_cast<std::size_t>(UINT8_C(0)); word_index < task_post_word_count; ++word_index)
+  {
+    auto posted = os::detail::atomic_exchange(os_task_posted[word_index], static_cast<task_post_word_type>(UINT8_C(0)));
+
+    while(posted != static_cast<task_post_word_type>(UINT8_C(0)))
+    {
+      const auto bit_index = static_cast<std::size_t>(util::detail::priority_bitmap_ctz(posted));
+
+      task_ready.set(static_cast<std::size_t>((word_index * task_post_word_digits) + bit_index));
+
+      posted = static_cast<task_post_word_type>(posted & static_cast<task_post_word_type>(posted - 1U));
+    }
+  }
+}
+
+namespace os { namespace detail {
+
+// A binary min-heap of the indices of the cyclic tasks
+// that are waiting for their interval timer to expire.
+class task_deadline_heap final
+{
+public:
+  using task_index_type = local::task_index_type;
+
+  task_deadline_heap() = default;
+
+  auto push(const task_index_type task_index) -> void
+  {
+    auto child = my_size;
+
+    ++my_size;
+
+    // Sift the new deadline up toward the root of the heap.
+    while(child != static_cast<std::size_t>(UINT8_C(0)))
+    {
+      const auto parent = static_cast<std::size_t>((child - 1U) / 2U);
+
+      if(!is_before(task_index, my_heap[parent]))
+      {
+        break;
+      }
+
+      my_heap[child] = my_heap[parent];
+
+      child = parent;
+    }
+
+    my_heap[child] = task_index;
+  }
+
+  // Move each task whose interval timer has expired at the timepoint
+  // from the deadline heap into the sets of ready and timed-out tasks.
+  // The root of the heap has the earliest deadline, so this check
+  // is usually a single comparison.
+  auto expire(const tick_type& timepoint_of_ckeck_ready,
+              local::task_bitmap_type& task_ready,
+              local::task_bitmap_type& task_timeout) -> void
+  {
+    const auto& task_list = local::os_task_list();
+
+    while(   (my_size != static_cast<std::size_t>(UINT8_C(0)))
+          && task_list[my_heap[0U]].my_timer.timeout_of_specific_timepoint(timepoint_of_ckeck_ready))
+    {
+      const auto task_index = my_heap[0U];
+
+      pop();
+
+      task_timeout.set(task_index);
+
+      task_ready.set(task_index);
+    }
+  }
+
+  // Get the ticks from the timepoint until the earliest deadline,
+  // or the maximum tick value if there is no cyclic task.
+  auto ticks_until_next_deadline(const tick_type& timepoint) const -> tick_type
+  {
+    return
+      ((my_size != static_cast<std::size_t>(UINT8_C(0)))
+        ? static_cast<tick_type>(local::os_task_list()[my_heap[0U]].my_timer.get_tick() - timepoint)
+        : (std::numeric_limits<tick_type>::max)());
+  }
+
+private:
+  std::array<task_index_type, OS_TASK_COUNT> my_heap { };
+  std::size_t                                my_size { };
+
+  static auto is_before(const task_index_type index_a, const task_index_type index_b) -> bool
+  {
+    const auto& task_list = local::os_task_list();
+
+    // The deadline of task a precedes the deadline of task b if task b
+    // would not yet have timed out at the timepoint of task a's deadline.
+    // This comparison is also correct across the wraparound of the timer.
+    return (!task_list[index_b].my_timer.timeout_of_specific_timepoint(task_list[index_a].my_timer.get_tick()));
+  }
+
+  auto pop() -> void
+  {
+    --my_size;
+
+    const auto task_index_last = my_heap[my_size];
+
+    auto parent = static_cast<std::size_t>(UINT8_C(0));
+
+    // Sift the last deadline down from the root of the heap.
+    for(;;)
+    {
+      auto child = static_cast<std::size_t>((parent * 2U) + 1U);
+
+      if(child >= my_size)
+      {
+        break;
+      }
+
+      if(((child + 1U) < my_size) && is_before(my_heap[child + 1U], my_heap[child]))
+      {
+        ++child;
+      }
+
+      if(!is_before(my_heap[child], task_index_last))
+      {
+        break;
+      }
+
+      my_heap[parent] = my_heap[child];
+
+      parent = child;
+    }
+
+    my_heap[parent] = task_index_last;
+  }
+};
+
+} // namespace detail
+} // namespace os
+
+namespace local
+{
+  os::detail::task_deadline_heap os_deadline_heap; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace local
+
 OS_NORETURN auto os::start_os() -> void
 {
   auto& task_list = local::os_task_list();
@@ -46,6 +327,15 @@ OS_NORETURN auto os::start_os() -> void
 
   static_cast<void>(it_init_func);
 
+  // Enter each cyclic task into the deadline heap.
+  for(auto task_index = static_cast<local::task_index_type>(UINT8_C(0)); task_index < static_cast<local::task_index_type>(OS_TASK_COUNT); ++task_index)
+  {
+    if(task_list[task_index].my_cycle != static_cast<os::tick_type>(UINT8_C(0)))
+    {
+      local::os_deadline_heap.push(task_index);
+    }
+  }
+
   // Initialize the idle task.
   OS_IDLE_TASK_INIT();
 
@@ -60,24 +350,48 @@ OS_NORETURN auto os::start_os() -> void
 
     const os::tick_type timepoint_of_ckeck_ready = os::timer_type::get_mark();
 
-    local::os_task_index = static_cast<local::task_index_type>(0U);
+    local::os_task_post_merge(local::os_task_ready);
+
+    local::os_deadline_heap.expire(timepoint_of_ckeck_ready, local::os_task_ready, local::os_task_timeout);
+
+    // The ready task having the lowest index (i.e., the highest priority)
+    // is found in constant time with count-trailing-zeros operations.
+    const auto index_of_ready_task = local::os_task_ready.find_first();
 
-    const auto it_ready_task = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-      std::find_if(task_list.begin(),
-                   task_list.end(),
-                   [&timepoint_of_ckeck_ready](task_control_block& tcb) // NOLINT(modernize-use-trailing-return-type)
-                   {
-                     const auto task_is_ready = tcb.execute(timepoint_of_ckeck_ready);
+    if(index_of_ready_task < local::task_bitmap_type::bit_count)
+    {
+      local::os_task_index = static_cast<local::task_index_type>(index_of_ready_task);
+
+      auto& the_tcb = task_list[index_of_ready_task];
+
+      static_cast<void>(the_tcb.execute(timepoint_of_ckeck_ready));
 
-                     ++local::os_task_index;
+      // The task remains ready as long as it has an event. An event
+      // that is set after this check is posted and merged again.
+      if(os::detail::atomic_load(the_tcb.my_event) == static_cast<event_type>(UINT8_C(0)))
+      {
+        local::os_task_ready.reset(index_of_ready_task);
+      }
 
-                     return task_is_ready;
-                   });
+      // The task's interval timer has been restarted in execute().
+      // Re-enter the task into the deadline heap.
+      if(local::os_task_timeout.test(index_of_ready_task))
+      {
+        local::os_task_timeout.reset(index_of_ready_task);
 
-    // If no ready-task was found, then service the idle task.
-    if(it_ready_task == task_list.end())
+        local::os_deadline_heap.push(local::os_task_index);
+      }
+
+      local::os_task_index = static_cast<local::task_index_type>(OS_TASK_COUNT);
+    }
+    else
     {
+      // If no ready-task was found, then service the idle task.
       OS_IDLE_TASK_FUNC();
+
+      // Let the idle task sleep until the earliest task deadline
+      // or until an event is set, whichever comes first.
+      OS_IDLE_TASK_SLEEP(local::os_deadline_heap.ticks_until_next_deadline(timepoint_of_ckeck_ready));
     }
   }
 }
@@ -96,11 +410,19 @@ auto os::set_event(const task_id_type task_id, const event_type& event_to_set) -
                              + static_cast<local::task_list_type::size_type>(task_id));
 
     // Set the event of the corresponding task.
-    mcal::irq::disable_all();
+    const auto previous_event = os::detail::atomic_fetch_or(it_task_id->my_event, event_to_set);
 
-    it_task_id->my_event |= event_to_set;
+    if(static_cast<event_type>(previous_event | event_to_set) != static_cast<event_type>(UINT8_C(0)))
+    {
+      // Post the task to the scheduler.
+      const auto task_index = static_cast<std::size_t>(task_id);
+
+      static_cast<void>(os::detail::atomic_fetch_or(local::os_task_posted[static_cast<std::size_t>(task_index / local::task_post_word_digits)],
+                                                    local::os_task_post_mask(task_index)));
+    }
 
-    mcal::irq::enable_all();
+    // Wake up the idle task (if it is sleeping) so that the event is handled.
+    OS_IDLE_TASK_WAKEUP();
 
     result_set_is_ok = true;
   }
@@ -108,6 +430,71 @@ auto os::set_event(const task_id_type task_id, const event_type& event_to_set) -
   return result_set_is_ok;
 }
 
+auto os::post_event_from_isr(const task_id_type* task_ids_first,
+                             const task_id_type* task_ids_last,
+                             const event_type&   event_to_set) -> bool
+{
+  auto result_post_is_ok = true;
+
+  auto& task_list = local::os_task_list();
+
+  // Collect the posted tasks locally, so that each word of the
+  // shared set of posted tasks is updated only once per call.
+  local::task_post_list_type task_post_list { };
+
+  for(auto it_task_id = task_ids_first; it_task_id != task_ids_last; ++it_task_id) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  {
+    if(*it_task_id < task_id_type::task_id_end)
+    {
+      const auto task_index = static_cast<std::size_t>(*it_task_id);
+
+      const auto previous_event = os::detail::atomic_fetch_or(task_list[task_index].my_event, event_to_set);
+
+      if(static_cast<event_type>(previous_event | event_to_set) != static_cast<event_type>(UINT8_C(0)))
+      {
+        local::os_task_post(task_post_list, task_index);
+      }
+    }
+    else
+    {
+      result_post_is_ok = false;
+    }
+  }
+
+  for(auto word_index = static_cast<std::size_t>(UINT8_C(0)); word_index < local::task_post_word_count; ++word_index)
+  {
+    if(task_post_list[word_index] != static_cast<local::task_post_word_type>(UINT8_C(0)))
+    {
+      static_cast<void>(os::detail::atomic_fetch_or(local::os_task_posted[word_index], task_post_list[word_index]));
+    }
+  }
+
+  // Wake up the idle task (if it is sleeping) once for all of the events.
+  OS_IDLE_TASK_WAKEUP();
+
+  return result_post_is_ok;
+}
+
+auto os::get_task_profile(const task_id_type task_id, task_profile_type& profile_to_get) -> bool
+{
+  #if defined(OS_CFG_TASK_PROFILE)
+  if(task_id < task_id_type::task_id_end)
+  {
+    // The profile is only modified by the scheduler, and
+    // it is, therefore, consistent when read from a task.
+    profile_to_get = local::os_task_list()[static_cast<local::task_list_type::size_type>(task_id)].my_profile;
+
+    return true;
+  }
+  #else
+  static_cast<void>(task_id);
+  #endif
+
+  profile_to_get = task_profile_type { };
+
+  return false;
+}
+
 auto os::get_event(event_type& event_to_get) -> void
 {
   const auto& task_list = local::os_task_list();
@@ -118,13 +505,7 @@ auto os::get_event(event_type& event_to_get) -> void
   if(it_running_task != task_list.cend())
   {
     // Get the event of the running task.
-    mcal::irq::disable_all();
-
-    const volatile event_type the_event = it_running_task->my_event;
-
-    mcal::irq::enable_all();
-
-    event_to_get = the_event;
+    event_to_get = os::detail::atomic_load(it_running_task->my_event);
   }
   else
   {
@@ -141,13 +522,9 @@ auto os::clear_event(const event_type& event_to_clear) -> void
 
   if(it_running_task != task_list.end())
   {
-    volatile const auto event_clear_mask = static_cast<event_type>(~event_to_clear);
-
     // Clear the event of the running task.
-    mcal::irq::disable_all();
-
-    it_running_task->my_event = static_cast<event_type>(it_running_task->my_event & event_clear_mask);
-
-    mcal::irq::enable_all();
+    static_cast<void>(os::detail::atomic_fetch_and(it_running_task->my_event, static_cast<event_type>(~event_to_clear)));
   }
 }
+
+#endif // OS_CFG_EXECUTOR_WORKER_COUNT
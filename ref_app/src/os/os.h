@@ -9,6 +9,7 @@
   #define OS_2011_10_20_H
 
   #include <os/os_cfg.h>
+  #include <os/os_task_profile.h>
   #include <util/utility/util_time.h>
 
   #include <cstdint>
@@ -26,6 +27,17 @@
     auto set_event  (const task_id_type task_id, const event_type& event_to_set) -> bool;
     auto get_event  (event_type& event_to_get) -> void;
     auto clear_event(const event_type& event_to_clear) -> void;
+
+    // Set the event of each task in the range of task IDs in one call,
+    // with a single wakeup of the scheduler. This is intended to be
+    // called from an interrupt service routine.
+    auto post_event_from_isr(const task_id_type* task_ids_first,
+                             const task_id_type* task_ids_last,
+                             const event_type&   event_to_set) -> bool;
+
+    // Get the runtime profile of a task. This returns false (and an empty
+    // profile) if OS_CFG_TASK_PROFILE is not defined.
+    auto get_task_profile(const task_id_type task_id, task_profile_type& profile_to_get) -> bool;
   } // namespace os
 
 #endif // OS_2011_10_20_H
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef OS_ATOMIC_2026_10_17_H
+  #define OS_ATOMIC_2026_10_17_H
+
+  // Atomic operations on the words that are shared between the scheduler
+  // and the tasks or interrupts that set events. These are lock-free on
+  // targets for which the compiler guarantees lock-free atomics. Otherwise,
+  // each operation falls back to a short interrupt-disable critical section.
+
+  #include <mcal_irq.h>
+
+  #if (defined(__GNUC__) && defined(__GCC_ATOMIC_INT_LOCK_FREE) && !defined(OS_CFG_ATOMIC_DISABLE))
+  #if (__GCC_ATOMIC_INT_LOCK_FREE == 2)
+  #define OS_ATOMIC_IS_LOCK_FREE
+  #endif
+  #endif
+
+  namespace os { namespace detail {
+
+  #if defined(OS_ATOMIC_IS_LOCK_FREE)
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_load(const UnsignedIntegralType& word) noexcept -> UnsignedIntegralType
+  {
+    static_assert(__atomic_always_lock_free(sizeof(UnsignedIntegralType), nullptr), "the atomic word must be lock-free");
+
+    return __atomic_load_n(&word, __ATOMIC_ACQUIRE);
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_exchange(UnsignedIntegralType& word, const UnsignedIntegralType value) noexcept -> UnsignedIntegralType
+  {
+    static_assert(__atomic_always_lock_free(sizeof(UnsignedIntegralType), nullptr), "the atomic word must be lock-free");
+
+    return __atomic_exchange_n(&word, value, __ATOMIC_ACQ_REL);
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_fetch_or(UnsignedIntegralType& word, const UnsignedIntegralType mask) noexcept -> UnsignedIntegralType
+  {
+    static_assert(__atomic_always_lock_free(sizeof(UnsignedIntegralType), nullptr), "the atomic word must be lock-free");
+
+    return __atomic_fetch_or(&word, mask, __ATOMIC_ACQ_REL);
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_fetch_and(UnsignedIntegralType& word, const UnsignedIntegralType mask) noexcept -> UnsignedIntegralType
+  {
+    static_assert(__atomic_always_lock_free(sizeof(UnsignedIntegralType), nullptr), "the atomic word must be lock-free");
+
+    return __atomic_fetch_and(&word, mask, __ATOMIC_ACQ_REL);
+  }
+
+  #else
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_load(const UnsignedIntegralType& word) noexcept -> UnsignedIntegralType
+  {
+    mcal::irq::disable_all();
+
+    const volatile UnsignedIntegralType value = word;
+
+    mcal::irq::enable_all();
+
+    return value;
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_exchange(UnsignedIntegralType& word, const UnsignedIntegralType value) noexcept -> UnsignedIntegralType
+  {
+    mcal::irq::disable_all();
+
+    const volatile UnsignedIntegralType previous = word;
+
+    word = value;
+
+    mcal::irq::enable_all();
+
+    return previous;
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_fetch_or(UnsignedIntegralType& word, const UnsignedIntegralType mask) noexcept -> UnsignedIntegralType
+  {
+    mcal::irq::disable_all();
+
+    const volatile UnsignedIntegralType previous = word;
+
+    word = static_cast<UnsignedIntegralType>(previous | mask);
+
+    mcal::irq::enable_all();
+
+    return previous;
+  }
+
+  template<typename UnsignedIntegralType>
+  inline auto atomic_fetch_and(UnsignedIntegralType& word, const UnsignedIntegralType mask) noexcept -> UnsignedIntegralType
+  {
+    mcal::irq::disable_all();
+
+    const volatile UnsignedIntegralType previous = word;
+
+    word = static_cast<UnsignedIntegralType>(previous & mask);
+
+    mcal::irq::enable_all();
+
+    return previous;
+  }
+
+  #endif
+
+  } // namespace detail
+  } // namespace os
+
+#endif // OS_ATOMIC_2026_10_17_H
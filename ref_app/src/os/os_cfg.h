@@ -8,6 +8,7 @@
 #ifndef OS_CFG_2011_10_20_H
   #define OS_CFG_2011_10_20_H
 
+  #include <mcal_cpu.h>
   #include <util/utility/util_time.h>
 
   #include <cstddef>
@@ -26,6 +27,17 @@
   #define OS_IDLE_TASK_INIT() sys::idle::task_init()
   #define OS_IDLE_TASK_FUNC() sys::idle::task_func()
 
+  // Define symbols for the tickless idle. When no task is ready, the idle
+  // task sleeps until the next task deadline or until an event is set.
+  // On targets without idle-sleep support, these symbols are empty.
+  #if defined(MCAL_CPU_HAS_IDLE_SLEEP)
+  #define OS_IDLE_TASK_SLEEP(ticks) mcal::cpu::idle_sleep(static_cast<std::uint32_t>(ticks))
+  #define OS_IDLE_TASK_WAKEUP()     mcal::cpu::idle_wakeup()
+  #else
+  #define OS_IDLE_TASK_SLEEP(ticks)
+  #define OS_IDLE_TASK_WAKEUP()
+  #endif
+
   // Declare all of the task initializations and the task functions.
   namespace app { namespace led {
 
@@ -85,6 +97,21 @@
   //  4201, 4409, 4637, 4831, 5039, 5279, 5483, 5693, 5881, 6133, 6337,
   //  6571, 6793, 6997, 7237, 7499, 7687, 7919
 
+  // Optionally collect the runtime profile of each task in the scheduler
+  // (call counts, run times and timer lateness), as reported by sys::mon.
+  // This costs RAM for each task and two timer reads for each dispatch.
+  // It is enabled in the host builds with -DOS_CFG_TASK_PROFILE.
+  //#define OS_CFG_TASK_PROFILE
+
+  // Optionally run the tasks on a multi-threaded executor with the
+  // given number of worker threads. This is supported on the host only.
+  // The executor does not collect the task profile.
+  //#define OS_CFG_EXECUTOR_WORKER_COUNT 4
+
+  #if (defined(OS_CFG_EXECUTOR_WORKER_COUNT) && defined(OS_CFG_TASK_PROFILE))
+  #error OS_CFG_TASK_PROFILE is not supported with OS_CFG_EXECUTOR_WORKER_COUNT. Remove one of the two definitions.
+  #endif
+
   constexpr auto OS_TASK_COUNT = static_cast<std::size_t>(os::task_id_type::task_id_end);
 
   #define OS_TASK_LIST                                                                            \
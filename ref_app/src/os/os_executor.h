@@ -0,0 +1,351 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef OS_EXECUTOR_2026_10_17_H
+  #define OS_EXECUTOR_2026_10_17_H
+
+  // A multi-threaded executor for the task model of the operating system.
+  // This executor is intended for the host only. The cyclic tasks are
+  // partitioned among the worker threads. Event-triggered tasks are
+  // pushed onto per-worker deques, from which idle workers steal.
+  // A task function never runs concurrently with itself.
+
+  #include <os/os_task_control_block.h>
+
+  #include <algorithm>
+  #include <array>
+  #include <atomic>
+  #include <chrono>
+  #include <condition_variable>
+  #include <cstddef>
+  #include <cstdint>
+  #include <deque>
+  #include <limits>
+  #include <memory>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+
+  namespace os
+  {
+    template<const std::size_t TaskCount>
+    class executor final
+    {
+    public:
+      using task_list_type = std::array<task_control_block, TaskCount>;
+
+      static constexpr auto task_count = TaskCount;
+
+      explicit executor(const task_list_type& task_list,
+                        const std::size_t worker_count = static_cast<std::size_t>(std::thread::hardware_concurrency()))
+        : my_worker_count((worker_count != static_cast<std::size_t>(UINT8_C(0))) ? worker_count : static_cast<std::size_t>(UINT8_C(1)))
+      {
+        for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < task_count; ++index)
+        {
+          my_tasks[index].my_tcb = &task_list[index];
+          my_tasks[index].my_timer = task_list[index].my_timer;
+          my_tasks[index].my_deadline.store(task_list[index].my_timer.get_tick());
+        }
+
+        for(auto worker = static_cast<std::size_t>(UINT8_C(0)); worker < my_worker_count; ++worker)
+        {
+          my_workers.emplace_back(new worker_type { }); // NOLINT(cppcoreguidelines-owning-memory)
+        }
+      }
+
+      executor() = delete;
+      executor(const executor&) = delete;
+      executor(executor&&) = delete;
+
+      ~executor() { stop(); }
+
+      auto operator=(const executor&) -> executor& = delete;
+      auto operator=(executor&&) -> executor& = delete;
+
+      auto worker_count() const noexcept -> std::size_t { return my_worker_count; }
+
+      // Initialize each task and start the worker threads.
+      auto start() -> void
+      {
+        for(const auto& task : my_tasks)
+        {
+          task.my_tcb->initialize();
+        }
+
+        my_stop.store(false);
+
+        for(auto worker = static_cast<std::size_t>(UINT8_C(0)); worker < my_worker_count; ++worker)
+        {
+          my_threads.emplace_back([this, worker]() { worker_function(worker); });
+        }
+      }
+
+      auto stop() -> void
+      {
+        my_stop.store(true);
+
+        {
+          const std::lock_guard<std::mutex> lock(my_idle_mutex);
+        }
+
+        my_idle_condition.notify_all();
+
+        for(auto& thread : my_threads)
+        {
+          if(thread.joinable()) { thread.join(); }
+        }
+
+        my_threads.clear();
+      }
+
+      auto set_event(const std::size_t task_index, const event_type& event_to_set) -> bool
+      {
+        if(task_index >= task_count)
+        {
+          return false;
+        }
+
+        auto& task = my_tasks[task_index];
+
+        static_cast<void>(task.my_event.fetch_or(event_to_set));
+
+        // Schedule the task unless it is already queued or running.
+        // In the latter case, the worker re-schedules the task upon
+        // completion if its event is still set.
+        if(!task.my_in_flight.test_and_set())
+        {
+          enqueue(task_index);
+        }
+
+        return true;
+      }
+
+      auto get_event(event_type& event_to_get) const -> void
+      {
+        event_to_get = ((my_current_task < task_count) ? my_tasks[my_current_task].my_event.load() : event_type { });
+      }
+
+      auto clear_event(const event_type& event_to_clear) -> void
+      {
+        if(my_current_task < task_count)
+        {
+          static_cast<void>(my_tasks[my_current_task].my_event.fetch_and(static_cast<event_type>(~event_to_clear)));
+        }
+      }
+
+      // Get the ticks from the timepoint until the earliest deadline
+      // of the cyclic tasks, or the maximum tick value if there is none.
+      auto ticks_until_next_deadline(const tick_type& timepoint) const -> tick_type
+      {
+        return ticks_until_next_deadline(timepoint, static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)));
+      }
+
+    private:
+      struct task_type
+      {
+        const task_control_block* my_tcb { nullptr };
+        timer_type                my_timer { };
+        std::atomic<tick_type>    my_deadline { }; // The timer's deadline, for the other threads.
+        std::atomic<event_type>   my_event { };
+        std::atomic_flag          my_in_flight = ATOMIC_FLAG_INIT;
+      };
+
+      struct worker_type
+      {
+        std::mutex              my_mutex;
+        std::deque<std::size_t> my_queue;
+      };
+
+      const std::size_t                         my_worker_count;
+      std::array<task_type, task_count>         my_tasks { };
+      std::vector<std::unique_ptr<worker_type>> my_workers;
+      std::vector<std::thread>                  my_threads;
+      std::atomic<bool>                         my_stop { true };
+      std::atomic<std::size_t>                  my_queued_count { };
+      std::atomic<std::size_t>                  my_sleeping_count { };
+      std::mutex                                my_idle_mutex;
+      std::condition_variable                   my_idle_condition;
+
+      static thread_local std::size_t my_current_task;
+      static thread_local std::size_t my_current_worker;
+
+      auto ticks_until_next_deadline(const tick_type& timepoint, const std::size_t first, const std::size_t stride) const -> tick_type
+      {
+        auto ticks_min = (std::numeric_limits<tick_type>::max)();
+
+        for(auto index = first; index < task_count; index += stride)
+        {
+          const auto& task = my_tasks[index];
+
+          if(task.my_tcb->my_cycle != static_cast<tick_type>(UINT8_C(0)))
+          {
+            const auto ticks = static_cast<tick_type>(task.my_deadline.load() - timepoint);
+
+            // A deadline that lies in the past has wrapped around.
+            ticks_min = (std::min)(ticks_min, ((ticks > static_cast<tick_type>((std::numeric_limits<tick_type>::max)() / 2U)) ? static_cast<tick_type>(UINT8_C(0)) : ticks));
+          }
+        }
+
+        return ticks_min;
+      }
+
+      auto enqueue(const std::size_t task_index) -> void
+      {
+        // Push the task onto the deque of the calling worker,
+        // or onto the deque of the task's own worker otherwise.
+        const auto worker = ((my_current_worker < my_worker_count) ? my_current_worker : static_cast<std::size_t>(task_index % my_worker_count));
+
+        {
+          const std::lock_guard<std::mutex> lock(my_workers[worker]->my_mutex);
+
+          my_workers[worker]->my_queue.push_back(task_index);
+        }
+
+        static_cast<void>(++my_queued_count);
+
+        if(my_sleeping_count.load() != static_cast<std::size_t>(UINT8_C(0)))
+        {
+          {
+            const std::lock_guard<std::mutex> lock(my_idle_mutex);
+          }
+
+          my_idle_condition.notify_one();
+        }
+      }
+
+      auto dequeue(const std::size_t worker, std::size_t& task_index) -> bool
+      {
+        // Pop from the back of the own deque first. Then try to steal
+        // from the front of the other deques.
+        for(auto offset = static_cast<std::size_t>(UINT8_C(0)); offset < my_worker_count; ++offset)
+        {
+          auto& victim = *my_workers[(worker + offset) % my_worker_count];
+
+          const std::lock_guard<std::mutex> lock(victim.my_mutex);
+
+          if(!victim.my_queue.empty())
+          {
+            if(offset == static_cast<std::size_t>(UINT8_C(0)))
+            {
+              task_index = victim.my_queue.back();
+
+              victim.my_queue.pop_back();
+            }
+            else
+            {
+              task_index = victim.my_queue.front();
+
+              victim.my_queue.pop_front();
+            }
+
+            static_cast<void>(--my_queued_count);
+
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      auto run(const std::size_t task_index) -> void
+      {
+        auto& task = my_tasks[task_index];
+
+        my_current_task = task_index;
+
+        task.my_tcb->my_func();
+
+        my_current_task = task_count;
+
+        task.my_in_flight.clear();
+
+        // The task remains ready as long as it has an event.
+        if(   (task.my_event.load() != static_cast<event_type>(UINT8_C(0)))
+           && (!task.my_in_flight.test_and_set()))
+        {
+          enqueue(task_index);
+        }
+      }
+
+      auto worker_function(const std::size_t worker) -> void
+      {
+        my_current_worker = worker;
+
+        while(!my_stop.load())
+        {
+          auto did_work = false;
+
+          // Service the cyclic tasks in this worker's partition.
+          const auto timepoint_of_ckeck_ready = timer_type::get_mark();
+
+          for(auto index = worker; index < task_count; index += my_worker_count)
+          {
+            auto& task = my_tasks[index];
+
+            if(   (task.my_tcb->my_cycle != static_cast<tick_type>(UINT8_C(0)))
+               &&  task.my_timer.timeout_of_specific_timepoint(timepoint_of_ckeck_ready)
+               && (!task.my_in_flight.test_and_set()))
+            {
+              task.my_timer.start_interval(task.my_tcb->my_cycle);
+
+              task.my_deadline.store(task.my_timer.get_tick());
+
+              run(index);
+
+              did_work = true;
+            }
+          }
+
+          // Service the event-triggered tasks.
+          auto task_index = std::size_t { };
+
+          if(dequeue(worker, task_index))
+          {
+            run(task_index);
+
+            did_work = true;
+          }
+
+          if(!did_work)
+          {
+            // Sleep until the earliest deadline in this worker's partition
+            // or until a task is queued. The sleep is limited for a worker
+            // whose partition has no cyclic task.
+            constexpr auto worker_sleep_max = timer_type::seconds(static_cast<unsigned>(UINT8_C(1)));
+
+            const auto ticks_to_sleep =
+              (std::min)(ticks_until_next_deadline(timer_type::get_mark(), worker, my_worker_count), worker_sleep_max);
+
+            static_cast<void>(++my_sleeping_count);
+
+            {
+              std::unique_lock<std::mutex> lock(my_idle_mutex);
+
+              static_cast<void>
+              (
+                my_idle_condition.wait_for(lock,
+                                           std::chrono::microseconds(ticks_to_sleep),
+                                           [this]() { return (my_stop.load() || (my_queued_count.load() != static_cast<std::size_t>(UINT8_C(0)))); })
+              );
+            }
+
+            static_cast<void>(--my_sleeping_count);
+          }
+        }
+
+        my_current_worker = static_cast<std::size_t>(-1);
+      }
+    };
+
+    template<const std::size_t TaskCount>
+    thread_local std::size_t executor<TaskCount>::my_current_task = TaskCount;
+
+    template<const std::size_t TaskCount>
+    thread_local std::size_t executor<TaskCount>::my_current_worker = static_cast<std::size_t>(-1);
+  } // namespace os
+
+#endif // OS_EXECUTOR_2026_10_17_H
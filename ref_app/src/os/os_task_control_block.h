@@ -9,6 +9,7 @@
   #define OS_TASK_CONTROL_BLOCK_2013_07_30_H
 
   #include <os/os.h>
+  #include <os/os_atomic.h>
 
   #include <cstddef>
   #include <cstdint>
@@ -16,6 +17,10 @@
 
   namespace os
   {
+    namespace detail { class task_deadline_heap; }
+
+    template<const std::size_t TaskCount> class executor;
+
     class task_control_block final
     {
     public:
@@ -46,17 +51,21 @@
             timer_type    my_timer;
             event_type    my_event { };
 
+      #if defined(OS_CFG_TASK_PROFILE)
+      task_profile_type my_profile { };
+      #endif
+
       auto initialize() const -> void { my_init(); }
 
       auto execute(const tick_type& timepoint_of_ckeck_ready) -> bool
       {
         // Check for a task event.
-        const auto task_does_have_event = (my_event != static_cast<event_type>(UINT8_C(0)));
+        const auto task_does_have_event = (detail::atomic_load(my_event) != static_cast<event_type>(UINT8_C(0)));
 
         if(task_does_have_event)
         {
           // Call the task function because of an event.
-          my_func();
+          call(false);
         }
 
         // Check for a task timeout.
@@ -65,20 +74,47 @@
 
         if(task_does_have_timeout)
         {
+          #if defined(OS_CFG_TASK_PROFILE)
+          my_profile.record_lateness(static_cast<tick_type>(timepoint_of_ckeck_ready - my_timer.get_tick()));
+          #endif
+
           // Increment the task's interval timer with the task cycle.
           my_timer.start_interval(my_cycle);
 
           // Call the task function because of a timer timeout.
-          my_func();
+          call(true);
         }
 
         return (task_does_have_event || task_does_have_timeout);
       }
 
+      auto call(const bool is_timeout) -> void
+      {
+        #if defined(OS_CFG_TASK_PROFILE)
+        const auto timepoint_of_call = timer_type::get_mark();
+
+        my_func();
+
+        my_profile.record_run(static_cast<tick_type>(timer_type::get_mark() - timepoint_of_call), is_timeout);
+        #else
+        static_cast<void>(is_timeout);
+
+        my_func();
+        #endif
+      }
+
       friend auto start_os   () -> void;
       friend auto set_event  (const task_id_type, const event_type&) -> bool;
       friend auto get_event  (event_type&) -> void;
       friend auto clear_event(const event_type&) -> void;
+
+      friend auto post_event_from_isr(const task_id_type*, const task_id_type*, const event_type&) -> bool;
+      friend auto get_task_profile(const task_id_type, task_profile_type&) -> bool;
+
+      friend class detail::task_deadline_heap;
+
+      template<const std::size_t TaskCount>
+      friend class executor;
     };
   } // namespace os
 
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef OS_TASK_PROFILE_2026_10_17_H
+  #define OS_TASK_PROFILE_2026_10_17_H
+
+  #include <os/os_cfg.h>
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+
+  namespace os
+  {
+    // The runtime profile of a task, in the microsecond ticks of the
+    // operating system timer. This is collected by the scheduler when
+    // OS_CFG_TASK_PROFILE is defined. The totals wrap around, so they
+    // should be evaluated as differences between two snapshots.
+
+    struct task_profile_type
+    {
+      // The timer lateness histogram has bins that grow by powers of four:
+      // [0, 4), [4, 16), [16, 64), ... [4096, 16384), [16384, inf) microseconds.
+      static constexpr auto lateness_bin_count = static_cast<std::size_t>(UINT8_C(8));
+
+      using count_type     = std::uint32_t;
+      using histogram_type = std::array<std::uint16_t, lateness_bin_count>;
+
+      count_type     call_count     { };
+      count_type     event_count    { };
+      count_type     timeout_count  { };
+      tick_type      run_time_total { };
+      tick_type      run_time_max   { };
+      histogram_type lateness       { };
+
+      auto record_run(const tick_type run_time, const bool is_timeout) noexcept -> void
+      {
+        ++call_count;
+
+        if(is_timeout) { ++timeout_count; } else { ++event_count; }
+
+        run_time_total = static_cast<tick_type>(run_time_total + run_time);
+
+        if(run_time > run_time_max) { run_time_max = run_time; }
+      }
+
+      auto record_lateness(const tick_type lateness_ticks) noexcept -> void
+      {
+        auto bin = static_cast<std::size_t>(UINT8_C(0));
+
+        for(auto threshold = static_cast<tick_type>(UINT8_C(4)); ((bin + 1U) < lateness_bin_count) && (lateness_ticks >= threshold); threshold = static_cast<tick_type>(threshold * 4U))
+        {
+          ++bin;
+        }
+
+        // Saturate the count of the bin.
+        if(lateness[bin] < (std::numeric_limits<histogram_type::value_type>::max)())
+        {
+          ++lateness[bin];
+        }
+      }
+    };
+  } // namespace os
+
+#endif // OS_TASK_PROFILE_2026_10_17_H
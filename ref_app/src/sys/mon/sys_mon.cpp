@@ -1,10 +1,13 @@
 ///////////////////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2007 - 2022.
+//  Copyright Christopher Kormanyos 2007 - 2026.
 //  Distributed under the Boost Software License,
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <sys/mon/sys_mon.h>
+
+#include <cstddef>
 
 namespace sys { namespace mon {
 
@@ -14,12 +17,56 @@ auto task_func() -> void;
 } // namespace mon
 } // namespace sys
 
+namespace local
+{
+  sys::mon::snapshot_type sys_mon_snapshot; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  #if defined(OS_CFG_TASK_PROFILE)
+  os::tick_type sys_mon_timepoint_of_last_snapshot; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  #endif
+} // namespace local
+
+auto sys::mon::get_snapshot() -> const snapshot_type&
+{
+  return local::sys_mon_snapshot;
+}
+
 auto sys::mon::task_init() -> void
 {
-  // Subroutine is empty on purpose.
+  #if defined(OS_CFG_TASK_PROFILE)
+  local::sys_mon_timepoint_of_last_snapshot = os::timer_type::get_mark();
+  #endif
 }
 
 auto sys::mon::task_func() -> void
 {
-  // Subroutine is empty on purpose.
+  #if defined(OS_CFG_TASK_PROFILE)
+  const auto timepoint_of_snapshot = os::timer_type::get_mark();
+
+  auto& snapshot = local::sys_mon_snapshot;
+
+  // Sum up the run times of all tasks since the last snapshot.
+  auto run_time_of_interval = static_cast<os::tick_type>(UINT8_C(0));
+
+  for(auto task_index = static_cast<std::size_t>(UINT8_C(0)); task_index < OS_TASK_COUNT; ++task_index)
+  {
+    const auto run_time_total_prev = snapshot.task_profile[task_index].run_time_total;
+
+    static_cast<void>(os::get_task_profile(static_cast<os::task_id_type>(task_index), snapshot.task_profile[task_index]));
+
+    run_time_of_interval = static_cast<os::tick_type>(run_time_of_interval + static_cast<os::tick_type>(snapshot.task_profile[task_index].run_time_total - run_time_total_prev));
+  }
+
+  snapshot.interval = static_cast<os::tick_type>(timepoint_of_snapshot - local::sys_mon_timepoint_of_last_snapshot);
+
+  snapshot.cpu_load =
+    static_cast<std::uint16_t>
+    (
+      (snapshot.interval != static_cast<os::tick_type>(UINT8_C(0)))
+        ? static_cast<std::uint16_t>((static_cast<std::uint64_t>(run_time_of_interval) * UINT16_C(1000)) / static_cast<std::uint64_t>(snapshot.interval))
+        : static_cast<std::uint16_t>(UINT8_C(0))
+    );
+
+  local::sys_mon_timepoint_of_last_snapshot = timepoint_of_snapshot;
+  #endif
 }
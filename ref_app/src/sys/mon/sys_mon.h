@@ -0,0 +1,35 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SYS_MON_2026_10_17_H
+  #define SYS_MON_2026_10_17_H
+
+  #include <os/os.h>
+
+  #include <array>
+  #include <cstdint>
+
+  namespace sys { namespace mon {
+
+  // A compact snapshot of the runtime profile of all tasks, which is
+  // refreshed in each cycle of the monitor task. The CPU load is the
+  // sum of the task run times over the last monitor interval, in per mille.
+  // The snapshot remains empty if OS_CFG_TASK_PROFILE is not defined.
+
+  struct snapshot_type
+  {
+    std::array<os::task_profile_type, OS_TASK_COUNT> task_profile { };
+    os::tick_type                                    interval     { };
+    std::uint16_t                                    cpu_load     { };
+  };
+
+  auto get_snapshot() -> const snapshot_type&;
+
+  } // namespace mon
+  } // namespace sys
+
+#endif // SYS_MON_2026_10_17_H
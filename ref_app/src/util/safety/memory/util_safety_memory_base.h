@@ -34,10 +34,15 @@
 
         result_type result_of_process;
 
-        memory_base(const memory_list_type& memory_blocks);
+        // The memory is processed in spans of up to bytes_per_service
+        // bytes in each call of service(). The default of one byte per
+        // call gives the shortest run time of service().
+        memory_base(const memory_list_type& memory_blocks,
+                    const std::size_t bytes_per_service = static_cast<std::size_t>(1U));
 
       private:
         const memory_list_type& memory_list;
+        const std::size_t       memory_bytes_per_service;
         bool                    process_is_initialized;
         std::size_t             memory_list_index;
         std::size_t             memory_block_index;
@@ -46,19 +51,37 @@
         virtual void finalize  () = 0;
 
         virtual void process_one_byte(volatile std::uint8_t*) = 0;
+
+        // Process a span of memory. Derived classes that can handle
+        // an entire span at once override this function, which avoids
+        // a virtual call per byte. The default processes the span
+        // one byte at a time.
+        virtual void process_bytes(const memory_address_type address, const std::size_t count);
       };
     }
   }
 
   template<typename memory_address_type, const std::size_t memory_list_count>
   util::safety::memory_base<memory_address_type,
-                            memory_list_count>::memory_base(const memory_list_type& memory_blocks)
-    : result_of_process     (result_is_undetermined),
-      memory_list           (memory_blocks),
-      process_is_initialized(false),
-      memory_list_index     (0U),
-      memory_block_index    (0U)
+                            memory_list_count>::memory_base(const memory_list_type& memory_blocks,
+                                                            const std::size_t bytes_per_service)
+    : result_of_process       (result_is_undetermined),
+      memory_list             (memory_blocks),
+      memory_bytes_per_service((bytes_per_service != static_cast<std::size_t>(0U)) ? bytes_per_service : static_cast<std::size_t>(1U)),
+      process_is_initialized  (false),
+      memory_list_index       (0U),
+      memory_block_index      (0U)
+  {
+  }
+
+  template<typename memory_address_type, const std::size_t memory_list_count>
+  void util::safety::memory_base<memory_address_type, memory_list_count>::process_bytes(const memory_address_type address,
+                                                                                        const std::size_t count)
   {
+    for(std::size_t index = static_cast<std::size_t>(0U); index < count; ++index)
+    {
+      process_one_byte(reinterpret_cast<volatile std::uint8_t*>(address + index));
+    }
   }
 
   template<typename memory_address_type, const std::size_t memory_list_count>
@@ -82,13 +105,14 @@
     }
     else
     {
-      // Obtain a pointer to the next byte in the memory operation.
-      volatile std::uint8_t* pointer_to_memory = reinterpret_cast<volatile std::uint8_t*>(memory_list[memory_list_index].memory_block_start +  memory_block_index);
+      // Obtain the span of the next bytes in the memory operation.
+      const std::size_t memory_block_remaining = memory_list[memory_list_index].memory_block_size - memory_block_index;
+
+      const std::size_t count = ((memory_block_remaining < memory_bytes_per_service) ? memory_block_remaining : memory_bytes_per_service);
 
-      // Process two bytes in successive memory operations.
-      process_one_byte(pointer_to_memory);
+      process_bytes(static_cast<memory_address_type>(memory_list[memory_list_index].memory_block_start + memory_block_index), count);
 
-      ++memory_block_index;
+      memory_block_index += count;
 
       // Did we reach the end of a memory block?
       if(memory_block_index >= memory_list[memory_list_index].memory_block_size)
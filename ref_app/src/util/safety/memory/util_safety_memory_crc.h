@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_SAFETY_MEMORY_CRC_2026_10_17_H
+  #define UTIL_SAFETY_MEMORY_CRC_2026_10_17_H
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <iterator>
+
+  #if defined(UTIL_SAFETY_MEMORY_CRC_USE_THREADS)
+  #include <algorithm>
+  #include <thread>
+  #include <vector>
+
+  #include <util/utility/util_thread_executor.h>
+  #endif
+
+  namespace util { namespace safety {
+
+  // Continue the CRC register of a memory integrity check over a span
+  // of memory. The crc_engine_type is math::checksums::crc::crc_engine.
+
+  // When UTIL_SAFETY_MEMORY_CRC_USE_THREADS is defined (on a host
+  // with an operating system), large spans are divided into chunks
+  // that are processed in parallel threads. The register of each chunk
+  // is calculated from zero and the chunks are subsequently merged with
+  // the GF(2) combination of the CRC engine. Otherwise the span is
+  // processed in a single pass. The number of threads is the hardware
+  // concurrency, unless UTIL_SAFETY_MEMORY_CRC_THREAD_COUNT is defined.
+
+  constexpr auto memory_crc_minimum_chunk_size = static_cast<std::size_t>(UINT32_C(0x10000));
+
+  template<typename crc_engine_type,
+           typename input_iterator>
+  auto memory_crc_update_register(typename crc_engine_type::value_type reg,
+                                  input_iterator first,
+                                  const std::size_t count) -> typename crc_engine_type::value_type
+  {
+    using difference_type = typename std::iterator_traits<input_iterator>::difference_type;
+
+    #if defined(UTIL_SAFETY_MEMORY_CRC_USE_THREADS)
+    #if defined(UTIL_SAFETY_MEMORY_CRC_THREAD_COUNT)
+    const auto thread_count_max = static_cast<std::size_t>(UTIL_SAFETY_MEMORY_CRC_THREAD_COUNT);
+    #else
+    // Query the hardware concurrency once, since this is a system call.
+    static const auto thread_count_max = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    #endif
+
+    const auto thread_count =
+      (std::min)(thread_count_max, static_cast<std::size_t>(count / memory_crc_minimum_chunk_size));
+
+    if(thread_count > 1U)
+    {
+      using value_type = typename crc_engine_type::value_type;
+
+      const auto chunk_size = static_cast<std::size_t>(count / thread_count);
+
+      // The last chunk also takes the remainder of the division.
+      const auto chunk_length =
+        [chunk_size, count, thread_count](const std::size_t chunk) -> std::size_t
+        {
+          return ((chunk == (thread_count - 1U)) ? (count - (chunk * chunk_size)) : chunk_size);
+        };
+
+      // The first chunk continues the register. It runs on the calling
+      // thread, see util::thread_executor.
+      std::vector<value_type> chunk_registers(thread_count);
+
+      chunk_registers.front() = reg;
+
+      util::thread_executor { }
+      (
+        thread_count,
+        [&chunk_registers, &chunk_length, first, chunk_size](const std::size_t chunk)
+        {
+          const auto chunk_first = first + static_cast<difference_type>(chunk * chunk_size);
+
+          chunk_registers[chunk] =
+            crc_engine_type::update_register(chunk_registers[chunk],
+                                             chunk_first,
+                                             chunk_first + static_cast<difference_type>(chunk_length(chunk)));
+        }
+      );
+
+      reg = chunk_registers.front();
+
+      for(std::size_t chunk = 1U; chunk < thread_count; ++chunk)
+      {
+        reg = crc_engine_type::combine_register(reg, chunk_registers[chunk], static_cast<std::uintmax_t>(chunk_length(chunk)));
+      }
+
+      return reg;
+    }
+    #endif
+
+    return crc_engine_type::update_register(reg, first, first + static_cast<difference_type>(count));
+  }
+
+  } } // namespace util::safety
+
+#endif // UTIL_SAFETY_MEMORY_CRC_2026_10_17_H
@@ -1,12 +1,14 @@
 #ifndef UTIL_SAFETY_ROM_MEMORY_CHECKSUM_2013_11_27_H_
   #define UTIL_SAFETY_ROM_MEMORY_CHECKSUM_2013_11_27_H_
 
-  #include <array>
   #include <limits>
 
+  #include <math/checksums/crc/crc_engine.h>
   #include <mcal_cpu.h>
   #include <mcal_memory/mcal_memory_progmem_access.h>
+  #include <mcal_memory/mcal_memory_progmem_iterator.h>
   #include <util/safety/memory/util_safety_memory_base.h>
+  #include <util/safety/memory/util_safety_memory_crc.h>
   #include <util/utility/util_two_part_data_manipulation.h>
 
   namespace util
@@ -23,20 +25,37 @@
       // This is due to legacy calculations in the hex manipulation
       // program.
 
+      // The ROM is read in spans of bytes_per_service bytes in each
+      // call of service(), see memory_base. A larger CRC table (such
+      // as the byte-based one) can be selected with the template
+      // parameter crc_engine_type for faster checks of large ROMs.
+      // See also util_safety_memory_crc.h for the parallel processing
+      // of large spans on a host.
+
+      // The CRC-32/MPEG-2 (based on nibbles) with Init = 0.
+      using rom_memory_checksum_crc_engine_type =
+        math::checksums::crc::crc_engine<32U, UINT32_C(0x04C11DB7), UINT32_C(0), false, false, UINT32_C(0), 4U>;
+
       template<typename memory_address_type,
-               const std::size_t memory_list_count>
+               const std::size_t memory_list_count,
+               typename crc_engine_type = rom_memory_checksum_crc_engine_type>
       class rom_memory_checksum : public memory_base<memory_address_type, memory_list_count>
       {
       public:
         typedef memory_base<memory_address_type, memory_list_count> memory_base_type;
         typedef typename memory_base_type::memory_list_type memory_list_type;
 
+        static_assert(crc_engine_type::width == 32U, "Error: The ROM memory checksum uses a CRC-32");
+
         rom_memory_checksum(const memory_list_type& memory_blocks,
-                            const memory_address_type address);
+                            const memory_address_type address,
+                            const std::size_t bytes_per_service = static_cast<std::size_t>(1U));
 
         virtual ~rom_memory_checksum() { }
 
       private:
+        typedef mcal::memory::progmem::progmem_iterator<std::uint8_t, mcal_progmem_uintptr_t, mcal_progmem_ptrdiff_t> progmem_iterator_type;
+
         std::uint32_t crc32_result;
         const memory_address_type address_of_result;
 
@@ -45,38 +64,35 @@
         virtual void finalize();
 
         virtual void process_one_byte(volatile std::uint8_t* pointer_to_memory);
-      };
 
-      // The lookup table for the CRC-32/MPEG-2 (based on nibbles).
-      const std::array<std::uint32_t, 16U> crc32_lookup_table =
-      {{
-        UINT32_C(0x00000000), UINT32_C(0x04C11DB7), UINT32_C(0x09823B6E), UINT32_C(0x0D4326D9),
-        UINT32_C(0x130476DC), UINT32_C(0x17C56B6B), UINT32_C(0x1A864DB2), UINT32_C(0x1E475005),
-        UINT32_C(0x2608EDB8), UINT32_C(0x22C9F00F), UINT32_C(0x2F8AD6D6), UINT32_C(0x2B4BCB61),
-        UINT32_C(0x350C9B64), UINT32_C(0x31CD86D3), UINT32_C(0x3C8EA00A), UINT32_C(0x384fBDBD)
-      }};
+        virtual void process_bytes(const memory_address_type address, const std::size_t count);
+      };
     }
   }
 
   template<typename memory_address_type,
-           const std::size_t memory_list_count>
+           const std::size_t memory_list_count,
+           typename crc_engine_type>
   util::safety::rom_memory_checksum<memory_address_type,
-                                    memory_list_count>::rom_memory_checksum(const memory_list_type& memory_blocks,
-                                                                            const memory_address_type address)
-    : memory_base_type (memory_blocks),
+                                    memory_list_count,
+                                    crc_engine_type>::rom_memory_checksum(const memory_list_type& memory_blocks,
+                                                                          const memory_address_type address,
+                                                                          const std::size_t bytes_per_service)
+    : memory_base_type (memory_blocks, bytes_per_service),
       crc32_result     (0U),
       address_of_result(address)
   {
   }
 
   template <typename memory_address_type,
-            const std::size_t memory_list_count>
-  void util::safety::rom_memory_checksum<memory_address_type, memory_list_count>::finalize()
+            const std::size_t memory_list_count,
+            typename crc_engine_type>
+  void util::safety::rom_memory_checksum<memory_address_type, memory_list_count, crc_engine_type>::finalize()
   {
-    const std::uint8_t expected_result_byte0 = mcal::memory::progmem::read(address_of_result + 3U);
-    const std::uint8_t expected_result_byte1 = mcal::memory::progmem::read(address_of_result + 2U);
-    const std::uint8_t expected_result_byte2 = mcal::memory::progmem::read(address_of_result + 1U);
-    const std::uint8_t expected_result_byte3 = mcal::memory::progmem::read(address_of_result + 0U);
+    const std::uint8_t expected_result_byte0 = mcal::memory::progmem::read<std::uint8_t>(static_cast<mcal_progmem_uintptr_t>(address_of_result + 3U));
+    const std::uint8_t expected_result_byte1 = mcal::memory::progmem::read<std::uint8_t>(static_cast<mcal_progmem_uintptr_t>(address_of_result + 2U));
+    const std::uint8_t expected_result_byte2 = mcal::memory::progmem::read<std::uint8_t>(static_cast<mcal_progmem_uintptr_t>(address_of_result + 1U));
+    const std::uint8_t expected_result_byte3 = mcal::memory::progmem::read<std::uint8_t>(static_cast<mcal_progmem_uintptr_t>(address_of_result + 0U));
 
     const std::uint32_t expected_result =
       util::make_long(util::make_long(expected_result_byte0, expected_result_byte1),
@@ -87,8 +103,18 @@
   }
 
   template <typename memory_address_type,
-            const std::size_t memory_list_count>
-  void util::safety::rom_memory_checksum<memory_address_type, memory_list_count>::process_one_byte(volatile std::uint8_t* pointer_to_memory)
+            const std::size_t memory_list_count,
+            typename crc_engine_type>
+  void util::safety::rom_memory_checksum<memory_address_type, memory_list_count, crc_engine_type>::process_one_byte(volatile std::uint8_t* pointer_to_memory)
+  {
+    process_bytes(static_cast<memory_address_type>(reinterpret_cast<std::uintptr_t>(pointer_to_memory)), static_cast<std::size_t>(1U));
+  }
+
+  template <typename memory_address_type,
+            const std::size_t memory_list_count,
+            typename crc_engine_type>
+  void util::safety::rom_memory_checksum<memory_address_type, memory_list_count, crc_engine_type>::process_bytes(const memory_address_type address,
+                                                                                                                 const std::size_t count)
   {
     // Name   : "CRC-32/MPEG-2"
     // Width  : 32
@@ -99,11 +125,10 @@
     // XorOut : 0x00000000
     // Check  : 0x89A1897F (Result of the crc32 of the string data "123456789")
 
-    const std::uint8_t the_byte = mcal::cpu::read_program_memory(pointer_to_memory);
+    // The bytes are read from the program memory with the progmem iterator.
+    const progmem_iterator_type first(static_cast<mcal_progmem_uintptr_t>(address));
 
-    // First calculate the lower 4 bits, then calculate the upper 4 bits.
-    crc32_result = std::uint32_t(crc32_result << 4) ^ crc32_lookup_table[std::uint_fast8_t((std::uint_fast8_t(crc32_result >> 28) & UINT8_C(0x0F)) ^ (std::uint_fast8_t(the_byte >>    4 )))];
-    crc32_result = std::uint32_t(crc32_result << 4) ^ crc32_lookup_table[std::uint_fast8_t((std::uint_fast8_t(crc32_result >> 28) & UINT8_C(0x0F)) ^ (std::uint_fast8_t(the_byte &  0x0FU)))];
+    crc32_result = util::safety::memory_crc_update_register<crc_engine_type>(crc32_result, first, count);
   }
 
 #endif // UTIL_SAFETY_ROM_MEMORY_CHECKSUM_2013_11_27_H_
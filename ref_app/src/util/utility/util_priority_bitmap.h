@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_PRIORITY_BITMAP_2026_10_17_H
+  #define UTIL_PRIORITY_BITMAP_2026_10_17_H
+
+  #include <util/utility/util_utype_helper.h>
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+
+  namespace util
+  {
+    namespace detail
+    {
+      // Count the trailing zeros of a non-zero unsigned value.
+      template<typename UnsignedIntegralType>
+      inline auto priority_bitmap_ctz(const UnsignedIntegralType v) noexcept -> unsigned
+      {
+        #if (defined(__GNUC__) || defined(__clang__))
+        return
+          static_cast<unsigned>
+          (
+            (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<unsigned>::digits)
+              ? __builtin_ctz  (static_cast<unsigned>(v))
+              : __builtin_ctzll(static_cast<unsigned long long>(v)) // NOLINT(google-runtime-int)
+          );
+        #else
+        auto count = static_cast<unsigned>(UINT8_C(0));
+
+        for(auto tmp = v; (tmp & static_cast<UnsignedIntegralType>(UINT8_C(1))) == static_cast<UnsignedIntegralType>(UINT8_C(0)); tmp >>= 1U)
+        {
+          ++count;
+        }
+
+        return count;
+        #endif
+      }
+    } // namespace detail
+
+    // A two-level bitmap in which the lowest set bit has the highest priority.
+    // The summary word holds one bit per non-empty data word, so that finding
+    // the first set bit costs two count-trailing-zeros operations
+    // independent of the number of bits.
+
+    template<const std::size_t BitCount>
+    class priority_bitmap
+    {
+    private:
+      static constexpr auto word_bits =
+        static_cast<unsigned>((BitCount < static_cast<std::size_t>(UINT8_C(32))) ? BitCount : static_cast<std::size_t>(UINT8_C(32)));
+
+      using word_type = typename util::utype_helper<word_bits>::exact_type;
+
+      static constexpr auto word_digits = static_cast<std::size_t>(std::numeric_limits<word_type>::digits);
+
+      static constexpr auto word_count = static_cast<std::size_t>((BitCount + (word_digits - 1U)) / word_digits);
+
+      using summary_type = typename util::utype_helper<static_cast<unsigned>(word_count)>::exact_type;
+
+      static_assert(BitCount > static_cast<std::size_t>(UINT8_C(0)),
+                    "the bit count of the priority bitmap must exceed zero");
+
+      static_assert(word_count <= static_cast<std::size_t>(std::numeric_limits<summary_type>::digits),
+                    "the bit count of the priority bitmap exceeds the range of the summary word");
+
+    public:
+      using size_type = std::size_t;
+
+      static constexpr auto bit_count = static_cast<size_type>(BitCount);
+
+      constexpr priority_bitmap() = default;
+
+      auto set(const size_type i) noexcept -> void
+      {
+        const auto word_index = static_cast<size_type>(i / word_digits);
+
+        my_words[word_index] = static_cast<word_type>(my_words[word_index] | static_cast<word_type>(static_cast<word_type>(UINT8_C(1)) << static_cast<unsigned>(i % word_digits)));
+
+        my_summary = static_cast<summary_type>(my_summary | static_cast<summary_type>(static_cast<summary_type>(UINT8_C(1)) << static_cast<unsigned>(word_index)));
+      }
+
+      auto reset(const size_type i) noexcept -> void
+      {
+        const auto word_index = static_cast<size_type>(i / word_digits);
+
+        my_words[word_index] = static_cast<word_type>(my_words[word_index] & static_cast<word_type>(~static_cast<word_type>(static_cast<word_type>(UINT8_C(1)) << static_cast<unsigned>(i % word_digits))));
+
+        if(my_words[word_index] == static_cast<word_type>(UINT8_C(0)))
+        {
+          my_summary = static_cast<summary_type>(my_summary & static_cast<summary_type>(~static_cast<summary_type>(static_cast<summary_type>(UINT8_C(1)) << static_cast<unsigned>(word_index))));
+        }
+      }
+
+      auto test(const size_type i) const noexcept -> bool
+      {
+        const auto word_index = static_cast<size_type>(i / word_digits);
+
+        return (static_cast<word_type>(my_words[word_index] & static_cast<word_type>(static_cast<word_type>(UINT8_C(1)) << static_cast<unsigned>(i % word_digits))) != static_cast<word_type>(UINT8_C(0)));
+      }
+
+      auto any() const noexcept -> bool { return (my_summary != static_cast<summary_type>(UINT8_C(0))); }
+
+      // Return the index of the lowest set bit, or bit_count if no bit is set.
+      auto find_first() const noexcept -> size_type
+      {
+        if(my_summary == static_cast<summary_type>(UINT8_C(0)))
+        {
+          return bit_count;
+        }
+
+        const auto word_index = static_cast<size_type>(detail::priority_bitmap_ctz(my_summary));
+
+        return static_cast<size_type>
+               (
+                   static_cast<size_type>(word_index * word_digits)
+                 + static_cast<size_type>(detail::priority_bitmap_ctz(my_words[word_index]))
+               );
+      }
+
+    private:
+      std::array<word_type, word_count> my_words { };
+      summary_type                      my_summary { };
+    };
+  } // namespace util
+
+#endif // UTIL_PRIORITY_BITMAP_2026_10_17_H
@@ -63,7 +63,7 @@
 // Type access: MSB first, valid are 1,2,4 and 8 data bytes, the most significant data byte is sent first
 //
 // crc (1 byte) :
-// One byte CRC, using CRC-8 (ITU-T), x^8 + x^2 + x + 1 polynomial
+// One byte CRC, using CRC-8 (Dallas/Maxim), x^8 + x^5 + x^4 + 1 polynomial, reflected
 // CRC is build over mode, address and data bytes
 //
 //
@@ -79,7 +79,7 @@
 // Type access: MSB first, valid are 1, 2, 4 and 8 bytes, the most significant data byte is sent first
 // 
 // crc (1 byte) :
-// One byte CRC, using CRC-8 (ITU-T), x^8 + x^2 + x + 1 polynomial
+// One byte CRC, using CRC-8 (Dallas/Maxim), x^8 + x^5 + x^4 + 1 polynomial, reflected
 // CRC is built over data bytes, in case of a write command, crc is 0x00
 //
 //
@@ -139,6 +139,7 @@
   #endif
 #endif
 
+#include <math/checksums/crc/crc_engine.h>
 #include <util/utility/util_noncopyable.h>
 
 #include <cstdint>
@@ -693,26 +694,19 @@ private:
   ////////////////////////////////////////////////////////////////////////
   // H E L P E R   F U N C T I O N S
 
-  // CRC-8 algorithm, using x^8 + x^2 + x + 1 polynomial
+  // CRC-8 algorithm, using the reflected polynomial 0x8C (x^8 + x^5 + x^4 + 1)
   // Process data, CRC result is in prot_crc_
   // We use a shifter here instead of a table lookup to save code size, speed
-  // is not so important at the swdm baudrate of 250 baud.
+  // is not so important at the swdm baudrate of 250 baud. The shifter is
+  // the generic CRC engine with a table of two entries, i.e., one bit per step.
   // \param data Data to process
   void crc8(std::uint_fast8_t data)
   {
-    for(std::uint_fast8_t i = UINT8_C(8); i; i--)
-    {
-      const std::uint_fast8_t sum = (prot_crc_ ^ data) & UINT8_C(0x01);
+    using crc8_engine_type = math::checksums::crc::crc_engine<8U, UINT8_C(0x31), UINT8_C(0), true, true, UINT8_C(0), 1U>;
 
-      prot_crc_ >>= UINT8_C(1);
+    const auto the_byte = static_cast<std::uint8_t>(data);
 
-      if(sum != UINT8_C(0))
-      {
-        prot_crc_ ^= UINT8_C(0x8C);
-      }
-
-      data >>= UINT8_C(1);
-    }
+    prot_crc_ = crc8_engine_type::update_register(static_cast<std::uint8_t>(prot_crc_), &the_byte, &the_byte + 1U);
   }
 
   // Return the according byte of the given position
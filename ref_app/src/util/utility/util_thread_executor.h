@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_THREAD_EXECUTOR_2026_10_17_H // NOLINT(llvm-header-guard)
+  #define UTIL_THREAD_EXECUTOR_2026_10_17_H
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <thread>
+  #include <vector>
+
+  namespace util {
+
+  // An executor for a host with an operating system, which runs each
+  // partition of a task in its own thread. The first partition runs on
+  // the calling thread. It is called with executor(partition_count, task)
+  // and returns when task(partition) has been called for each partition.
+  // This is the form of executor, which is expected by verify_batch() of
+  // the generic ECC and by decwide_t_executor_scope of wide_decimal.
+
+  struct thread_executor
+  {
+    template<typename TaskType>
+    auto operator()(const std::size_t partition_count, TaskType task) const -> void
+    {
+      std::vector<std::thread> threads { };
+
+      if(partition_count > static_cast<std::size_t>(UINT8_C(1)))
+      {
+        threads.reserve(partition_count - 1U);
+      }
+
+      for(auto partition = static_cast<std::size_t>(UINT8_C(1)); partition < partition_count; ++partition)
+      {
+        threads.emplace_back(task, partition);
+      }
+
+      if(partition_count > static_cast<std::size_t>(UINT8_C(0)))
+      {
+        task(static_cast<std::size_t>(UINT8_C(0)));
+      }
+
+      for(auto& thread : threads)
+      {
+        thread.join();
+      }
+    }
+  };
+
+  } // namespace util
+
+#endif // UTIL_THREAD_EXECUTOR_2026_10_17_H
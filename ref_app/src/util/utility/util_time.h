@@ -81,6 +81,12 @@
         return my_now();
       }
 
+      // Get the timepoint at which this timer times out.
+      constexpr auto get_tick() const -> tick_type
+      {
+        return my_tick;
+      }
+
       constexpr auto get_ticks_since_mark() const -> tick_type
       {
         return my_now() - my_tick;
@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+#
+#  Copyright Christopher Kormanyos 2026.
+#  Distributed under the Boost Software License,
+#  Version 1.0. (See accompanying file LICENSE_1_0.txt
+#  or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+
+# Build all of the host benchmarks into the unified benchmark runner
+# and run them. The compiler and the language standard are taken from
+# the environment variables GCC and STD. All arguments are passed on
+# to the runner, for instance:
+#   ./target/build/test_app_benchmark_runner.sh --filter=crc,hash --repetitions=100 --format=json
+#   ./target/build/test_app_benchmark_runner.sh --repetitions=100 --baseline-compare=baseline.txt
+
+if [[ "$GCC" == "" ]]; then
+    GCC=g++
+fi
+
+if [[ "$STD" == "" ]]; then
+    STD=c++14
+fi
+
+mkdir -p bin/runner
+
+rm -f ./bin/runner/*.*
+
+BENCHMARKS="complex crc fast_math filter fixed_point float hash hash_sha256 none os_dispatch os_event os_executor os_idle_sleep pi_agm pi_spigot pi_spigot_single soft_double_h2f1 trapezoid_integral wide_decimal wide_integer"
+
+if [[ "$GCC" == "g++" ]]; then
+BENCHMARKS="$BENCHMARKS ecc_generic_ecc"
+fi
+
+# The benchmarks of external libraries are added when the libraries
+# have been cloned next to the repository, as in the CI. They are
+# compiled without -Werror, since their warnings are not ours.
+BENCHMARKS_EXTERNAL=""
+
+if [[ -d ../../boost-root ]]; then
+BENCHMARKS_EXTERNAL="$BENCHMARKS_EXTERNAL boost_math_cbrt_tgamma boost_math_cyl_bessel_j boost_multiprecision_cbrt"
+fi
+
+if [[ -d ../../boost-root && -d ../../cppalliance-decimal-root ]]; then
+BENCHMARKS_EXTERNAL="$BENCHMARKS_EXTERNAL non_std_decimal"
+fi
+
+if [[ -d ../../boost-root && -d ../../cppalliance-crypt-root ]]; then
+BENCHMARKS_EXTERNAL="$BENCHMARKS_EXTERNAL boost_crypt_hasher"
+fi
+
+# Compile each benchmark with its own benchmark type, in parallel.
+PIDS=""
+
+for NAME in $BENCHMARKS; do
+    TYPE=APP_BENCHMARK_TYPE_$(echo "$NAME" | tr '[:lower:]' '[:upper:]')
+    $GCC -std=$STD -Wall -Werror -O2 -m64 -pthread -I./src/mcal/host -I./src -DAPP_BENCHMARK_TYPE=$TYPE -DAPP_BENCHMARK_REGISTRY -c ./src/app/benchmark/app_benchmark_$NAME.cpp -o ./bin/runner/app_benchmark_$NAME.o &
+    PIDS="$PIDS $!"
+done
+
+for NAME in $BENCHMARKS_EXTERNAL; do
+    TYPE=APP_BENCHMARK_TYPE_$(echo "$NAME" | tr '[:lower:]' '[:upper:]')
+    $GCC -std=$STD -Wall -O2 -m64 -pthread -I./src/mcal/host -I./src -I../../cppalliance-decimal-root/include -I../../cppalliance-crypt-root/include -I../../boost-root -DAPP_BENCHMARK_TYPE=$TYPE -DAPP_BENCHMARK_REGISTRY -c ./src/app/benchmark/app_benchmark_$NAME.cpp -o ./bin/runner/app_benchmark_$NAME.o &
+    PIDS="$PIDS $!"
+done
+
+result_compile=0
+
+for PID in $PIDS; do
+    wait "$PID" || result_compile=1
+done
+
+if [[ "$result_compile" != "0" ]]; then
+    echo "compile of the benchmarks failed"
+    exit 1
+fi
+
+$GCC -std=$STD -Wall -Werror -O2 -m64 -pthread -I./src/mcal/host -I./src -DAPP_BENCHMARK_REGISTRY ./src/app/benchmark/app_benchmark_runner.cpp ./src/mcal/host/mcal_cpu.cpp ./src/mcal/host/mcal_gpt.cpp ./bin/runner/*.o -o ./bin/app_benchmark_runner.exe
+
+./bin/app_benchmark_runner.exe "$@"
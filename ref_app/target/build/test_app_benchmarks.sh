@@ -25,7 +25,7 @@ rm -f ./bin/*.*
 echo run benchmarks with GCC=$GCC STD=$STD
 
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_COMPLEX                    -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_complex.cpp                    -o ./bin/app_benchmark_complex.exe
-$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_CRC                        -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_crc.cpp                        -o ./bin/app_benchmark_crc.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_CRC                        -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_CRC_THROUGHPUT ./src/app/benchmark/app_benchmark_crc.cpp -o ./bin/app_benchmark_crc.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FAST_MATH                  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fast_math.cpp                  -o ./bin/app_benchmark_fast_math.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FILTER                     -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_filter.cpp                     -o ./bin/app_benchmark_filter.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_FIXED_POINT                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_fixed_point.cpp                -o ./bin/app_benchmark_fixed_point.exe
@@ -36,15 +36,19 @@ $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT                  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot.cpp                  -o ./bin/app_benchmark_pi_spigot.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_PI_SPIGOT_SINGLE           -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_pi_spigot_single.cpp           -o ./bin/app_benchmark_pi_spigot_single.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_SOFT_DOUBLE_H2F1           -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_soft_double_h2f1.cpp           -o ./bin/app_benchmark_soft_double_h2f1.exe
-$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL               -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_decimal.cpp               -o ./bin/app_benchmark_wide_decimal.exe
-$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER               -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_wide_integer.cpp               -o ./bin/app_benchmark_wide_integer.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_DECIMAL               -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_WIDE_DECIMAL_THROUGHPUT ./src/app/benchmark/app_benchmark_wide_decimal.cpp               -o ./bin/app_benchmark_wide_decimal.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_WIDE_INTEGER               -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_WIDE_INTEGER_THROUGHPUT ./src/app/benchmark/app_benchmark_wide_integer.cpp               -o ./bin/app_benchmark_wide_integer.exe
 $GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_TRAPEZOID_INTEGRAL         -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_trapezoid_integral.cpp         -o ./bin/app_benchmark_trapezoid_integral.exe
 $GCC -std=$STD -Wall         -O2 -m64 -I./src/mcal/host -I./src                                          -I../../boost-root -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_BOOST_MATH_CBRT_TGAMMA     -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_boost_math_cbrt_tgamma.cpp     -o ./bin/app_benchmark_boost_math_cbrt_tgamma.exe
 $GCC -std=$STD -Wall         -O2 -m64 -I./src/mcal/host -I./src                                          -I../../boost-root -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_BOOST_MATH_CYL_BESSEL_J    -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_boost_math_cyl_bessel_j.cpp    -o ./bin/app_benchmark_boost_math_cyl_bessel_j.exe
 $GCC -std=$STD -Wall         -O2 -m64 -I./src/mcal/host -I./src                                          -I../../boost-root -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_BOOST_MULTIPRECISION_CBRT  -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_boost_multiprecision_cbrt.cpp  -o ./bin/app_benchmark_boost_multiprecision_cbrt.exe
-$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH_SHA256                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_hash_sha256.cpp                -o ./bin/app_benchmark_hash_sha256.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_HASH_SHA256                -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_HASH_SHA256_THROUGHPUT ./src/app/benchmark/app_benchmark_hash_sha256.cpp                -o ./bin/app_benchmark_hash_sha256.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_DISPATCH                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_os_dispatch.cpp                -o ./bin/app_benchmark_os_dispatch.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_IDLE_SLEEP              -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_os_idle_sleep.cpp ./src/mcal/host/mcal_cpu.cpp -o ./bin/app_benchmark_os_idle_sleep.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_EXECUTOR                -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_os_executor.cpp ./src/mcal/host/mcal_gpt.cpp -o ./bin/app_benchmark_os_executor.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_OS_EVENT                   -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_os_event.cpp ./src/os/os.cpp ./src/mcal/host/mcal_cpu.cpp ./src/mcal/host/mcal_gpt.cpp -o ./bin/app_benchmark_os_event.exe
 if [[ "$GCC" == "g++" ]]; then
-$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src                                                             -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_ECC_GENERIC_ECC            -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_ecc_generic_ecc.cpp            -o ./bin/app_benchmark_ecc_generic_ecc.exe
+$GCC -std=$STD -Wall -Werror -O2 -m64 -I./src/mcal/host -I./src -pthread                                                     -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_ECC_GENERIC_ECC            -DAPP_BENCHMARK_STANDALONE_MAIN -DAPP_BENCHMARK_ECC_GENERIC_ECC_THROUGHPUT ./src/app/benchmark/app_benchmark_ecc_generic_ecc.cpp            -o ./bin/app_benchmark_ecc_generic_ecc.exe
 fi
 $GCC -std=$STD -Wall         -O2 -m64 -I./src/mcal/host -I./src -I../../cppalliance-decimal-root/include -I../../boost-root -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_NON_STD_DECIMAL            -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_non_std_decimal.cpp            -o ./bin/app_benchmark_non_std_decimal.exe
 $GCC -std=$STD -Wall         -O2 -m64 -I./src/mcal/host -I./src -I../../cppalliance-crypt-root/include   -I../../boost-root -DAPP_BENCHMARK_TYPE=APP_BENCHMARK_TYPE_BOOST_CRYPT_HASHER         -DAPP_BENCHMARK_STANDALONE_MAIN ./src/app/benchmark/app_benchmark_boost_crypt_hasher.cpp         -o ./bin/app_benchmark_boost_crypt_hasher.exe
@@ -106,6 +110,18 @@ result_var_boost_multiprecision_cbrt=$?
 ./bin/app_benchmark_hash_sha256.exe
 result_var_hash_sha256=$?
 
+./bin/app_benchmark_os_dispatch.exe
+result_var_os_dispatch=$?
+
+./bin/app_benchmark_os_idle_sleep.exe
+result_var_os_idle_sleep=$?
+
+./bin/app_benchmark_os_executor.exe
+result_var_os_executor=$?
+
+./bin/app_benchmark_os_event.exe
+result_var_os_event=$?
+
 if [[ "$GCC" == "g++" ]]; then
 ./bin/app_benchmark_ecc_generic_ecc.exe
 result_var_ecc_generic_ecc=$?
@@ -136,6 +152,10 @@ echo "result_var_boost_math_cbrt_tgamma   : "  "$result_var_boost_math_cbrt_tgam
 echo "result_var_boost_math_cyl_bessel_j  : "  "$result_var_boost_math_cyl_bessel_j"
 echo "result_var_boost_multiprecision_cbrt: "  "$result_var_boost_multiprecision_cbrt"
 echo "result_var_hash_sha256              : "  "$result_var_hash_sha256"
+echo "result_var_os_dispatch              : "  "$result_var_os_dispatch"
+echo "result_var_os_idle_sleep            : "  "$result_var_os_idle_sleep"
+echo "result_var_os_executor              : "  "$result_var_os_executor"
+echo "result_var_os_event                 : "  "$result_var_os_event"
 if [[ "$GCC" == "g++" ]]; then
 echo "result_var_ecc_generic_ecc          : "  "$result_var_ecc_generic_ecc"
 fi
@@ -143,9 +163,9 @@ echo "result_var_non_std_decimal          : "  "$result_var_non_std_decimal"
 echo "result_var_boost_crypt_hasher       : "  "$result_var_boost_crypt_hasher"
 
 if [[ "$GCC" == "g++" ]]; then
-result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_spigot+result_var_pi_spigot_single+$result_var_soft_double_h2f1+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_integer+result_var_boost_math_cbrt_tgamma+result_var_boost_math_cyl_bessel_j+result_var_boost_multiprecision_cbrt+result_var_hash_sha256+result_var_ecc_generic_ecc+result_var_non_std_decimal+result_ls_boost_crypt_hasher))
+result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_spigot+result_var_pi_spigot_single+$result_var_soft_double_h2f1+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_integer+result_var_boost_math_cbrt_tgamma+result_var_boost_math_cyl_bessel_j+result_var_boost_multiprecision_cbrt+result_var_hash_sha256+result_var_os_dispatch+result_var_ecc_generic_ecc+result_var_os_idle_sleep+result_var_os_executor+result_var_os_event+result_var_non_std_decimal+result_ls_boost_crypt_hasher))
 else
-result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_spigot+result_var_pi_spigot_single+$result_var_soft_double_h2f1+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_integer+result_var_boost_math_cbrt_tgamma+result_var_boost_math_cyl_bessel_j+result_var_boost_multiprecision_cbrt+result_var_hash_sha256+result_var_non_std_decimal+result_ls_boost_crypt_hasher))
+result_total=$((result_var_complex+result_var_crc+result_var_fast_math+result_var_filter+result_var_fixed_point+result_var_float+result_var_hash+result_var_none+result_var_pi_agm+result_var_pi_spigot+result_var_pi_spigot_single+$result_var_soft_double_h2f1+result_var_trapezoid_integral+result_var_wide_decimal+result_var_wide_integer+result_var_boost_math_cbrt_tgamma+result_var_boost_math_cyl_bessel_j+result_var_boost_multiprecision_cbrt+result_var_hash_sha256+result_var_os_dispatch+result_var_os_idle_sleep+result_var_os_executor+result_var_os_event+result_var_non_std_decimal+result_ls_boost_crypt_hasher))
 fi
 
 echo "result_total                        : "  "$result_total"